@@ -0,0 +1,199 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Application.hpp"
+#include "Denoiser.hpp"
+#include <Aurora.Base/IO/Writer.hpp>
+#include <Aurora.Content/Locator/SystemLocator.hpp>
+#include <Aurora.Content/Model/GLTF/Loader.hpp>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define STBI_WRITE_NO_STDIO
+#include <stb_image_write.h>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Baker
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Application::Application()
+        : mResolution { 0 }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Application::Initialize(CStr Filename, UInt32 Resolution, ConstRef<Tracer::Properties> Properties)
+    {
+        mResolution = Resolution;
+        mProperties = Properties;
+
+        // The baker runs on machines without a device, so the content service is created in server mode and the
+        // model goes straight through the importer: the mesh keeps its bytes on the CPU since nothing ever
+        // creates it on the device.
+        mContext.SetMode(Subsystem::Context::Mode::Server);
+        mContent = mContext.AddSubsystem<Content::Service>();
+
+        Data File = Content::SystemLocator().Read(Filename);
+        mModel    = NewPtr<Graphic::Model>(Content::Uri(Filename));
+
+        if (!File.HasData() || !Content::GLTFLoader().Load(* mContent, Move(File), * mModel))
+        {
+            Log::Error("Baker: '{}' is not a valid model", Filename);
+            return false;
+        }
+
+        if (!mScene.Load(* mModel))
+        {
+            Log::Error("Baker: '{}' has no triangles to bake", Filename);
+            return false;
+        }
+
+        Log::Info("Baker: Loaded {} triangle(s) and {} vertices from '{}'",
+            mScene.GetTriangles(), mScene.GetPositions().size(), Filename);
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Application::Run(CStr Output)
+    {
+        const auto AsSeconds = [](UInt64 Start)
+        {
+            return static_cast<Real64>(SDL_GetTicksNS() - Start) / static_cast<Real64>(SDL_NS_PER_SECOND);
+        };
+
+        UInt64 Start = SDL_GetTicksNS();
+        mScene.Build();
+
+        if (!mAtlas.Build(mScene, mResolution))
+        {
+            return false;
+        }
+        Log::Info("Baker: Prepared scene in {:.2f} s", AsSeconds(Start));
+
+        Tracer Tracer(mScene, mAtlas, mProperties);
+
+        Start = SDL_GetTicksNS();
+        Tracer.Rasterize();
+        Tracer.Trace();
+        Log::Info("Baker: Traced {}x{} lightmap with {} sample(s) on {} core(s) in {:.2f} s",
+            mResolution, mResolution, mProperties.Samples, SDL_GetNumLogicalCPUCores(), AsSeconds(Start));
+
+        Start = SDL_GetTicksNS();
+        Tracer.Occlude();
+        Log::Info("Baker: Traced occlusion for {} vertices in {:.2f} s",
+            mScene.GetPositions().size(), AsSeconds(Start));
+
+        Start = SDL_GetTicksNS();
+        Denoiser::Filter(mResolution, mAtlas.GetDensity(), Tracer.GetTexels(), Tracer.GetIrradiance());
+        Denoiser::Dilate(mResolution, Atlas::k_Padding, Tracer.GetTexels(), Tracer.GetIrradiance());
+        Log::Info("Baker: Denoised lightmap in {:.2f} s", AsSeconds(Start));
+
+        return Save(Output, Tracer);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Application::Save(CStr Output, Ref<Tracer> Tracer)
+    {
+        // The lightmap is stored as a radiance file, the irradiance is unbounded and must survive until the
+        // texture importer decides how to encode it for the target device.
+        Vector<UInt8> Image;
+
+        const auto OnWrite = [](Ptr<void> Context, Ptr<void> Bytes, int Size)
+        {
+            Ref<Vector<UInt8>> Buffer = * static_cast<Ptr<Vector<UInt8>>>(Context);
+            Buffer.insert(Buffer.end(), static_cast<Ptr<UInt8>>(Bytes), static_cast<Ptr<UInt8>>(Bytes) + Size);
+        };
+
+        const Ptr<const Real32> Texels = reinterpret_cast<Ptr<const Real32>>(Tracer.GetIrradiance().data());
+
+        if (!stbi_write_hdr_to_func(OnWrite, AddressOf(Image), mResolution, mResolution, 3, Texels))
+        {
+            Log::Error("Baker: Failed to encode the lightmap");
+            return false;
+        }
+
+        // The sidecar carries what the runtime needs to apply the bake: the second uv set of each triangle
+        // corner (charts split vertices, so they don't map 1:1 to the original stream) and the ambient
+        // occlusion of every original vertex.
+        ConstRef<Vector<Vector2f>> Coordinates = mAtlas.GetCoordinates();
+        ConstRef<Vector<Real32>>   Occlusion   = Tracer.GetOcclusion();
+
+        Writer Sidecar;
+        Sidecar.WriteUInt32(k_Magic);
+        Sidecar.WriteUInt32(mResolution);
+        Sidecar.WriteInt(mScene.GetSections().size());
+
+        for (ConstRef<Scene::Section> Section : mScene.GetSections())
+        {
+            const CPtr<const Vector2f> Corners
+                = CPtr<const Vector2f>(Coordinates).subspan(Section.FirstTriangle * 3, Section.Triangles * 3);
+
+            Vector<UInt8> Vertices(Section.Vertices);
+
+            for (UInt32 Vertex = 0; Vertex < Section.Vertices; ++Vertex)
+            {
+                const Real32 Visibility = Clamp(Occlusion[Section.FirstVertex + Vertex], 0.0f, 1.0f);
+                Vertices[Vertex] = static_cast<UInt8>(Visibility * 255.0f + 0.5f);
+            }
+
+            Sidecar.WriteUInt8(Section.Primitive);
+            Sidecar.WriteBlock<Vector2f>(Corners);
+            Sidecar.WriteBlock<UInt8>(Vertices);
+        }
+
+        Content::SystemLocator().Write(Format("{}.hdr", Output), Image);
+        Content::SystemLocator().Write(Format("{}.bake", Output), Sidecar.GetData());
+
+        Log::Info("Baker: Wrote '{}.hdr' ({} bytes) and '{}.bake' ({} bytes)",
+            Output, Image.size(), Output, Sidecar.GetOffset());
+        return true;
+    }
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+int main(int Argc, Ptr<Char> Argv[])
+{
+    Log::Initialize("Aurora.Baker.log");
+
+    if (Argc < 3)
+    {
+        Log::Error("Usage: Aurora_Baker <Model> <Output> [Resolution] [Samples] [Bounces]");
+        return 1;
+    }
+
+    const UInt32 Resolution = (Argc > 3 ? Clamp(SDL_atoi(Argv[3]), 64, 8192) : 1024);
+
+    Baker::Tracer::Properties Properties;
+    Properties.Samples = (Argc > 4 ? Max(SDL_atoi(Argv[4]), 1) : Properties.Samples);
+    Properties.Bounces = (Argc > 5 ? Max(SDL_atoi(Argv[5]), 0) : Properties.Bounces);
+
+    // Initialize 'Aurora Baker' and bake the model
+    UPtr<Baker::Application> Baker = NewUniquePtr<Baker::Application>();
+
+    if (!Baker->Initialize(Argv[1], Resolution, Properties) || !Baker->Run(Argv[2]))
+    {
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
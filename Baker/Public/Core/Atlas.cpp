@@ -0,0 +1,271 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Atlas.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Baker
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Atlas::Build(ConstRef<Scene> Scene, UInt32 Resolution)
+    {
+        mResolution = Resolution;
+
+        Segment(Scene);
+
+        // Start from the density that would fill most of the atlas if the charts were perfect rectangles, then
+        // shrink it until the shelves fit since padding and the gaps between charts always eat some space.
+        Real32 Area = 0.0f;
+
+        for (ConstRef<Chart> Chart : mCharts)
+        {
+            const Vector2f Extent = Chart.Maximum - Chart.Minimum;
+            Area += Extent.GetX() * Extent.GetY();
+        }
+
+        Real32 Density = (Area > 0.0f ? sqrtf(0.6f * Resolution * Resolution / Area) : 1.0f);
+
+        for (UInt32 Attempt = 0; !Pack(Density); ++Attempt)
+        {
+            if (Attempt == k_Attempts)
+            {
+                Log::Error("Baker: Failed to pack {} chart(s) into {}x{}", mCharts.size(), Resolution, Resolution);
+                return false;
+            }
+            Density *= 0.9f;
+        }
+        mDensity = Density;
+
+        // Move every corner from its projected plane into the normalized space of the atlas.
+        const Real32 Inverse = 1.0f / Resolution;
+
+        for (ConstRef<Chart> Chart : mCharts)
+        {
+            const Vector2f Origin(Chart.X + k_Padding, Chart.Y + k_Padding);
+
+            for (const UInt32 Triangle : Chart.Triangles)
+            {
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    Ref<Vector2f> Coordinate = mCoordinates[Triangle * 3 + Corner];
+                    Coordinate = (Origin + (Coordinate - Chart.Minimum) * Density) * Inverse;
+                }
+            }
+        }
+
+        Log::Info("Baker: Packed {} chart(s) at {:.2f} texel(s) per unit", mCharts.size(), Density);
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Atlas::Segment(ConstRef<Scene> Scene)
+    {
+        ConstRef<Vector<Vector3f>> Positions = Scene.GetPositions();
+        ConstRef<Vector<UInt32>>   Indices   = Scene.GetIndices();
+        const UInt32               Triangles = Scene.GetTriangles();
+
+        // Importers split vertices along normal and texture seams, weld them back by position so that charts
+        // are allowed to grow across those seams.
+        const Real32 Cell = 1.0f / Max(Scene.GetExtent() * 1e-5f, FLT_MIN);
+
+        Vector<UInt32>        Welded(Positions.size());
+        Table<UInt64, UInt32> Lookup;
+
+        for (UInt32 Vertex = 0; Vertex < Positions.size(); ++Vertex)
+        {
+            const UInt64 X = static_cast<UInt64>(llroundf(Positions[Vertex].GetX() * Cell)) & 0x1FFFFF;
+            const UInt64 Y = static_cast<UInt64>(llroundf(Positions[Vertex].GetY() * Cell)) & 0x1FFFFF;
+            const UInt64 Z = static_cast<UInt64>(llroundf(Positions[Vertex].GetZ() * Cell)) & 0x1FFFFF;
+
+            Welded[Vertex] = Lookup.try_emplace(X | (Y << 21) | (Z << 42), Vertex).first->second;
+        }
+
+        // Connect every triangle with the ones sharing its edges; non-manifold edges keep their first pair only.
+        Vector<Array<UInt32, 3>> Neighbours(Triangles, Array<UInt32, 3> { UINT32_MAX, UINT32_MAX, UINT32_MAX });
+        Table<UInt64, UInt32>    Edges;
+
+        for (UInt32 Triangle = 0; Triangle < Triangles; ++Triangle)
+        {
+            for (UInt32 Edge = 0; Edge < 3; ++Edge)
+            {
+                const UInt32 A = Welded[Indices[Triangle * 3 + Edge]];
+                const UInt32 B = Welded[Indices[Triangle * 3 + (Edge + 1) % 3]];
+
+                if (A == B)
+                {
+                    continue;
+                }
+
+                const UInt64 Key = (static_cast<UInt64>(Min(A, B)) << 32) | Max(A, B);
+
+                if (const auto [Iterator, Inserted] = Edges.try_emplace(Key, Triangle * 3 + Edge); !Inserted)
+                {
+                    if (const UInt32 Other = Iterator->second; Other != UINT32_MAX)
+                    {
+                        Neighbours[Triangle][Edge]       = Other / 3;
+                        Neighbours[Other / 3][Other % 3] = Triangle;
+                        Iterator->second = UINT32_MAX;
+                    }
+                }
+            }
+        }
+
+        // Classify each triangle by the dominant axis of its normal, a chart is a connected region of the same
+        // class which guarantees that no face is projected at more than ~55 degrees from its plane.
+        Vector<UInt8> Classes(Triangles);
+
+        for (UInt32 Triangle = 0; Triangle < Triangles; ++Triangle)
+        {
+            const Vector3f Normal = Scene.GetFaceNormal(Triangle);
+            const Real32   X      = Abs(Normal.GetX());
+            const Real32   Y      = Abs(Normal.GetY());
+            const Real32   Z      = Abs(Normal.GetZ());
+
+            if (X >= Y && X >= Z)
+            {
+                Classes[Triangle] = (Normal.GetX() < 0.0f ? 1 : 0);
+            }
+            else if (Y >= Z)
+            {
+                Classes[Triangle] = (Normal.GetY() < 0.0f ? 3 : 2);
+            }
+            else
+            {
+                Classes[Triangle] = (Normal.GetZ() < 0.0f ? 5 : 4);
+            }
+        }
+
+        mCharts.clear();
+        mCoordinates.resize(Triangles * 3);
+
+        Vector<UInt32> Owner(Triangles, UINT32_MAX);
+        Vector<UInt32> Queue;
+
+        for (UInt32 Seed = 0; Seed < Triangles; ++Seed)
+        {
+            if (Owner[Seed] != UINT32_MAX)
+            {
+                continue;
+            }
+
+            const UInt32 ID    = mCharts.size();
+            Ref<Chart>   Chart = mCharts.emplace_back();
+
+            Owner[Seed] = ID;
+            Queue.push_back(Seed);
+
+            while (!Queue.empty())
+            {
+                const UInt32 Triangle = Queue.back();
+                Queue.pop_back();
+                Chart.Triangles.push_back(Triangle);
+
+                for (const UInt32 Neighbour : Neighbours[Triangle])
+                {
+                    if (Neighbour == UINT32_MAX || Owner[Neighbour] != UINT32_MAX)
+                    {
+                        continue;
+                    }
+
+                    if (Classes[Neighbour] == Classes[Seed])
+                    {
+                        Owner[Neighbour] = ID;
+                        Queue.push_back(Neighbour);
+                    }
+                }
+            }
+
+            // Project the chart onto the plane of its axis.
+            const UInt32 Axis = Classes[Seed] / 2;
+
+            Chart.Minimum = Vector2f( FLT_MAX,  FLT_MAX);
+            Chart.Maximum = Vector2f(-FLT_MAX, -FLT_MAX);
+
+            for (const UInt32 Triangle : Chart.Triangles)
+            {
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    ConstRef<Vector3f> Position = Positions[Indices[Triangle * 3 + Corner]];
+
+                    const Vector2f Projection
+                        = (Axis == 0 ? Vector2f(Position.GetZ(), Position.GetY())
+                        : (Axis == 1 ? Vector2f(Position.GetX(), Position.GetZ())
+                                     : Vector2f(Position.GetX(), Position.GetY())));
+
+                    mCoordinates[Triangle * 3 + Corner] = Projection;
+                    Chart.Minimum = Vector2f::Min(Chart.Minimum, Projection);
+                    Chart.Maximum = Vector2f::Max(Chart.Maximum, Projection);
+                }
+            }
+        }
+
+        // Tallest charts go first, which is what makes shelf packing waste little space.
+        mOrder.resize(mCharts.size());
+
+        for (UInt32 Index = 0; Index < mOrder.size(); ++Index)
+        {
+            mOrder[Index] = Index;
+        }
+
+        Sort(mOrder, [this](UInt32 First, UInt32 Second)
+        {
+            const Real32 A = mCharts[First].Maximum.GetY() - mCharts[First].Minimum.GetY();
+            const Real32 B = mCharts[Second].Maximum.GetY() - mCharts[Second].Minimum.GetY();
+            return (A != B ? A > B : First < Second);
+        });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Atlas::Pack(Real32 Density)
+    {
+        UInt32 X     = 0;
+        UInt32 Y     = 0;
+        UInt32 Shelf = 0;
+
+        for (const UInt32 Index : mOrder)
+        {
+            Ref<Chart> Chart = mCharts[Index];
+
+            // One extra texel keeps the texel centers on both borders inside the chart.
+            const Vector2f Extent = (Chart.Maximum - Chart.Minimum) * Density;
+            Chart.Width  = static_cast<UInt32>(ceilf(Extent.GetX())) + 1 + k_Padding * 2;
+            Chart.Height = static_cast<UInt32>(ceilf(Extent.GetY())) + 1 + k_Padding * 2;
+
+            if (X + Chart.Width > mResolution)
+            {
+                X     = 0;
+                Y    += Shelf;
+                Shelf = 0;
+            }
+
+            if (X + Chart.Width > mResolution || Y + Chart.Height > mResolution)
+            {
+                return false;
+            }
+
+            Chart.X = X;
+            Chart.Y = Y;
+            X      += Chart.Width;
+            Shelf   = Max(Shelf, Chart.Height);
+        }
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Scene.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Baker
+{
+    // -=(Undocumented)=-
+    class Atlas final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Padding  = 2;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Attempts = 64;
+
+    public:
+
+        // -=(Undocumented)=-
+        Bool Build(ConstRef<Scene> Scene, UInt32 Resolution);
+
+        // -=(Undocumented)=-
+        UInt32 GetResolution() const
+        {
+            return mResolution;
+        }
+
+        // -=(Undocumented)=-
+        Real32 GetDensity() const
+        {
+            return mDensity;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetCharts() const
+        {
+            return mCharts.size();
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Vector2f>> GetCoordinates() const
+        {
+            return mCoordinates;
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Chart
+        {
+            // -=(Undocumented)=-
+            Vector<UInt32> Triangles;
+
+            // -=(Undocumented)=-
+            Vector2f       Minimum;
+
+            // -=(Undocumented)=-
+            Vector2f       Maximum;
+
+            // -=(Undocumented)=-
+            UInt32         X      = 0;
+
+            // -=(Undocumented)=-
+            UInt32         Y      = 0;
+
+            // -=(Undocumented)=-
+            UInt32         Width  = 0;
+
+            // -=(Undocumented)=-
+            UInt32         Height = 0;
+        };
+
+        // -=(Undocumented)=-
+        void Segment(ConstRef<Scene> Scene);
+
+        // -=(Undocumented)=-
+        Bool Pack(Real32 Density);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UInt32           mResolution = 0;
+        Real32           mDensity    = 0.0f;
+        Vector<Chart>    mCharts;
+        Vector<UInt32>   mOrder;
+        Vector<Vector2f> mCoordinates;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Denoiser.hpp"
+#include "Parallel.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Baker
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Denoiser::Filter(
+        UInt32 Resolution, Real32 Density,
+        ConstRef<Vector<Tracer::Texel>> Texels, Ref<Vector<Vector3f>> Irradiance)
+    {
+        static constexpr Array<Real32, 5> k_Kernel = { 0.0625f, 0.25f, 0.375f, 0.25f, 0.0625f };
+
+        const SInt32 Size = Resolution;
+
+        // The color edge-stop is relative to the average brightness of the bake, so the same settings work for
+        // dim interiors and sunlit exteriors alike.
+        Real64 Total = 0.0;
+        UInt32 Count = 0;
+
+        for (UInt32 Index = 0; Index < Texels.size(); ++Index)
+        {
+            if (Texels[Index].Valid)
+            {
+                Total += Irradiance[Index].Dot(Vector3f(0.2126f, 0.7152f, 0.0722f));
+                ++Count;
+            }
+        }
+
+        const Real32 Mean     = static_cast<Real32>(Count > 0 ? Total / Count : 0.0);
+        const Real32 Spacing  = 1.0f / Max(Density, FLT_MIN);
+        const Real32 Distance = 4.0f * Spacing * Spacing;
+
+        Vector<Vector3f> Output(Irradiance.size());
+
+        // Edge-avoiding à-trous wavelet: a 5x5 B3 spline whose taps spread twice as far on every pass, weighted
+        // down across creases (normal), across charts or depth discontinuities (position) and across shadow
+        // boundaries (color), which smooths the Monte Carlo noise without bleeding light through geometry.
+        for (UInt32 Pass = 0; Pass < k_Passes; ++Pass)
+        {
+            const SInt32 Step  = 1 << Pass;
+            const Real32 Color = Max(Mean * Mean * 4.0f, 1e-6f) / static_cast<Real32>(Step);
+
+            Parallel(Resolution, [&](UInt32 Row)
+            {
+                for (UInt32 Column = 0; Column < Resolution; ++Column)
+                {
+                    const UInt32 Index = Row * Resolution + Column;
+
+                    if (!Texels[Index].Valid)
+                    {
+                        Output[Index] = Irradiance[Index];
+                        continue;
+                    }
+
+                    ConstRef<Tracer::Texel> Center = Texels[Index];
+                    Vector3f                Sum(0.0f, 0.0f, 0.0f);
+                    Real32                  Weight = 0.0f;
+
+                    for (SInt32 Y = -2; Y <= 2; ++Y)
+                    {
+                        for (SInt32 X = -2; X <= 2; ++X)
+                        {
+                            const SInt32 Horizontal = static_cast<SInt32>(Column) + X * Step;
+                            const SInt32 Vertical   = static_cast<SInt32>(Row)    + Y * Step;
+
+                            if (Horizontal < 0 || Vertical < 0 || Horizontal >= Size || Vertical >= Size)
+                            {
+                                continue;
+                            }
+
+                            const UInt32 Neighbour = Vertical * Resolution + Horizontal;
+
+                            if (!Texels[Neighbour].Valid)
+                            {
+                                continue;
+                            }
+
+                            const Real32 Facing    = Max(Center.Normal.Dot(Texels[Neighbour].Normal), 0.0f);
+                            const Real32 Separated = (Center.Position - Texels[Neighbour].Position).GetLengthSquared();
+                            const Real32 Contrast  = (Irradiance[Index] - Irradiance[Neighbour]).GetLengthSquared();
+
+                            const Real32 Factor = k_Kernel[X + 2] * k_Kernel[Y + 2]
+                                * powf(Facing, 64.0f)
+                                * expf(-Separated / (Distance * Step * Step))
+                                * expf(-Contrast / Color);
+
+                            Sum    += Irradiance[Neighbour] * Factor;
+                            Weight += Factor;
+                        }
+                    }
+                    Output[Index] = (Weight > 0.0f ? Sum / Weight : Irradiance[Index]);
+                }
+            });
+
+            std::swap(Irradiance, Output);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Denoiser::Dilate(
+        UInt32 Resolution, UInt32 Iterations,
+        ConstRef<Vector<Tracer::Texel>> Texels, Ref<Vector<Vector3f>> Irradiance)
+    {
+        const SInt32  Size = Resolution;
+        Vector<UInt8> Covered(Texels.size());
+
+        for (UInt32 Index = 0; Index < Texels.size(); ++Index)
+        {
+            Covered[Index] = (Texels[Index].Valid ? 1 : 0);
+        }
+
+        // Grow every chart into its padding, otherwise bilinear filtering and mip-mapping pull in the black
+        // texels around it and the seams show up as dark lines at runtime.
+        Vector<UInt8>    Grown(Covered);
+        Vector<Vector3f> Output(Irradiance);
+
+        for (UInt32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            Parallel(Resolution, [&](UInt32 Row)
+            {
+                for (UInt32 Column = 0; Column < Resolution; ++Column)
+                {
+                    const UInt32 Index = Row * Resolution + Column;
+
+                    if (Covered[Index])
+                    {
+                        continue;
+                    }
+
+                    Vector3f Sum(0.0f, 0.0f, 0.0f);
+                    UInt32   Count = 0;
+
+                    for (SInt32 Y = -1; Y <= 1; ++Y)
+                    {
+                        for (SInt32 X = -1; X <= 1; ++X)
+                        {
+                            const SInt32 Horizontal = static_cast<SInt32>(Column) + X;
+                            const SInt32 Vertical   = static_cast<SInt32>(Row)    + Y;
+
+                            if (Horizontal < 0 || Vertical < 0 || Horizontal >= Size || Vertical >= Size)
+                            {
+                                continue;
+                            }
+
+                            if (const UInt32 Neighbour = Vertical * Resolution + Horizontal; Covered[Neighbour])
+                            {
+                                Sum += Irradiance[Neighbour];
+                                ++Count;
+                            }
+                        }
+                    }
+
+                    if (Count > 0)
+                    {
+                        Output[Index] = Sum / static_cast<Real32>(Count);
+                        Grown[Index]  = 1;
+                    }
+                }
+            });
+
+            Covered    = Grown;
+            Irradiance = Output;
+        }
+    }
+}
\ No newline at end of file
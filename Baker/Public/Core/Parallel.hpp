@@ -0,0 +1,47 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Aurora.Base/Base.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Baker
+{
+    // -=(Undocumented)=-
+    template<typename Function>
+    void Parallel(UInt32 Count, Any<Function> Task)
+    {
+        // Every logical core pulls the next item from a shared cursor, which keeps them busy even when the cost
+        // of each item varies wildly. Workers are joined when the vector goes out of scope.
+        const UInt32   Threads = Min<UInt32>(Max(SDL_GetNumLogicalCPUCores(), 1), Max<UInt32>(Count, 1));
+        Atomic<UInt32> Cursor  = 0;
+
+        Vector<Thread> Workers;
+        Workers.reserve(Threads);
+
+        for (UInt32 Worker = 0; Worker < Threads; ++Worker)
+        {
+            Workers.emplace_back([&Cursor, &Task, Count]()
+            {
+                for (UInt32 Item = Cursor.fetch_add(1, std::memory_order_relaxed); Item < Count;
+                     Item = Cursor.fetch_add(1, std::memory_order_relaxed))
+                {
+                    Task(Item);
+                }
+            });
+        }
+    }
+}
\ No newline at end of file
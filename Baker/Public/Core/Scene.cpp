@@ -0,0 +1,513 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Scene.hpp"
+#include <Aurora.Content/Model/Quantizer.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Baker
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Real32 GetAxis(ConstRef<Vector3f> Vector, UInt32 Axis)
+    {
+        return (Axis == 0 ? Vector.GetX() : (Axis == 1 ? Vector.GetY() : Vector.GetZ()));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Real32 GetArea(ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum)
+    {
+        const Vector3f Extent = Vector3f::Max(Maximum - Minimum, Vector3f(0.0f, 0.0f, 0.0f));
+        return Extent.GetX() * Extent.GetY() + Extent.GetY() * Extent.GetZ() + Extent.GetZ() * Extent.GetX();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Scene::Load(ConstRef<Graphic::Model> Model)
+    {
+        ConstSPtr<Graphic::Mesh> Mesh = Model.GetMesh();
+
+        if (!Mesh || !Mesh->GetBytes(Graphic::Usage::Vertex).HasData())
+        {
+            return false;
+        }
+
+        const Ptr<const UInt8> Vertices = Mesh->GetBytes(Graphic::Usage::Vertex).GetData<UInt8>();
+        const Ptr<const UInt8> Indices  = Mesh->GetBytes(Graphic::Usage::Index).GetData<UInt8>();
+
+        for (UInt8 ID = 0; ConstRef<Graphic::Mesh::Primitive> Primitive : Mesh->GetPrimitives())
+        {
+            ConstRef<Graphic::Mesh::Attribute> Position = Primitive.GetAttribute(Graphic::VertexSemantic::Position);
+            ConstRef<Graphic::Mesh::Attribute> Normal   = Primitive.GetAttribute(Graphic::VertexSemantic::Normal);
+
+            Section Section;
+            Section.Primitive     = ID++;
+            Section.FirstVertex   = mPositions.size();
+            Section.Vertices      = (Position.Length > 0 ? Position.Length / Position.Stride : 0);
+            Section.FirstTriangle = mIndices.size() / 3;
+            Section.Triangles     = 0;
+
+            // Positions come out of the importer quantized against the bounds of the primitive, while normals are
+            // octahedral encoded; both are expanded back to full precision since the tracer works in model space.
+            for (UInt32 Vertex = 0; Vertex < Section.Vertices; ++Vertex)
+            {
+                const Ptr<const UInt8> Input = Vertices + Position.Offset + Vertex * Position.Stride;
+
+                if (Position.Format == Graphic::VertexFormat::UIntNorm16x4)
+                {
+                    Array<UInt16, 4> Encoded;
+                    memcpy(Encoded.data(), Input, sizeof(Encoded));
+                    mPositions.emplace_back(
+                        Content::MeshQuantizer::DecodePosition(Encoded, Primitive.Minimum, Primitive.Maximum));
+                }
+                else
+                {
+                    Vector3f Value;
+                    memcpy(AddressOf(Value), Input, sizeof(Vector3f));
+                    mPositions.emplace_back(Value);
+                }
+
+                Vector3f Direction(0.0f, 0.0f, 0.0f);
+
+                if (Normal.Length > 0)
+                {
+                    const Ptr<const UInt8> Element = Vertices + Normal.Offset + Vertex * Normal.Stride;
+
+                    if (Normal.Format == Graphic::VertexFormat::SIntNorm16x2)
+                    {
+                        Array<SInt16, 2> Encoded;
+                        memcpy(Encoded.data(), Element, sizeof(Encoded));
+                        Direction = Content::MeshQuantizer::DecodeOctahedral(Encoded);
+                    }
+                    else
+                    {
+                        memcpy(AddressOf(Direction), Element, sizeof(Vector3f));
+                    }
+                }
+                mNormals.emplace_back(Direction);
+            }
+
+            if (Primitive.Indices.Length > 0)
+            {
+                const UInt32 Count = Primitive.Indices.Length / Primitive.Indices.Stride;
+
+                for (UInt32 Element = 0; Element < Count; ++Element)
+                {
+                    const Ptr<const UInt8> Input
+                        = Indices + Primitive.Indices.Offset + Element * Primitive.Indices.Stride;
+
+                    UInt32 Index = 0;
+                    if (Primitive.Indices.Stride == sizeof(UInt16))
+                    {
+                        UInt16 Value;
+                        memcpy(AddressOf(Value), Input, sizeof(UInt16));
+                        Index = Value;
+                    }
+                    else
+                    {
+                        memcpy(AddressOf(Index), Input, sizeof(UInt32));
+                    }
+                    mIndices.push_back(Section.FirstVertex + Index);
+                }
+            }
+            else
+            {
+                for (UInt32 Vertex = 0; Vertex < Section.Vertices; ++Vertex)
+                {
+                    mIndices.push_back(Section.FirstVertex + Vertex);
+                }
+            }
+
+            Section.Triangles = mIndices.size() / 3 - Section.FirstTriangle;
+            mSections.push_back(Section);
+        }
+
+        // Primitives without normals get smooth ones from the area weighted faces around each vertex.
+        for (ConstRef<Section> Section : mSections)
+        {
+            if (Mesh->GetPrimitive(Section.Primitive).GetAttribute(Graphic::VertexSemantic::Normal).Length > 0)
+            {
+                continue;
+            }
+
+            const UInt32 Last = Section.FirstTriangle + Section.Triangles;
+
+            for (UInt32 Triangle = Section.FirstTriangle; Triangle < Last; ++Triangle)
+            {
+                const Vector3f Face = Vector3f::Cross(
+                    mPositions[mIndices[Triangle * 3 + 1]] - mPositions[mIndices[Triangle * 3]],
+                    mPositions[mIndices[Triangle * 3 + 2]] - mPositions[mIndices[Triangle * 3]]);
+
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    mNormals[mIndices[Triangle * 3 + Corner]] += Face;
+                }
+            }
+        }
+
+        for (Ref<Vector3f> Normal : mNormals)
+        {
+            Normal = (Normal.IsZero() ? Vector3f(0.0f, 1.0f, 0.0f) : Vector3f::Normalize(Normal));
+        }
+        return GetTriangles() > 0;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Scene::Build()
+    {
+        const UInt32 Triangles = GetTriangles();
+
+        mOrder.resize(Triangles);
+        mCentroids.resize(Triangles);
+
+        for (UInt32 Triangle = 0; Triangle < Triangles; ++Triangle)
+        {
+            mOrder[Triangle]     = Triangle;
+            mCentroids[Triangle] = (mPositions[mIndices[Triangle * 3]]
+                                  + mPositions[mIndices[Triangle * 3 + 1]]
+                                  + mPositions[mIndices[Triangle * 3 + 2]]) * (1.0f / 3.0f);
+        }
+
+        mNodes.clear();
+        mNodes.reserve(Triangles * 2);
+        mNodes.push_back(Node { Vector3f(), Vector3f(), 0, Triangles });
+
+        Subdivide(0);
+
+        Log::Info("Baker: Built BVH with {} node(s) over {} triangle(s)", mNodes.size(), Triangles);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Scene::Intersect(Ref<Ray> Ray, Ref<Hit> Hit) const
+    {
+        const Vector3f Inverse(
+            1.0f / Ray.Direction.GetX(), 1.0f / Ray.Direction.GetY(), 1.0f / Ray.Direction.GetZ());
+
+        Array<UInt32, 64> Stack;
+        UInt32            Depth = 0;
+        Bool              Found = false;
+
+        Stack[Depth++] = 0;
+
+        while (Depth > 0)
+        {
+            ConstRef<Node> Node = mNodes[Stack[--Depth]];
+
+            if (!IntersectBounds(Node, Ray, Inverse))
+            {
+                continue;
+            }
+
+            if (Node.Count > 0)
+            {
+                for (UInt32 Element = Node.Offset; Element < Node.Offset + Node.Count; ++Element)
+                {
+                    Found |= IntersectTriangle(mOrder[Element], Ray, Ray.Distance, Hit);
+                }
+            }
+            else
+            {
+                Stack[Depth++] = Node.Offset;
+                Stack[Depth++] = Node.Offset + 1;
+            }
+        }
+        return Found;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Scene::Occluded(ConstRef<Ray> Ray) const
+    {
+        const Vector3f Inverse(
+            1.0f / Ray.Direction.GetX(), 1.0f / Ray.Direction.GetY(), 1.0f / Ray.Direction.GetZ());
+
+        Array<UInt32, 64> Stack;
+        UInt32            Depth = 0;
+
+        Stack[Depth++] = 0;
+
+        // Shadow rays only care about any hit, so the first intersection ends the traversal.
+        while (Depth > 0)
+        {
+            ConstRef<Node> Node = mNodes[Stack[--Depth]];
+
+            if (!IntersectBounds(Node, Ray, Inverse))
+            {
+                continue;
+            }
+
+            if (Node.Count > 0)
+            {
+                for (UInt32 Element = Node.Offset; Element < Node.Offset + Node.Count; ++Element)
+                {
+                    Real32 Distance = Ray.Distance;
+                    Hit    Ignored;
+
+                    if (IntersectTriangle(mOrder[Element], Ray, Distance, Ignored))
+                    {
+                        return true;
+                    }
+                }
+            }
+            else
+            {
+                Stack[Depth++] = Node.Offset;
+                Stack[Depth++] = Node.Offset + 1;
+            }
+        }
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector3f Scene::GetNormal(ConstRef<Hit> Hit) const
+    {
+        ConstRef<Vector3f> N0 = mNormals[mIndices[Hit.Triangle * 3]];
+        ConstRef<Vector3f> N1 = mNormals[mIndices[Hit.Triangle * 3 + 1]];
+        ConstRef<Vector3f> N2 = mNormals[mIndices[Hit.Triangle * 3 + 2]];
+
+        return Vector3f::Normalize(N0 * (1.0f - Hit.U - Hit.V) + N1 * Hit.U + N2 * Hit.V);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector3f Scene::GetFaceNormal(UInt32 Triangle) const
+    {
+        ConstRef<Vector3f> P0 = mPositions[mIndices[Triangle * 3]];
+        ConstRef<Vector3f> P1 = mPositions[mIndices[Triangle * 3 + 1]];
+        ConstRef<Vector3f> P2 = mPositions[mIndices[Triangle * 3 + 2]];
+
+        const Vector3f Face = Vector3f::Cross(P1 - P0, P2 - P0);
+        return (Face.IsZero() ? Vector3f(0.0f, 1.0f, 0.0f) : Vector3f::Normalize(Face));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Scene::Subdivide(UInt32 Index)
+    {
+        Vector3f Minimum( FLT_MAX,  FLT_MAX,  FLT_MAX);
+        Vector3f Maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        Vector3f Lower  ( FLT_MAX,  FLT_MAX,  FLT_MAX);
+        Vector3f Upper  (-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+        const UInt32 First = mNodes[Index].Offset;
+        const UInt32 Count = mNodes[Index].Count;
+
+        for (UInt32 Element = First; Element < First + Count; ++Element)
+        {
+            const UInt32 Triangle = mOrder[Element];
+
+            for (UInt32 Corner = 0; Corner < 3; ++Corner)
+            {
+                Minimum = Vector3f::Min(Minimum, mPositions[mIndices[Triangle * 3 + Corner]]);
+                Maximum = Vector3f::Max(Maximum, mPositions[mIndices[Triangle * 3 + Corner]]);
+            }
+            Lower = Vector3f::Min(Lower, mCentroids[Triangle]);
+            Upper = Vector3f::Max(Upper, mCentroids[Triangle]);
+        }
+
+        mNodes[Index].Minimum = Minimum;
+        mNodes[Index].Maximum = Maximum;
+
+        if (Count <= k_MaxLeaf)
+        {
+            return;
+        }
+
+        // Binned surface area heuristic: bucket the centroids along each axis and split at the boundary
+        // with the lowest expected traversal cost, leaves are kept whenever no split beats them.
+        Real32 BestCost  = GetArea(Minimum, Maximum) * Count;
+        UInt32 BestAxis  = UINT32_MAX;
+        UInt32 BestSplit = 0;
+
+        for (UInt32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const Real32 Start  = GetAxis(Lower, Axis);
+            const Real32 Extent = GetAxis(Upper, Axis) - Start;
+
+            if (Extent <= 0.0f)
+            {
+                continue;
+            }
+
+            Array<Vector3f, k_Bins> BinMinimum;
+            Array<Vector3f, k_Bins> BinMaximum;
+            Array<UInt32, k_Bins>   BinCount { };
+
+            BinMinimum.fill(Vector3f( FLT_MAX,  FLT_MAX,  FLT_MAX));
+            BinMaximum.fill(Vector3f(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+
+            for (UInt32 Element = First; Element < First + Count; ++Element)
+            {
+                const UInt32 Triangle = mOrder[Element];
+                const UInt32 Bin      = Min<UInt32>(
+                    k_Bins - 1, (GetAxis(mCentroids[Triangle], Axis) - Start) / Extent * k_Bins);
+
+                ++BinCount[Bin];
+
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    BinMinimum[Bin] = Vector3f::Min(BinMinimum[Bin], mPositions[mIndices[Triangle * 3 + Corner]]);
+                    BinMaximum[Bin] = Vector3f::Max(BinMaximum[Bin], mPositions[mIndices[Triangle * 3 + Corner]]);
+                }
+            }
+
+            Array<Real32, k_Bins - 1> LeftCost;
+            Vector3f                  AccumulatedMinimum( FLT_MAX,  FLT_MAX,  FLT_MAX);
+            Vector3f                  AccumulatedMaximum(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+            UInt32                    Accumulated = 0;
+
+            for (UInt32 Bin = 0; Bin < k_Bins - 1; ++Bin)
+            {
+                AccumulatedMinimum = Vector3f::Min(AccumulatedMinimum, BinMinimum[Bin]);
+                AccumulatedMaximum = Vector3f::Max(AccumulatedMaximum, BinMaximum[Bin]);
+                Accumulated       += BinCount[Bin];
+                LeftCost[Bin]      = GetArea(AccumulatedMinimum, AccumulatedMaximum) * Accumulated;
+            }
+
+            AccumulatedMinimum = Vector3f( FLT_MAX,  FLT_MAX,  FLT_MAX);
+            AccumulatedMaximum = Vector3f(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+            Accumulated        = 0;
+
+            for (UInt32 Bin = k_Bins - 1; Bin > 0; --Bin)
+            {
+                AccumulatedMinimum = Vector3f::Min(AccumulatedMinimum, BinMinimum[Bin]);
+                AccumulatedMaximum = Vector3f::Max(AccumulatedMaximum, BinMaximum[Bin]);
+                Accumulated       += BinCount[Bin];
+
+                const Real32 Cost = LeftCost[Bin - 1] + GetArea(AccumulatedMinimum, AccumulatedMaximum) * Accumulated;
+
+                if (Accumulated < Count && Cost < BestCost)
+                {
+                    BestCost  = Cost;
+                    BestAxis  = Axis;
+                    BestSplit = Bin;
+                }
+            }
+        }
+
+        if (BestAxis == UINT32_MAX)
+        {
+            return;
+        }
+
+        const Real32 Start  = GetAxis(Lower, BestAxis);
+        const Real32 Extent = GetAxis(Upper, BestAxis) - Start;
+
+        const auto Middle = std::partition(mOrder.begin() + First, mOrder.begin() + First + Count, [&](UInt32 Triangle)
+        {
+            const Real32 Position = (GetAxis(mCentroids[Triangle], BestAxis) - Start) / Extent;
+            return Min<UInt32>(k_Bins - 1, Position * k_Bins) < BestSplit;
+        });
+
+        const UInt32 Left = Middle - (mOrder.begin() + First);
+
+        if (Left == 0 || Left == Count)
+        {
+            return;
+        }
+
+        // Children are always allocated next to each other, so an interior node only needs the first of them.
+        const UInt32 Child = mNodes.size();
+        mNodes.push_back(Node { Vector3f(), Vector3f(), First, Left });
+        mNodes.push_back(Node { Vector3f(), Vector3f(), First + Left, Count - Left });
+
+        mNodes[Index].Offset = Child;
+        mNodes[Index].Count  = 0;
+
+        Subdivide(Child);
+        Subdivide(Child + 1);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Scene::IntersectTriangle(UInt32 Triangle, ConstRef<Ray> Ray, Ref<Real32> Distance, Ref<Hit> Hit) const
+    {
+        constexpr Real32 k_Epsilon = 1e-8f;
+
+        ConstRef<Vector3f> P0 = mPositions[mIndices[Triangle * 3]];
+        ConstRef<Vector3f> P1 = mPositions[mIndices[Triangle * 3 + 1]];
+        ConstRef<Vector3f> P2 = mPositions[mIndices[Triangle * 3 + 2]];
+
+        // Möller-Trumbore, two-sided since lightmapped geometry is rarely closed.
+        const Vector3f Edge1         = P1 - P0;
+        const Vector3f Edge2         = P2 - P0;
+        const Vector3f Perpendicular = Vector3f::Cross(Ray.Direction, Edge2);
+        const Real32   Determinant   = Edge1.Dot(Perpendicular);
+
+        if (Abs(Determinant) < k_Epsilon)
+        {
+            return false;
+        }
+
+        const Real32   Inverse = 1.0f / Determinant;
+        const Vector3f Offset  = Ray.Origin - P0;
+        const Real32   U       = Offset.Dot(Perpendicular) * Inverse;
+
+        if (U < 0.0f || U > 1.0f)
+        {
+            return false;
+        }
+
+        const Vector3f Other = Vector3f::Cross(Offset, Edge1);
+        const Real32   V     = Ray.Direction.Dot(Other) * Inverse;
+
+        if (V < 0.0f || U + V > 1.0f)
+        {
+            return false;
+        }
+
+        const Real32 T = Edge2.Dot(Other) * Inverse;
+
+        if (T <= 0.0f || T >= Distance)
+        {
+            return false;
+        }
+
+        Distance     = T;
+        Hit.Triangle = Triangle;
+        Hit.U        = U;
+        Hit.V        = V;
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Scene::IntersectBounds(ConstRef<Node> Node, ConstRef<Ray> Ray, ConstRef<Vector3f> Inverse)
+    {
+        const Vector3f T0   = (Node.Minimum - Ray.Origin) * Inverse;
+        const Vector3f T1   = (Node.Maximum - Ray.Origin) * Inverse;
+        const Vector3f Near = Vector3f::Min(T0, T1);
+        const Vector3f Far  = Vector3f::Max(T0, T1);
+
+        const Real32 Enter = Max(Max(Near.GetX(), Near.GetY()), Max(Near.GetZ(), 0.0f));
+        const Real32 Exit  = Min(Min(Far.GetX(), Far.GetY()), Min(Far.GetZ(), Ray.Distance));
+        return Enter <= Exit;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Aurora.Graphic/Model.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Baker
+{
+    // -=(Undocumented)=-
+    class Scene final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxLeaf = 4;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Bins    = 12;
+
+        // -=(Undocumented)=-
+        struct Section
+        {
+            // -=(Undocumented)=-
+            UInt8  Primitive;
+
+            // -=(Undocumented)=-
+            UInt32 FirstVertex;
+
+            // -=(Undocumented)=-
+            UInt32 Vertices;
+
+            // -=(Undocumented)=-
+            UInt32 FirstTriangle;
+
+            // -=(Undocumented)=-
+            UInt32 Triangles;
+        };
+
+        // -=(Undocumented)=-
+        struct Ray
+        {
+            // -=(Undocumented)=-
+            Vector3f Origin;
+
+            // -=(Undocumented)=-
+            Vector3f Direction;
+
+            // -=(Undocumented)=-
+            Real32   Distance;
+        };
+
+        // -=(Undocumented)=-
+        struct Hit
+        {
+            // -=(Undocumented)=-
+            UInt32 Triangle = UINT32_MAX;
+
+            // -=(Undocumented)=-
+            Real32 U        = 0.0f;
+
+            // -=(Undocumented)=-
+            Real32 V        = 0.0f;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        Bool Load(ConstRef<Graphic::Model> Model);
+
+        // -=(Undocumented)=-
+        void Build();
+
+        // -=(Undocumented)=-
+        Bool Intersect(Ref<Ray> Ray, Ref<Hit> Hit) const;
+
+        // -=(Undocumented)=-
+        Bool Occluded(ConstRef<Ray> Ray) const;
+
+        // -=(Undocumented)=-
+        Vector3f GetNormal(ConstRef<Hit> Hit) const;
+
+        // -=(Undocumented)=-
+        Vector3f GetFaceNormal(UInt32 Triangle) const;
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Section>> GetSections() const
+        {
+            return mSections;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Vector3f>> GetPositions() const
+        {
+            return mPositions;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Vector3f>> GetNormals() const
+        {
+            return mNormals;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<UInt32>> GetIndices() const
+        {
+            return mIndices;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetTriangles() const
+        {
+            return mIndices.size() / 3;
+        }
+
+        // -=(Undocumented)=-
+        Real32 GetExtent() const
+        {
+            return mNodes.empty() ? 0.0f : (mNodes[0].Maximum - mNodes[0].Minimum).GetLength();
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Node
+        {
+            // -=(Undocumented)=-
+            Vector3f Minimum;
+
+            // -=(Undocumented)=-
+            Vector3f Maximum;
+
+            // -=(Undocumented)=-
+            UInt32   Offset;
+
+            // -=(Undocumented)=-
+            UInt32   Count;
+        };
+
+        // -=(Undocumented)=-
+        void Subdivide(UInt32 Index);
+
+        // -=(Undocumented)=-
+        Bool IntersectTriangle(UInt32 Triangle, ConstRef<Ray> Ray, Ref<Real32> Distance, Ref<Hit> Hit) const;
+
+        // -=(Undocumented)=-
+        static Bool IntersectBounds(ConstRef<Node> Node, ConstRef<Ray> Ray, ConstRef<Vector3f> Inverse);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Section>  mSections;
+        Vector<Vector3f> mPositions;
+        Vector<Vector3f> mNormals;
+        Vector<UInt32>   mIndices;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Node>     mNodes;
+        Vector<UInt32>   mOrder;
+        Vector<Vector3f> mCentroids;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Tracer.hpp"
+#include "Parallel.hpp"
+#include <Aurora.Math/Trigonometry.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Baker
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Tracer::Tracer(ConstRef<Scene> Scene, ConstRef<Atlas> Atlas, ConstRef<Properties> Properties)
+        : mScene      { Scene },
+          mAtlas      { Atlas },
+          mProperties { Properties },
+          mBias       { Max(Scene.GetExtent() * 1e-4f, 1e-5f) }
+    {
+        mProperties.Direction = Vector3f::Normalize(mProperties.Direction);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tracer::Rasterize()
+    {
+        constexpr Real32 k_Tolerance = -1e-4f;
+
+        ConstRef<Vector<Vector3f>> Positions   = mScene.GetPositions();
+        ConstRef<Vector<Vector3f>> Normals     = mScene.GetNormals();
+        ConstRef<Vector<UInt32>>   Indices     = mScene.GetIndices();
+        ConstRef<Vector<Vector2f>> Coordinates = mAtlas.GetCoordinates();
+        const UInt32               Resolution  = mAtlas.GetResolution();
+
+        mTexels.assign(Resolution * Resolution, Texel());
+
+        // Charts never overlap in the atlas, so every covered texel belongs to a single triangle and the surface
+        // point under its center becomes the origin of every ray gathered for it.
+        for (UInt32 Triangle = 0; Triangle < mScene.GetTriangles(); ++Triangle)
+        {
+            const Vector2f T0 = Coordinates[Triangle * 3]     * static_cast<Real32>(Resolution);
+            const Vector2f T1 = Coordinates[Triangle * 3 + 1] * static_cast<Real32>(Resolution);
+            const Vector2f T2 = Coordinates[Triangle * 3 + 2] * static_cast<Real32>(Resolution);
+
+            const Real32 Area = Vector2f::Cross(T1 - T0, T2 - T0);
+
+            if (Abs(Area) < 1e-12f)
+            {
+                continue;
+            }
+
+            const Vector2f Minimum = Vector2f::Min(T0, Vector2f::Min(T1, T2));
+            const Vector2f Maximum = Vector2f::Max(T0, Vector2f::Max(T1, T2));
+
+            const UInt32 X0 = static_cast<UInt32>(Max(floorf(Minimum.GetX()), 0.0f));
+            const UInt32 Y0 = static_cast<UInt32>(Max(floorf(Minimum.GetY()), 0.0f));
+            const UInt32 X1 = Min<UInt32>(ceilf(Maximum.GetX()), Resolution - 1);
+            const UInt32 Y1 = Min<UInt32>(ceilf(Maximum.GetY()), Resolution - 1);
+
+            ConstRef<Vector3f> P0 = Positions[Indices[Triangle * 3]];
+            ConstRef<Vector3f> P1 = Positions[Indices[Triangle * 3 + 1]];
+            ConstRef<Vector3f> P2 = Positions[Indices[Triangle * 3 + 2]];
+            ConstRef<Vector3f> N0 = Normals[Indices[Triangle * 3]];
+            ConstRef<Vector3f> N1 = Normals[Indices[Triangle * 3 + 1]];
+            ConstRef<Vector3f> N2 = Normals[Indices[Triangle * 3 + 2]];
+
+            for (UInt32 Y = Y0; Y <= Y1; ++Y)
+            {
+                for (UInt32 X = X0; X <= X1; ++X)
+                {
+                    const Vector2f Center(X + 0.5f, Y + 0.5f);
+
+                    const Real32 W0 = Vector2f::Cross(T1 - Center, T2 - Center) / Area;
+                    const Real32 W1 = Vector2f::Cross(T2 - Center, T0 - Center) / Area;
+                    const Real32 W2 = 1.0f - W0 - W1;
+
+                    if (W0 < k_Tolerance || W1 < k_Tolerance || W2 < k_Tolerance)
+                    {
+                        continue;
+                    }
+
+                    Ref<Texel> Texel = mTexels[Y * Resolution + X];
+                    Texel.Position = P0 * W0 + P1 * W1 + P2 * W2;
+                    Texel.Normal   = Vector3f::Normalize(N0 * W0 + N1 * W1 + N2 * W2);
+                    Texel.Valid    = true;
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tracer::Trace()
+    {
+        const UInt32 Resolution = mAtlas.GetResolution();
+
+        mIrradiance.assign(Resolution * Resolution, Vector3f(0.0f, 0.0f, 0.0f));
+
+        // Rows are handed out one at a time, each texel seeds its own generator from its index so the result
+        // is the same no matter how many cores the machine has or in which order the rows are finished.
+        Parallel(Resolution, [this, Resolution](UInt32 Row)
+        {
+            for (UInt32 Column = 0; Column < Resolution; ++Column)
+            {
+                const UInt32    Index = Row * Resolution + Column;
+                ConstRef<Texel> Texel = mTexels[Index];
+
+                if (!Texel.Valid)
+                {
+                    continue;
+                }
+
+                const Vector3f Origin = Texel.Position + Texel.Normal * mBias;
+                Random         Generator(Index);
+                Vector3f       Indirect(0.0f, 0.0f, 0.0f);
+
+                for (UInt32 Sample = 0; Sample < mProperties.Samples; ++Sample)
+                {
+                    Indirect += GetIndirect(Origin, Texel.Normal, Generator);
+                }
+                const Real32 Weight = 1.0f / Max<UInt32>(mProperties.Samples, 1);
+                mIrradiance[Index]  = GetDirect(Origin, Texel.Normal) + Indirect * Weight;
+            }
+        });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tracer::Occlude()
+    {
+        ConstRef<Vector<Vector3f>> Positions = mScene.GetPositions();
+        ConstRef<Vector<Vector3f>> Normals   = mScene.GetNormals();
+        const Real32               Distance  = mProperties.Radius * mScene.GetExtent();
+
+        mOcclusion.assign(Positions.size(), 1.0f);
+
+        // Ambient occlusion is the fraction of short cosine weighted rays that escape, which is what the vertex
+        // stream needs to darken creases on models that don't get a lightmap of their own.
+        Parallel(Positions.size(), [&](UInt32 Vertex)
+        {
+            const Vector3f Origin = Positions[Vertex] + Normals[Vertex] * mBias;
+            Random         Generator(Vertex ^ 0x9E3779B9u);
+            UInt32         Escaped = 0;
+
+            for (UInt32 Sample = 0; Sample < mProperties.Occlusion; ++Sample)
+            {
+                const Scene::Ray Ray { Origin, GetHemisphere(Normals[Vertex], Generator), Distance };
+                Escaped += (mScene.Occluded(Ray) ? 0 : 1);
+            }
+            mOcclusion[Vertex] = static_cast<Real32>(Escaped) / Max<UInt32>(mProperties.Occlusion, 1);
+        });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Tracer::Random::Random(UInt32 Seed)
+    {
+        // Wang hash, consecutive seeds must not produce correlated sequences.
+        Seed  = (Seed ^ 61u) ^ (Seed >> 16);
+        Seed *= 9u;
+        Seed ^= Seed >> 4;
+        Seed *= 0x27D4EB2Du;
+        Seed ^= Seed >> 15;
+
+        State = (Seed != 0 ? Seed : 1);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Real32 Tracer::Random::Next()
+    {
+        State ^= State << 13;
+        State ^= State >> 17;
+        State ^= State << 5;
+
+        return static_cast<Real32>(State >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector3f Tracer::GetDirect(ConstRef<Vector3f> Position, ConstRef<Vector3f> Normal) const
+    {
+        const Real32 Incidence = Normal.Dot(mProperties.Direction);
+
+        if (Incidence <= 0.0f)
+        {
+            return Vector3f(0.0f, 0.0f, 0.0f);
+        }
+
+        const Scene::Ray Ray { Position, mProperties.Direction, FLT_MAX };
+        return (mScene.Occluded(Ray) ? Vector3f(0.0f, 0.0f, 0.0f) : mProperties.Sun * Incidence);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector3f Tracer::GetIndirect(ConstRef<Vector3f> Position, ConstRef<Vector3f> Normal, Ref<Random> Random) const
+    {
+        Vector3f Radiance(0.0f, 0.0f, 0.0f);
+        Real32   Throughput = 1.0f;
+        Vector3f Origin     = Position;
+        Vector3f Surface    = Normal;
+
+        // Every surface is treated as a grey lambertian, cosine weighted sampling cancels both the cosine and
+        // the pdf so each path only carries the albedo of the surfaces it bounced on. The sun is gathered
+        // explicitly at every vertex of the path instead of waiting for a path to hit it by chance.
+        for (UInt32 Bounce = 0; Bounce <= mProperties.Bounces; ++Bounce)
+        {
+            Scene::Ray Ray { Origin, GetHemisphere(Surface, Random), FLT_MAX };
+            Scene::Hit Hit;
+
+            if (!mScene.Intersect(Ray, Hit))
+            {
+                Radiance += mProperties.Sky * Throughput;
+                break;
+            }
+
+            if (Bounce == mProperties.Bounces)
+            {
+                break;
+            }
+
+            Surface = mScene.GetNormal(Hit);
+
+            if (Surface.Dot(Ray.Direction) > 0.0f)
+            {
+                Surface = -Surface;
+            }
+
+            Origin      = Ray.Origin + Ray.Direction * Ray.Distance + Surface * mBias;
+            Throughput *= mProperties.Albedo;
+            Radiance   += GetDirect(Origin, Surface) * Throughput;
+        }
+        return Radiance;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector3f Tracer::GetHemisphere(ConstRef<Vector3f> Normal, Ref<Random> Random)
+    {
+        const Real32 Angle  = 2.0f * k_PI * Random.Next();
+        const Real32 Length = Random.Next();
+        const Real32 Radius = sqrtf(Length);
+
+        const Vector3f Up
+            = (Abs(Normal.GetX()) > 0.9f ? Vector3f(0.0f, 1.0f, 0.0f) : Vector3f(1.0f, 0.0f, 0.0f));
+        const Vector3f Tangent   = Vector3f::Normalize(Vector3f::Cross(Up, Normal));
+        const Vector3f Bitangent = Vector3f::Cross(Normal, Tangent);
+
+        return Tangent   * (Radius * Cosine(Angle))
+             + Bitangent * (Radius * Sine(Angle))
+             + Normal    * sqrtf(Max(1.0f - Length, 0.0f));
+    }
+}
\ No newline at end of file
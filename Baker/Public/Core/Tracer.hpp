@@ -0,0 +1,142 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Atlas.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Baker
+{
+    // -=(Undocumented)=-
+    class Tracer final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        struct Properties
+        {
+            // -=(Undocumented)=-
+            UInt32   Samples    = 256;
+
+            // -=(Undocumented)=-
+            UInt32   Bounces    = 2;
+
+            // -=(Undocumented)=-
+            Real32   Albedo     = 0.6f;
+
+            // -=(Undocumented)=-
+            Vector3f Sky        = Vector3f(0.35f, 0.45f, 0.60f);
+
+            // -=(Undocumented)=-
+            Vector3f Sun        = Vector3f(2.50f, 2.35f, 2.10f);
+
+            // -=(Undocumented)=-
+            Vector3f Direction  = Vector3f(0.40f, 0.80f, 0.45f);
+
+            // -=(Undocumented)=-
+            UInt32   Occlusion  = 64;
+
+            // -=(Undocumented)=-
+            Real32   Radius     = 0.1f;
+        };
+
+        // -=(Undocumented)=-
+        struct Texel
+        {
+            // -=(Undocumented)=-
+            Vector3f Position;
+
+            // -=(Undocumented)=-
+            Vector3f Normal;
+
+            // -=(Undocumented)=-
+            Bool     Valid = false;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        Tracer(ConstRef<Scene> Scene, ConstRef<Atlas> Atlas, ConstRef<Properties> Properties);
+
+        // -=(Undocumented)=-
+        void Rasterize();
+
+        // -=(Undocumented)=-
+        void Trace();
+
+        // -=(Undocumented)=-
+        void Occlude();
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Texel>> GetTexels() const
+        {
+            return mTexels;
+        }
+
+        // -=(Undocumented)=-
+        Ref<Vector<Vector3f>> GetIrradiance()
+        {
+            return mIrradiance;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Real32>> GetOcclusion() const
+        {
+            return mOcclusion;
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Random
+        {
+            // -=(Undocumented)=-
+            explicit Random(UInt32 Seed);
+
+            // -=(Undocumented)=-
+            Real32 Next();
+
+            // -=(Undocumented)=-
+            UInt32 State;
+        };
+
+        // -=(Undocumented)=-
+        Vector3f GetDirect(ConstRef<Vector3f> Position, ConstRef<Vector3f> Normal) const;
+
+        // -=(Undocumented)=-
+        Vector3f GetIndirect(ConstRef<Vector3f> Position, ConstRef<Vector3f> Normal, Ref<Random> Random) const;
+
+        // -=(Undocumented)=-
+        static Vector3f GetHemisphere(ConstRef<Vector3f> Normal, Ref<Random> Random);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        ConstRef<Scene>  mScene;
+        ConstRef<Atlas>  mAtlas;
+        Properties       mProperties;
+        Real32           mBias;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Texel>    mTexels;
+        Vector<Vector3f> mIrradiance;
+        Vector<Real32>   mOcclusion;
+    };
+}
\ No newline at end of file
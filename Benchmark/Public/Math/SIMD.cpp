@@ -0,0 +1,280 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Matrix4.hpp"
+#include "Aurora.Math/Quaternion.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Benchmark
+{
+    // -=(Undocumented)=-
+    static constexpr UInt32 k_Count  = 1024;
+
+    // -=(Undocumented)=-
+    static constexpr UInt32 k_Rounds = 256;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Real32 Random(Ref<UInt32> Seed)
+    {
+        Seed = Seed * 1664525u + 1013904223u;
+        return static_cast<Real32>(Seed >> 8) / static_cast<Real32>(1u << 24) * 2.0f - 1.0f;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Matrix4f Compose(ConstRef<Array<Real32, 16>> Components)
+    {
+        ConstRef<Array<Real32, 16>> C = Components;
+
+        return Matrix4f(
+            C[0],  C[1],  C[2],  C[3],
+            C[4],  C[5],  C[6],  C[7],
+            C[8],  C[9],  C[10], C[11],
+            C[12], C[13], C[14], C[15]);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Matrix4f Multiply(ConstRef<Matrix4f> First, ConstRef<Matrix4f> Second)
+    {
+        Array<Real32, 16> Result { };
+
+        for (UInt32 Column = 0; Column < 4; ++Column)
+        {
+            for (UInt32 Row = 0; Row < 4; ++Row)
+            {
+                for (UInt32 Index = 0; Index < 4; ++Index)
+                {
+                    Result[Column * 4 + Row] += First[Index * 4 + Row] * Second[Column * 4 + Index];
+                }
+            }
+        }
+        return Compose(Result);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Vector4f Transform(ConstRef<Matrix4f> Matrix, ConstRef<Vector4f> Vector)
+    {
+        const Array<Real32, 4> Input { Vector.GetX(), Vector.GetY(), Vector.GetZ(), Vector.GetW() };
+        Array<Real32, 4>       Result { };
+
+        for (UInt32 Row = 0; Row < 4; ++Row)
+        {
+            for (UInt32 Index = 0; Index < 4; ++Index)
+            {
+                Result[Row] += Matrix[Index * 4 + Row] * Input[Index];
+            }
+        }
+        return Vector4f(Result[0], Result[1], Result[2], Result[3]);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Matrix4f Invert(ConstRef<Matrix4f> Matrix)
+    {
+        // Cofactors from the 2x2 minors of the top and bottom row pairs.
+        const auto A = [&](UInt32 Row, UInt32 Column) { return Matrix[Column * 4 + Row]; };
+
+        const Real32 S0 = A(0, 0) * A(1, 1) - A(1, 0) * A(0, 1);
+        const Real32 S1 = A(0, 0) * A(1, 2) - A(1, 0) * A(0, 2);
+        const Real32 S2 = A(0, 0) * A(1, 3) - A(1, 0) * A(0, 3);
+        const Real32 S3 = A(0, 1) * A(1, 2) - A(1, 1) * A(0, 2);
+        const Real32 S4 = A(0, 1) * A(1, 3) - A(1, 1) * A(0, 3);
+        const Real32 S5 = A(0, 2) * A(1, 3) - A(1, 2) * A(0, 3);
+
+        const Real32 C5 = A(2, 2) * A(3, 3) - A(3, 2) * A(2, 3);
+        const Real32 C4 = A(2, 1) * A(3, 3) - A(3, 1) * A(2, 3);
+        const Real32 C3 = A(2, 1) * A(3, 2) - A(3, 1) * A(2, 2);
+        const Real32 C2 = A(2, 0) * A(3, 3) - A(3, 0) * A(2, 3);
+        const Real32 C1 = A(2, 0) * A(3, 2) - A(3, 0) * A(2, 2);
+        const Real32 C0 = A(2, 0) * A(3, 1) - A(3, 0) * A(2, 1);
+
+        const Real32 Determinant = S0 * C5 - S1 * C4 + S2 * C3 + S3 * C2 - S4 * C1 + S5 * C0;
+
+        if (Determinant == 0.0f)
+        {
+            return Matrix4f();
+        }
+
+        const Real32 I = 1.0f / Determinant;
+
+        Array<Real32, 16> B;
+        B[0]  = ( A(1, 1) * C5 - A(1, 2) * C4 + A(1, 3) * C3) * I;
+        B[4]  = (-A(0, 1) * C5 + A(0, 2) * C4 - A(0, 3) * C3) * I;
+        B[8]  = ( A(3, 1) * S5 - A(3, 2) * S4 + A(3, 3) * S3) * I;
+        B[12] = (-A(2, 1) * S5 + A(2, 2) * S4 - A(2, 3) * S3) * I;
+        B[1]  = (-A(1, 0) * C5 + A(1, 2) * C2 - A(1, 3) * C1) * I;
+        B[5]  = ( A(0, 0) * C5 - A(0, 2) * C2 + A(0, 3) * C1) * I;
+        B[9]  = (-A(3, 0) * S5 + A(3, 2) * S2 - A(3, 3) * S1) * I;
+        B[13] = ( A(2, 0) * S5 - A(2, 2) * S2 + A(2, 3) * S1) * I;
+        B[2]  = ( A(1, 0) * C4 - A(1, 1) * C2 + A(1, 3) * C0) * I;
+        B[6]  = (-A(0, 0) * C4 + A(0, 1) * C2 - A(0, 3) * C0) * I;
+        B[10] = ( A(3, 0) * S4 - A(3, 1) * S2 + A(3, 3) * S0) * I;
+        B[14] = (-A(2, 0) * S4 + A(2, 1) * S2 - A(2, 3) * S0) * I;
+        B[3]  = (-A(1, 0) * C3 + A(1, 1) * C1 - A(1, 2) * C0) * I;
+        B[7]  = ( A(0, 0) * C3 - A(0, 1) * C1 + A(0, 2) * C0) * I;
+        B[11] = (-A(3, 0) * S3 + A(3, 1) * S1 - A(3, 2) * S0) * I;
+        B[15] = ( A(2, 0) * S3 - A(2, 1) * S1 + A(2, 2) * S0) * I;
+        return Compose(B);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Quaternionf Concatenate(ConstRef<Quaternionf> First, ConstRef<Quaternionf> Second)
+    {
+        const Real32 X1 = First.GetX(),  Y1 = First.GetY(),  Z1 = First.GetZ(),  W1 = First.GetW();
+        const Real32 X2 = Second.GetX(), Y2 = Second.GetY(), Z2 = Second.GetZ(), W2 = Second.GetW();
+
+        return Quaternionf(
+            W1 * X2 + X1 * W2 + Y1 * Z2 - Z1 * Y2,
+            W1 * Y2 + Y1 * W2 + Z1 * X2 - X1 * Z2,
+            W1 * Z2 + Z1 * W2 + X1 * Y2 - Y1 * X2,
+            W1 * W2 - X1 * X2 - Y1 * Y2 - Z1 * Z2);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool IsClose(CPtr<const Real32> Expected, CPtr<const Real32> Actual)
+    {
+        for (UInt32 Index = 0; Index < Expected.size(); ++Index)
+        {
+            if (Abs(Expected[Index] - Actual[Index]) > 1.0e-3f * Max(1.0f, Abs(Expected[Index])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Type, typename Function>
+    static Real64 Measure(Ref<Vector<Type>> Output, Function Callback)
+    {
+        const UInt64 Start = SDL_GetTicksNS();
+
+        for (UInt32 Round = 0; Round < k_Rounds; ++Round)
+        {
+            for (UInt32 Index = 0; Index < k_Count; ++Index)
+            {
+                Output[Index] = Callback(Index);
+            }
+        }
+        return static_cast<Real64>(SDL_GetTicksNS() - Start) / (k_Rounds * k_Count);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Type, typename Scalar, typename Vectorized>
+    static Bool Run(CStr Name, Scalar OnScalar, Vectorized OnVectorized)
+    {
+        Vector<Type> Expected(k_Count);
+        Vector<Type> Actual(k_Count);
+
+        const Real64 ScalarTime     = Measure(Expected, OnScalar);
+        const Real64 VectorizedTime = Measure(Actual, OnVectorized);
+
+        Log::Info("Benchmark: {:<24} scalar {:7.2f} ns, SIMD {:7.2f} ns ({:.2f}x)",
+            Name, ScalarTime, VectorizedTime, ScalarTime / VectorizedTime);
+
+        const auto AsComponents = [](ConstRef<Type> Value)
+        {
+            const Ptr<const Real32> Components = reinterpret_cast<Ptr<const Real32>>(AddressOf(Value));
+            return CPtr<const Real32>(Components, sizeof(Type) / sizeof(Real32));
+        };
+
+        for (UInt32 Index = 0; Index < k_Count; ++Index)
+        {
+            if (!IsClose(AsComponents(Expected[Index]), AsComponents(Actual[Index])))
+            {
+                Log::Error("Benchmark: {} differs between the scalar and SIMD paths at element {}", Name, Index);
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+int main(int Argc, Ptr<Char> Argv[])
+{
+    Log::Initialize("Aurora.Benchmark.log");
+
+#ifndef   AURORA_SIMD
+    Log::Warn("Benchmark: No SIMD backend on this target, both paths are scalar");
+#endif // AURORA_SIMD
+
+    // Diagonally dominant matrices keep the inverses well conditioned, so both paths are expected to agree.
+    UInt32 Seed = 1;
+
+    Vector<Matrix4f>    Matrices(Benchmark::k_Count);
+    Vector<Vector4f>    Vectors(Benchmark::k_Count);
+    Vector<Quaternionf> Quaternions(Benchmark::k_Count);
+
+    for (UInt32 Index = 0; Index < Benchmark::k_Count; ++Index)
+    {
+        Array<Real32, 16> Components;
+
+        for (UInt32 Component = 0; Component < 16; ++Component)
+        {
+            Components[Component] = Benchmark::Random(Seed) + (Component % 5 == 0 ? 4.0f : 0.0f);
+        }
+        Matrices[Index] = Benchmark::Compose(Components);
+
+        Vectors[Index] = Vector4f(
+            Benchmark::Random(Seed), Benchmark::Random(Seed), Benchmark::Random(Seed), Benchmark::Random(Seed));
+        Quaternions[Index] = Quaternionf(
+            Benchmark::Random(Seed), Benchmark::Random(Seed), Benchmark::Random(Seed), Benchmark::Random(Seed));
+    }
+
+    const auto Next = [](UInt32 Index)
+    {
+        return (Index + 1) % Benchmark::k_Count;
+    };
+
+    Bool Successful = true;
+
+    Successful &= Benchmark::Run<Matrix4f>("Matrix4 * Matrix4",
+        [&](UInt32 Index) { return Benchmark::Multiply(Matrices[Index], Matrices[Next(Index)]); },
+        [&](UInt32 Index) { return Matrices[Index] * Matrices[Next(Index)]; });
+
+    Successful &= Benchmark::Run<Vector4f>("Matrix4 * Vector4",
+        [&](UInt32 Index) { return Benchmark::Transform(Matrices[Index], Vectors[Index]); },
+        [&](UInt32 Index) { return Matrices[Index] * Vectors[Index]; });
+
+    Successful &= Benchmark::Run<Matrix4f>("Matrix4::Inverse",
+        [&](UInt32 Index) { return Benchmark::Invert(Matrices[Index]); },
+        [&](UInt32 Index) { return Matrices[Index].Inverse(); });
+
+    Successful &= Benchmark::Run<Quaternionf>("Quaternion * Quaternion",
+        [&](UInt32 Index) { return Benchmark::Concatenate(Quaternions[Index], Quaternions[Next(Index)]); },
+        [&](UInt32 Index) { return Quaternions[Index] * Quaternions[Next(Index)]; });
+
+    Log::Shutdown();
+    return (Successful ? 0 : 1);
+}
\ No newline at end of file
@@ -0,0 +1,476 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Batcher.hpp"
+#include "Quantizer.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void MeshBatcher::Add(ConstSPtr<Graphic::Pipeline> Pipeline, ConstSPtr<Graphic::Model> Model, ConstRef<Matrix4f> Transform)
+    {
+        ConstSPtr<Graphic::Mesh> Mesh = Model->GetMesh();
+
+        // The vertices are needed on the CPU, which only readable model(s) keep after being created.
+        if (!Mesh || !Mesh->GetBytes(Graphic::Usage::Vertex).HasData())
+        {
+            Log::Warn("MeshBatcher: '{}' is not readable, skipping", Model->GetKey().GetUrl());
+            return;
+        }
+
+        for (UInt8 ID = 0; ConstRef<Graphic::Mesh::Primitive> Primitive : Mesh->GetPrimitives())
+        {
+            const UInt8 Slot = ID++;
+
+            ConstRef<Graphic::Mesh::Attribute> Position = Primitive.GetAttribute(Graphic::VertexSemantic::Position);
+
+            const UInt32 Vertices = (Position.Stride > 0 ? Position.Length / Position.Stride : 0);
+            const Bool   Decodable = (Position.Format == Graphic::VertexFormat::UIntNorm16x4
+                                   || Position.Format == Graphic::VertexFormat::Float32x3);
+
+            if (Vertices == 0 || Vertices > k_MaxVertices || !Decodable)
+            {
+                Log::Warn("MeshBatcher: Unsupported primitive {} of '{}', skipping", Slot, Model->GetKey().GetUrl());
+                continue;
+            }
+
+            Instance Instance;
+            Instance.Pipeline  = Pipeline;
+            Instance.Material  = (Primitive.Material >= 0 ? Model->GetMaterial(Primitive.Material) : nullptr);
+            Instance.Mesh      = Mesh;
+            Instance.Primitive = Slot;
+            Instance.Vertices  = Vertices;
+            Instance.Order     = 0;
+            Instance.Transform = Transform;
+            mInstances.emplace_back(Move(Instance));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector<MeshBatcher::Batch> MeshBatcher::Bake(ConstRef<Uri> Key)
+    {
+        Vector<Batch> Batches;
+
+        if (mInstances.empty())
+        {
+            return Batches;
+        }
+
+        // Order the instance(s) along a morton curve of their world center(s), so the chunk(s) cut from
+        // each group are spatially compact and their bound(s) are tight enough to be culled.
+        Vector<Vector3f> Centers(mInstances.size());
+
+        for (UInt32 ID = 0; ID < mInstances.size(); ++ID)
+        {
+            ConstRef<Instance> Instance = mInstances[ID];
+            Centers[ID] = Instance.Transform * Instance.Mesh->GetPrimitive(Instance.Primitive).GetCenter();
+        }
+
+        Vector3f Minimum = Centers[0];
+        Vector3f Maximum = Centers[0];
+
+        for (ConstRef<Vector3f> Center : Centers)
+        {
+            Minimum = Vector3f::Min(Minimum, Center);
+            Maximum = Vector3f::Max(Maximum, Center);
+        }
+
+        const auto Spread = [](Real32 Value)
+        {
+            UInt32 Bits = static_cast<UInt32>(Clamp(Value, 0.0f, 1.0f) * 1023.0f);
+            Bits = (Bits | (Bits << 16)) & 0x030000FF;
+            Bits = (Bits | (Bits << 8))  & 0x0300F00F;
+            Bits = (Bits | (Bits << 4))  & 0x030C30C3;
+            Bits = (Bits | (Bits << 2))  & 0x09249249;
+            return Bits;
+        };
+
+        const Vector3f Extent = Maximum - Minimum;
+
+        for (UInt32 ID = 0; ID < mInstances.size(); ++ID)
+        {
+            const Vector3f Offset = Centers[ID] - Minimum;
+
+            mInstances[ID].Order =
+                  Spread(Extent.GetX() > 0.0f ? Offset.GetX() / Extent.GetX() : 0.0f)
+                | Spread(Extent.GetY() > 0.0f ? Offset.GetY() / Extent.GetY() : 0.0f) << 1
+                | Spread(Extent.GetZ() > 0.0f ? Offset.GetZ() / Extent.GetZ() : 0.0f) << 2;
+        }
+
+        // Group the instance(s) that can be drawn together, then by their position on the curve.
+        Sort(mInstances, [](ConstRef<Instance> First, ConstRef<Instance> Second)
+        {
+            if (First.Pipeline != Second.Pipeline)
+            {
+                return First.Pipeline.get() < Second.Pipeline.get();
+            }
+            if (First.Material != Second.Material)
+            {
+                return First.Material.get() < Second.Material.get();
+            }
+
+            ConstRef<Graphic::Mesh::Primitive> P0 = First.Mesh->GetPrimitive(First.Primitive);
+            ConstRef<Graphic::Mesh::Primitive> P1 = Second.Mesh->GetPrimitive(Second.Primitive);
+
+            for (UInt32 Semantic = 0; Semantic < Graphic::k_MaxAttributes; ++Semantic)
+            {
+                const SInt32 F0 = (P0.Attributes[Semantic].Length > 0 ? CastEnum(P0.Attributes[Semantic].Format) : -1);
+                const SInt32 F1 = (P1.Attributes[Semantic].Length > 0 ? CastEnum(P1.Attributes[Semantic].Format) : -1);
+
+                if (F0 != F1)
+                {
+                    return F0 < F1;
+                }
+            }
+            return First.Order < Second.Order;
+        });
+
+        // Cut each group into chunk(s) addressable with 16-bit indices, up to one mesh worth of chunk(s) per batch.
+        UInt32 Chunks = 0;
+
+        for (UInt32 First = 0; First < mInstances.size();)
+        {
+            UInt32 Last = First + 1;
+
+            while (Last < mInstances.size() && IsCompatible(mInstances[First], mInstances[Last]))
+            {
+                ++Last;
+            }
+
+            Builder Builder;
+
+            for (UInt32 Start = First; Start < Last;)
+            {
+                UInt32 End      = Start;
+                UInt32 Vertices = 0;
+
+                while (End < Last && Vertices + mInstances[End].Vertices <= k_MaxVertices)
+                {
+                    Vertices += mInstances[End++].Vertices;
+                }
+
+                Merge(CPtr<const Instance>(mInstances.data() + Start, End - Start), Builder);
+                ++Chunks;
+
+                if (Builder.Primitives.size() == Graphic::Mesh::k_MaxPrimitives)
+                {
+                    Flush(Key, mInstances[First], Builder, Batches);
+                }
+                Start = End;
+            }
+
+            if (!Builder.Primitives.empty())
+            {
+                Flush(Key, mInstances[First], Builder, Batches);
+            }
+            First = Last;
+        }
+
+        Log::Info("MeshBatcher: Baked '{}' from {} instance(s) into {} batch(es) and {} chunk(s)",
+            Key.GetUrl(), mInstances.size(), Batches.size(), Chunks);
+        return Batches;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool MeshBatcher::IsCompatible(ConstRef<Instance> First, ConstRef<Instance> Second)
+    {
+        if (First.Pipeline != Second.Pipeline || First.Material != Second.Material)
+        {
+            return false;
+        }
+
+        ConstRef<Graphic::Mesh::Primitive> P0 = First.Mesh->GetPrimitive(First.Primitive);
+        ConstRef<Graphic::Mesh::Primitive> P1 = Second.Mesh->GetPrimitive(Second.Primitive);
+
+        for (UInt32 Semantic = 0; Semantic < Graphic::k_MaxAttributes; ++Semantic)
+        {
+            ConstRef<Graphic::Mesh::Attribute> A0 = P0.Attributes[Semantic];
+            ConstRef<Graphic::Mesh::Attribute> A1 = P1.Attributes[Semantic];
+
+            if ((A0.Length > 0) != (A1.Length > 0) || (A0.Length > 0 && A0.Format != A1.Format))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool MeshBatcher::IsMirrored(ConstRef<Matrix4f> Transform)
+    {
+        return Vector3f::Cross(Transform.GetRight(), Transform.GetUp()).Dot(Transform.GetForward()) < 0.0f;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void MeshBatcher::Merge(CPtr<const Instance> Instances, Ref<Builder> Output)
+    {
+        ConstRef<Graphic::Mesh::Primitive> Layout = Instances[0].Mesh->GetPrimitive(Instances[0].Primitive);
+
+        // Transform every position into world space first, the chunk bound(s) are needed to quantize them.
+        Vector<Vector3f> Positions;
+
+        for (ConstRef<Instance> Instance : Instances)
+        {
+            ConstRef<Graphic::Mesh::Primitive> Source    = Instance.Mesh->GetPrimitive(Instance.Primitive);
+            ConstRef<Graphic::Mesh::Attribute> Attribute = Source.GetAttribute(Graphic::VertexSemantic::Position);
+
+            const Ptr<const UInt8> Input
+                = Instance.Mesh->GetBytes(Graphic::Usage::Vertex).GetData<UInt8>() + Attribute.Offset;
+
+            for (UInt32 Vertex = 0; Vertex < Instance.Vertices; ++Vertex)
+            {
+                Vector3f Position;
+
+                if (Attribute.Format == Graphic::VertexFormat::UIntNorm16x4)
+                {
+                    Array<UInt16, 4> Encoded;
+                    memcpy(Encoded.data(), Input + Vertex * Attribute.Stride, sizeof(Encoded));
+                    Position = MeshQuantizer::DecodePosition(Encoded, Source.Minimum, Source.Maximum);
+                }
+                else
+                {
+                    memcpy(AddressOf(Position), Input + Vertex * Attribute.Stride, sizeof(Vector3f));
+                }
+                Positions.emplace_back(Instance.Transform * Position);
+            }
+        }
+
+        Graphic::Mesh::Primitive Primitive;
+        Primitive.Material = 0;
+        Primitive.Minimum  = Positions[0];
+        Primitive.Maximum  = Positions[0];
+
+        for (ConstRef<Vector3f> Position : Positions)
+        {
+            Primitive.Minimum = Vector3f::Min(Primitive.Minimum, Position);
+            Primitive.Maximum = Vector3f::Max(Primitive.Maximum, Position);
+        }
+
+        // Re-encode each attribute stream in its original format, normal(s) and tangent(s) are rotated
+        // into world space while anything else is copied as-is.
+        for (UInt32 Semantic = 0; Semantic < Graphic::k_MaxAttributes; ++Semantic)
+        {
+            if (Layout.Attributes[Semantic].Length == 0)
+            {
+                continue;
+            }
+
+            Ref<Graphic::Mesh::Attribute> Target = Primitive.Attributes[Semantic];
+            Target.Format = Layout.Attributes[Semantic].Format;
+            Target.Stride = Layout.Attributes[Semantic].Stride;
+            Target.Offset = Align(Output.Vertices.size(), sizeof(UInt32));
+            Target.Length = Target.Stride * Positions.size();
+            Output.Vertices.resize(Target.Offset + Target.Length, 0);
+
+            for (UInt32 Vertex = 0; ConstRef<Instance> Instance : Instances)
+            {
+                ConstRef<Graphic::Mesh::Attribute> Attribute
+                    = Instance.Mesh->GetPrimitive(Instance.Primitive).Attributes[Semantic];
+
+                const Ptr<const UInt8> Input
+                    = Instance.Mesh->GetBytes(Graphic::Usage::Vertex).GetData<UInt8>() + Attribute.Offset;
+                const Matrix4f         Normal
+                    = Matrix4f::Transpose(Instance.Transform.Inverse());
+
+                const Real32           Handed
+                    = (IsMirrored(Instance.Transform) ? -1.0f : 1.0f);
+
+                const auto Rotate = [](ConstRef<Matrix4f> Matrix, ConstRef<Vector3f> Direction)
+                {
+                    const Vector4f Result = Matrix * Vector4f(Direction.GetX(), Direction.GetY(), Direction.GetZ(), 0.0f);
+                    return Vector3f::Normalize(Vector3f(Result.GetX(), Result.GetY(), Result.GetZ()));
+                };
+
+                for (UInt32 Element = 0; Element < Instance.Vertices; ++Element, ++Vertex)
+                {
+                    const Ptr<const UInt8> Source      = Input + Element * Attribute.Stride;
+                    const Ptr<UInt8>       Destination = Output.Vertices.data() + Target.Offset + Vertex * Target.Stride;
+
+                    switch (static_cast<Graphic::VertexSemantic>(Semantic))
+                    {
+                    case Graphic::VertexSemantic::Position:
+                        if (Target.Format == Graphic::VertexFormat::UIntNorm16x4)
+                        {
+                            const Array<UInt16, 4> Encoded
+                                = MeshQuantizer::EncodePosition(Positions[Vertex], Primitive.Minimum, Primitive.Maximum);
+                            memcpy(Destination, Encoded.data(), sizeof(Encoded));
+                        }
+                        else
+                        {
+                            memcpy(Destination, AddressOf(Positions[Vertex]), sizeof(Vector3f));
+                        }
+                        break;
+                    case Graphic::VertexSemantic::Normal:
+                        if (Target.Format == Graphic::VertexFormat::SIntNorm16x2)
+                        {
+                            Array<SInt16, 2> Encoded;
+                            memcpy(Encoded.data(), Source, sizeof(Encoded));
+
+                            Encoded = MeshQuantizer::EncodeOctahedral(Rotate(Normal, MeshQuantizer::DecodeOctahedral(Encoded)));
+                            memcpy(Destination, Encoded.data(), sizeof(Encoded));
+                        }
+                        else if (Target.Format == Graphic::VertexFormat::Float32x3)
+                        {
+                            Vector3f Direction;
+                            memcpy(AddressOf(Direction), Source, sizeof(Vector3f));
+
+                            Direction = Rotate(Normal, Direction);
+                            memcpy(Destination, AddressOf(Direction), sizeof(Vector3f));
+                        }
+                        else
+                        {
+                            memcpy(Destination, Source, Min(Attribute.Stride, Target.Stride));
+                        }
+                        break;
+                    case Graphic::VertexSemantic::Tangent:
+                        if (Target.Format == Graphic::VertexFormat::SIntNorm16x4)
+                        {
+                            Array<SInt16, 4> Encoded;
+                            memcpy(Encoded.data(), Source, sizeof(Encoded));
+
+                            const Vector3f Direction = Rotate(Instance.Transform, Vector3f(
+                                MeshQuantizer::DecodeSNorm16(Encoded[0]),
+                                MeshQuantizer::DecodeSNorm16(Encoded[1]),
+                                MeshQuantizer::DecodeSNorm16(Encoded[2])));
+
+                            Encoded = {
+                                MeshQuantizer::EncodeSNorm16(Direction.GetX()),
+                                MeshQuantizer::EncodeSNorm16(Direction.GetY()),
+                                MeshQuantizer::EncodeSNorm16(Direction.GetZ()),
+                                MeshQuantizer::EncodeSNorm16(MeshQuantizer::DecodeSNorm16(Encoded[3]) * Handed)
+                            };
+                            memcpy(Destination, Encoded.data(), sizeof(Encoded));
+                        }
+                        else if (Target.Format == Graphic::VertexFormat::Float32x4)
+                        {
+                            Array<Real32, 4> Value;
+                            memcpy(Value.data(), Source, sizeof(Value));
+
+                            const Vector3f Direction = Rotate(Instance.Transform, Vector3f(Value[0], Value[1], Value[2]));
+
+                            Value = { Direction.GetX(), Direction.GetY(), Direction.GetZ(), Value[3] * Handed };
+                            memcpy(Destination, Value.data(), sizeof(Value));
+                        }
+                        else
+                        {
+                            memcpy(Destination, Source, Min(Attribute.Stride, Target.Stride));
+                        }
+                        break;
+                    default:
+                        memcpy(Destination, Source, Min(Attribute.Stride, Target.Stride));
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Rebase the indices of each instance onto the chunk, mirrored transform(s) also flip the winding.
+        const UInt32 Offset = Align(Output.Indices.size(), sizeof(UInt32));
+        UInt32       Base   = 0;
+
+        Vector<UInt16> Elements;
+
+        for (ConstRef<Instance> Instance : Instances)
+        {
+            ConstRef<Graphic::Mesh::Attribute> Indices = Instance.Mesh->GetPrimitive(Instance.Primitive).Indices;
+
+            const Ptr<const UInt8> Input
+                = Instance.Mesh->GetBytes(Graphic::Usage::Index).GetData<UInt8>() + Indices.Offset;
+            const UInt32           Count
+                = (Indices.Stride > 0 && Indices.Length > 0 ? Indices.Length / Indices.Stride : Instance.Vertices);
+
+            for (UInt32 Element = 0; Element < Count; ++Element)
+            {
+                UInt32 Index = Element;
+
+                if (Indices.Length > 0)
+                {
+                    switch (Indices.Stride)
+                    {
+                    case sizeof(UInt8):
+                        Index = Input[Element];
+                        break;
+                    case sizeof(UInt16):
+                        Index = reinterpret_cast<Ptr<const UInt16>>(Input)[Element];
+                        break;
+                    default:
+                        Index = reinterpret_cast<Ptr<const UInt32>>(Input)[Element];
+                        break;
+                    }
+                }
+                Elements.push_back(static_cast<UInt16>(Base + Index));
+            }
+
+            if (IsMirrored(Instance.Transform))
+            {
+                for (UInt32 Triangle = Elements.size() - Count; Triangle + 2 < Elements.size(); Triangle += 3)
+                {
+                    Swap(Elements[Triangle + 1], Elements[Triangle + 2]);
+                }
+            }
+            Base += Instance.Vertices;
+        }
+
+        Output.Indices.resize(Offset + Elements.size() * sizeof(UInt16), 0);
+        memcpy(Output.Indices.data() + Offset, Elements.data(), Elements.size() * sizeof(UInt16));
+
+        Primitive.Indices            = { static_cast<UInt32>(Elements.size() * sizeof(UInt16)), Offset, sizeof(UInt16) };
+        Primitive.Details[0].Indices = Primitive.Indices;
+
+        Output.Primitives.emplace_back(Move(Primitive));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void MeshBatcher::Flush(ConstRef<Uri> Key, ConstRef<Instance> Source, Ref<Builder> Input, Ref<Vector<Batch>> Output)
+    {
+        Batch Batch;
+        Batch.Pipeline = Source.Pipeline;
+        Batch.Material = Source.Material;
+        Batch.Mesh     = NewPtr<Graphic::Mesh>(Uri::Merge(Key, Format("Batch{}", Output.size())));
+        Batch.Minimum  = Input.Primitives[0].Minimum;
+        Batch.Maximum  = Input.Primitives[0].Maximum;
+
+        for (Ref<Graphic::Mesh::Primitive> Primitive : Input.Primitives)
+        {
+            Batch.Minimum = Vector3f::Min(Batch.Minimum, Primitive.Minimum);
+            Batch.Maximum = Vector3f::Max(Batch.Maximum, Primitive.Maximum);
+            Batch.Mesh->AddPrimitive(Move(Primitive));
+        }
+
+        Data Vertices(Input.Vertices.size());
+        Vertices.Copy(Input.Vertices.data(), Input.Vertices.size());
+
+        Data Indices(Input.Indices.size());
+        Indices.Copy(Input.Indices.data(), Input.Indices.size());
+
+        Batch.Mesh->Load(Move(Vertices), Move(Indices));
+        Output.emplace_back(Move(Batch));
+
+        Input = Builder();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Graphic/Model.hpp"
+#include "Aurora.Graphic/Pipeline.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=(Undocumented)=-
+    class MeshBatcher final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxVertices = UINT16_MAX + 1;
+
+        // -=(Undocumented)=-
+        struct Batch
+        {
+            // -=(Undocumented)=-
+            SPtr<Graphic::Pipeline> Pipeline;
+
+            // -=(Undocumented)=-
+            SPtr<Graphic::Material> Material;
+
+            // -=(Undocumented)=-
+            SPtr<Graphic::Mesh>     Mesh;
+
+            // -=(Undocumented)=-
+            Vector3f                Minimum;
+
+            // -=(Undocumented)=-
+            Vector3f                Maximum;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        void Add(ConstSPtr<Graphic::Pipeline> Pipeline, ConstSPtr<Graphic::Model> Model, ConstRef<Matrix4f> Transform);
+
+        // -=(Undocumented)=-
+        Vector<Batch> Bake(ConstRef<Uri> Key);
+
+        // -=(Undocumented)=-
+        void Clear()
+        {
+            mInstances.clear();
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Instance
+        {
+            // -=(Undocumented)=-
+            SPtr<Graphic::Pipeline> Pipeline;
+
+            // -=(Undocumented)=-
+            SPtr<Graphic::Material> Material;
+
+            // -=(Undocumented)=-
+            SPtr<Graphic::Mesh>     Mesh;
+
+            // -=(Undocumented)=-
+            UInt8                   Primitive;
+
+            // -=(Undocumented)=-
+            UInt32                  Vertices;
+
+            // -=(Undocumented)=-
+            UInt32                  Order;
+
+            // -=(Undocumented)=-
+            Matrix4f                Transform;
+        };
+
+        // -=(Undocumented)=-
+        struct Builder
+        {
+            // -=(Undocumented)=-
+            Vector<UInt8>                      Vertices;
+
+            // -=(Undocumented)=-
+            Vector<UInt8>                      Indices;
+
+            // -=(Undocumented)=-
+            Vector<Graphic::Mesh::Primitive>   Primitives;
+        };
+
+        // -=(Undocumented)=-
+        static Bool IsCompatible(ConstRef<Instance> First, ConstRef<Instance> Second);
+
+        // -=(Undocumented)=-
+        static Bool IsMirrored(ConstRef<Matrix4f> Transform);
+
+        // -=(Undocumented)=-
+        static void Merge(CPtr<const Instance> Instances, Ref<Builder> Output);
+
+        // -=(Undocumented)=-
+        static void Flush(ConstRef<Uri> Key, ConstRef<Instance> Source, Ref<Builder> Input, Ref<Vector<Batch>> Output);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Instance> mInstances;
+    };
+}
\ No newline at end of file
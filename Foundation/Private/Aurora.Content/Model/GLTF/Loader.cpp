@@ -11,6 +11,9 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Loader.hpp"
+#include "Aurora.Content/Model/Optimizer.hpp"
+#include "Aurora.Content/Model/Quantizer.hpp"
+#include "Aurora.Content/Model/Simplifier.hpp"
 #define TINYGLTF_IMPLEMENTATION
 #define TINYGLTF_NO_STB_IMAGE_WRITE
 #include <tiny_gltf.h>
@@ -46,6 +49,60 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    Bool As(ConstRef<tinygltf::Accessor> GLTFAccessor, Ref<Graphic::VertexFormat> Format)
+    {
+        const Bool Normalized = GLTFAccessor.normalized;
+
+        switch (GLTFAccessor.componentType)
+        {
+        case TINYGLTF_COMPONENT_TYPE_FLOAT:
+            switch (GLTFAccessor.type)
+            {
+            case TINYGLTF_TYPE_SCALAR:
+                Format = Graphic::VertexFormat::Float32x1;
+                return true;
+            case TINYGLTF_TYPE_VEC2:
+                Format = Graphic::VertexFormat::Float32x2;
+                return true;
+            case TINYGLTF_TYPE_VEC3:
+                Format = Graphic::VertexFormat::Float32x3;
+                return true;
+            case TINYGLTF_TYPE_VEC4:
+                Format = Graphic::VertexFormat::Float32x4;
+                return true;
+            default:
+                return false;
+            }
+        case TINYGLTF_COMPONENT_TYPE_BYTE:
+            Format = (Normalized ? Graphic::VertexFormat::SIntNorm8x4 : Graphic::VertexFormat::SInt8x4);
+            return GLTFAccessor.type == TINYGLTF_TYPE_VEC4;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+            Format = (Normalized ? Graphic::VertexFormat::UIntNorm8x4 : Graphic::VertexFormat::UInt8x4);
+            return GLTFAccessor.type == TINYGLTF_TYPE_VEC4;
+        case TINYGLTF_COMPONENT_TYPE_SHORT:
+            if (GLTFAccessor.type == TINYGLTF_TYPE_VEC2)
+            {
+                Format = (Normalized ? Graphic::VertexFormat::SIntNorm16x2 : Graphic::VertexFormat::SInt16x2);
+                return true;
+            }
+            Format = (Normalized ? Graphic::VertexFormat::SIntNorm16x4 : Graphic::VertexFormat::SInt16x4);
+            return GLTFAccessor.type == TINYGLTF_TYPE_VEC4;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+            if (GLTFAccessor.type == TINYGLTF_TYPE_VEC2)
+            {
+                Format = (Normalized ? Graphic::VertexFormat::UIntNorm16x2 : Graphic::VertexFormat::UInt16x2);
+                return true;
+            }
+            Format = (Normalized ? Graphic::VertexFormat::UIntNorm16x4 : Graphic::VertexFormat::UInt16x4);
+            return GLTFAccessor.type == TINYGLTF_TYPE_VEC4;
+        default:
+            return false;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Graphic::Sampler LoadSampler(ConstRef<tinygltf::Sampler> GLTFSampler)
     {
         Graphic::TextureEdge   EdgeU  = Graphic::TextureEdge::Repeat;
@@ -118,6 +175,807 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void ReadIndices(Ptr<const UInt8> Address, UInt32 Size, CPtr<UInt32> Elements)
+    {
+        for (UInt32 Element = 0; Element < Elements.size(); ++Element)
+        {
+            switch (Size)
+            {
+            case sizeof(UInt8):
+                Elements[Element] = Address[Element];
+                break;
+            case sizeof(UInt16):
+                Elements[Element] = reinterpret_cast<Ptr<const UInt16>>(Address)[Element];
+                break;
+            default:
+                Elements[Element] = reinterpret_cast<Ptr<const UInt32>>(Address)[Element];
+                break;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void WriteIndices(Ptr<UInt8> Address, UInt32 Size, CPtr<const UInt32> Elements)
+    {
+        for (UInt32 Element = 0; Element < Elements.size(); ++Element)
+        {
+            switch (Size)
+            {
+            case sizeof(UInt8):
+                Address[Element] = static_cast<UInt8>(Elements[Element]);
+                break;
+            case sizeof(UInt16):
+                reinterpret_cast<Ptr<UInt16>>(Address)[Element] = static_cast<UInt16>(Elements[Element]);
+                break;
+            default:
+                reinterpret_cast<Ptr<UInt32>>(Address)[Element] = Elements[Element];
+                break;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool IsWithin(
+        ConstRef<tinygltf::Model> GLTFModel,
+        ConstRef<tinygltf::Accessor> GLTFAccessor,
+        ConstRef<Data> Block,
+        SInt32 Target)
+    {
+        // Sparse accessors and accessors without a buffer view have no contiguous storage to read from.
+        if (GLTFAccessor.sparse.isSparse
+            || GLTFAccessor.bufferView < 0 || GLTFAccessor.bufferView >= GLTFModel.bufferViews.size())
+        {
+            return false;
+        }
+
+        ConstRef<tinygltf::BufferView> GLTFView = GLTFModel.bufferViews[GLTFAccessor.bufferView];
+
+        const SInt32 Size   = tinygltf::GetComponentSizeInBytes(GLTFAccessor.componentType)
+                            * tinygltf::GetNumComponentsInType(GLTFAccessor.type);
+        const SInt32 Stride = GLTFAccessor.ByteStride(GLTFView);
+
+        if (GLTFView.target != Target || Size <= 0 || Stride <= 0)
+        {
+            return false;
+        }
+
+        // Both the last element within the view and the view within the block it was repacked into.
+        const UInt64 End = GLTFAccessor.byteOffset
+            + (GLTFAccessor.count > 0 ? static_cast<UInt64>(GLTFAccessor.count - 1) * Stride + Size : 0);
+        return End <= GLTFView.byteLength && GLTFView.byteOffset + GLTFView.byteLength <= Block.GetSize();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool OptimizePrimitive(
+        Ref<tinygltf::Model> GLTFModel,
+        ConstRef<tinygltf::Primitive> GLTFPrimitive,
+        ConstRef<Table<SInt32, UInt32>> GLTFReferences,
+        Ref<Data> Vertices,
+        Ref<Data> Indices,
+        Ref<Vector<UInt8>> LevelIndices,
+        Ref<Array<Graphic::Mesh::Detail, Graphic::Mesh::k_MaxDetails>> Details,
+        Ref<MeshOptimizer::Statistics> Before,
+        Ref<MeshOptimizer::Statistics> After)
+    {
+        if (GLTFPrimitive.indices < 0 || (GLTFPrimitive.mode >= 0 && GLTFPrimitive.mode != TINYGLTF_MODE_TRIANGLES))
+        {
+            return false;
+        }
+
+        const auto Position = GLTFPrimitive.attributes.find("POSITION");
+        if (Position == GLTFPrimitive.attributes.end())
+        {
+            return false;
+        }
+
+        // Everything is read and permuted in place, so each range must lie within the block it was packed into.
+        const auto IsVertices = [&](SInt32 Accessor)
+        {
+            return IsWithin(GLTFModel, GLTFModel.accessors[Accessor], Vertices, TINYGLTF_TARGET_ARRAY_BUFFER);
+        };
+        const auto IsIndices = [&](SInt32 Accessor)
+        {
+            return IsWithin(GLTFModel, GLTFModel.accessors[Accessor], Indices, TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER);
+        };
+
+        // Accessors shared with other primitive(s) can't be reordered in place.
+        const auto IsExclusive = [&](SInt32 Accessor)
+        {
+            return GLTFReferences.find(Accessor)->second == 1;
+        };
+
+        ConstRef<tinygltf::Accessor> GLTFPositions = GLTFModel.accessors[Position->second];
+        ConstRef<tinygltf::Accessor> GLTFIndices   = GLTFModel.accessors[GLTFPrimitive.indices];
+
+        if (GLTFPositions.type != TINYGLTF_TYPE_VEC3 || GLTFPositions.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT
+            || GLTFPositions.count == 0 || !IsVertices(Position->second)
+            || GLTFIndices.type != TINYGLTF_TYPE_SCALAR || GLTFIndices.count % 3 != 0
+            || !IsIndices(GLTFPrimitive.indices) || !IsExclusive(GLTFPrimitive.indices))
+        {
+            return false;
+        }
+
+        // Decode indices and positions into a flat representation.
+        const UInt32   Count = GLTFPositions.count;
+        Vector<UInt32> Elements(GLTFIndices.count);
+
+        const UInt32     IndexSize    = tinygltf::GetComponentSizeInBytes(GLTFIndices.componentType);
+        const Ptr<UInt8> IndexAddress = Indices.GetData<UInt8>()
+                                      + GLTFModel.bufferViews[GLTFIndices.bufferView].byteOffset + GLTFIndices.byteOffset;
+
+        ReadIndices(IndexAddress, IndexSize, Elements);
+
+        for (const UInt32 Element : Elements)
+        {
+            if (Element >= Count)
+            {
+                return false;
+            }
+        }
+
+        ConstRef<tinygltf::BufferView> GLTFPositionsView = GLTFModel.bufferViews[GLTFPositions.bufferView];
+
+        Vector<Vector3f> Positions(Count);
+        const UInt32     PositionStride  = GLTFPositions.ByteStride(GLTFPositionsView);
+        const Ptr<UInt8> PositionAddress = Vertices.GetData<UInt8>() + GLTFPositionsView.byteOffset + GLTFPositions.byteOffset;
+
+        for (UInt32 Vertex = 0; Vertex < Count; ++Vertex)
+        {
+            memcpy(AddressOf(Positions[Vertex]), PositionAddress + Vertex * PositionStride, sizeof(Vector3f));
+        }
+
+        // Reorder triangles for the post-transform cache and then the clusters for overdraw.
+        Before += MeshOptimizer::Analyze(Elements, Count);
+
+        const Vector<UInt32> Clusters = MeshOptimizer::OptimizeVertexCache(Elements, Count);
+        MeshOptimizer::OptimizeOverdraw(Elements, Positions, Clusters);
+
+        // Reorder vertices for fetch locality, only when every attribute belongs to this primitive.
+        Bool Fetchable = true;
+
+        for (const auto & [Name, Accessor] : GLTFPrimitive.attributes)
+        {
+            Fetchable = Fetchable
+                && IsVertices(Accessor) && IsExclusive(Accessor) && GLTFModel.accessors[Accessor].count == Count;
+        }
+
+        if (Fetchable)
+        {
+            Vector<UInt32> Remap;
+            MeshOptimizer::OptimizeVertexFetch(Elements, Count, Remap);
+
+            Vector<Vector3f> Reordered(Count);
+            for (UInt32 Vertex = 0; Vertex < Count; ++Vertex)
+            {
+                Reordered[Remap[Vertex]] = Positions[Vertex];
+            }
+            Positions.swap(Reordered);
+
+            Vector<UInt8> Scratch;
+
+            for (const auto & [Name, Accessor] : GLTFPrimitive.attributes)
+            {
+                ConstRef<tinygltf::Accessor>   GLTFAccessor = GLTFModel.accessors[Accessor];
+                ConstRef<tinygltf::BufferView> GLTFView     = GLTFModel.bufferViews[GLTFAccessor.bufferView];
+
+                const UInt32     Size    = tinygltf::GetComponentSizeInBytes(GLTFAccessor.componentType)
+                                         * tinygltf::GetNumComponentsInType(GLTFAccessor.type);
+                const UInt32     Stride  = GLTFAccessor.ByteStride(GLTFView);
+                const Ptr<UInt8> Address = Vertices.GetData<UInt8>() + GLTFView.byteOffset + GLTFAccessor.byteOffset;
+
+                Scratch.resize(Count * Size);
+
+                for (UInt32 Vertex = 0; Vertex < Count; ++Vertex)
+                {
+                    memcpy(Scratch.data() + Vertex * Size, Address + Vertex * Stride, Size);
+                }
+                for (UInt32 Vertex = 0; Vertex < Count; ++Vertex)
+                {
+                    memcpy(Address + Remap[Vertex] * Stride, Scratch.data() + Vertex * Size, Size);
+                }
+            }
+        }
+
+        After += MeshOptimizer::Analyze(Elements, Count);
+
+        // Encode indices back using the original format.
+        WriteIndices(IndexAddress, IndexSize, Elements);
+
+        // Generate the level(s) of detail, each one is simplified from the previous level and
+        // shares the vertices with the full detail level.
+        Vector3f Minimum = Positions[0];
+        Vector3f Maximum = Positions[0];
+
+        for (ConstRef<Vector3f> Point : Positions)
+        {
+            Minimum = Vector3f::Min(Minimum, Point);
+            Maximum = Vector3f::Max(Maximum, Point);
+        }
+
+        const Real32   Radius = (Maximum - Minimum).GetLength() * 0.5f;
+        Real32         Error  = 0.0f;
+        Vector<UInt32> Source = Elements;
+        Vector<UInt32> Simplified;
+
+        for (UInt32 Level = 1; Level < Graphic::Mesh::k_MaxDetails && Radius > 0.0f; ++Level)
+        {
+            const UInt32 Target = (Elements.size() / 3 >> Level) * 3;
+
+            Error += MeshSimplifier::Simplify(Source, Positions, Target, Simplified);
+
+            // Stop once the seam(s) and border(s) prevent any meaningful reduction.
+            if (Simplified.empty() || Simplified.size() * 5 > Source.size() * 4)
+            {
+                break;
+            }
+
+            MeshOptimizer::OptimizeVertexCache(Simplified, Count);
+
+            const UInt32 Offset = Align(Indices.GetSize() + LevelIndices.size(), sizeof(UInt32));
+            LevelIndices.resize(Offset - Indices.GetSize() + Simplified.size() * IndexSize);
+            WriteIndices(LevelIndices.data() + (Offset - Indices.GetSize()), IndexSize, Simplified);
+
+            Details[Level].Indices = { static_cast<UInt32>(Simplified.size() * IndexSize), Offset, IndexSize };
+            Details[Level].Error   = Error / Radius;
+
+            Source.swap(Simplified);
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool QuantizeAttribute(
+        ConstRef<tinygltf::Model> GLTFModel,
+        ConstRef<tinygltf::Accessor> GLTFAccessor,
+        Graphic::VertexSemantic Semantic,
+        ConstRef<Data> Source,
+        ConstRef<Graphic::Mesh::Primitive> Primitive,
+        Bool Skinned,
+        Ref<Vector<UInt8>> Output,
+        Ref<Graphic::Mesh::Attribute> Attribute)
+    {
+        if (!IsWithin(GLTFModel, GLTFAccessor, Source, TINYGLTF_TARGET_ARRAY_BUFFER))
+        {
+            return false;
+        }
+
+        ConstRef<tinygltf::BufferView> GLTFView = GLTFModel.bufferViews[GLTFAccessor.bufferView];
+
+        const UInt32 Components = tinygltf::GetNumComponentsInType(GLTFAccessor.type);
+        const UInt32 Size       = tinygltf::GetComponentSizeInBytes(GLTFAccessor.componentType) * Components;
+        const UInt32 Stride     = GLTFAccessor.ByteStride(GLTFView);
+        const Bool   Decimal    = (GLTFAccessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
+        Bool         Quantized  = Decimal;
+
+        // Pick the most compact encoding that each semantic tolerates, anything else is copied as-is. Skinned
+        // positions and normals are replaced every frame by the deformed ones and must stay in full precision.
+        if (Skinned && (Semantic == Graphic::VertexSemantic::Position || Semantic == Graphic::VertexSemantic::Normal))
+        {
+            Quantized = false;
+        }
+
+        if (Quantized && Semantic == Graphic::VertexSemantic::Position && Components == 3)
+        {
+            Attribute.Format = Graphic::VertexFormat::UIntNorm16x4;
+            Attribute.Stride = 4 * sizeof(UInt16);
+        }
+        else if (Quantized && Semantic == Graphic::VertexSemantic::Normal && Components == 3)
+        {
+            Attribute.Format = Graphic::VertexFormat::SIntNorm16x2;
+            Attribute.Stride = 2 * sizeof(SInt16);
+        }
+        else if (Quantized && Semantic == Graphic::VertexSemantic::Tangent && Components == 4)
+        {
+            Attribute.Format = Graphic::VertexFormat::SIntNorm16x4;
+            Attribute.Stride = 4 * sizeof(SInt16);
+        }
+        else if (Quantized && Semantic >= Graphic::VertexSemantic::TexCoord0 && Semantic <= Graphic::VertexSemantic::TexCoord7 && Components == 2)
+        {
+            Attribute.Format = Graphic::VertexFormat::Float16x2;
+            Attribute.Stride = 2 * sizeof(UInt16);
+        }
+        else if (As(GLTFAccessor, Attribute.Format))
+        {
+            Attribute.Stride = Align(Size, sizeof(UInt32));
+            Quantized        = false;
+        }
+        else
+        {
+            return false;
+        }
+
+        Attribute.Offset = Align(Output.size(), sizeof(UInt32));
+        Attribute.Length = Attribute.Stride * GLTFAccessor.count;
+        Output.resize(Attribute.Offset + Attribute.Length, 0);
+
+        const Ptr<const UInt8> Input = Source.GetData<UInt8>() + GLTFView.byteOffset + GLTFAccessor.byteOffset;
+
+        for (UInt32 Vertex = 0; Vertex < GLTFAccessor.count; ++Vertex)
+        {
+            const Ptr<const UInt8> Element     = Input + Vertex * Stride;
+            const Ptr<UInt8>       Destination = Output.data() + Attribute.Offset + Vertex * Attribute.Stride;
+
+            if (!Quantized)
+            {
+                memcpy(Destination, Element, Size);
+                continue;
+            }
+
+            Array<Real32, 4> Value { };
+            memcpy(Value.data(), Element, Size);
+
+            switch (Attribute.Format)
+            {
+            case Graphic::VertexFormat::UIntNorm16x4:
+            {
+                const Array<UInt16, 4> Encoded = MeshQuantizer::EncodePosition(
+                    Vector3f(Value[0], Value[1], Value[2]), Primitive.Minimum, Primitive.Maximum);
+                memcpy(Destination, Encoded.data(), sizeof(Encoded));
+                break;
+            }
+            case Graphic::VertexFormat::SIntNorm16x2:
+            {
+                const Array<SInt16, 2> Encoded = MeshQuantizer::EncodeOctahedral(Vector3f(Value[0], Value[1], Value[2]));
+                memcpy(Destination, Encoded.data(), sizeof(Encoded));
+                break;
+            }
+            case Graphic::VertexFormat::SIntNorm16x4:
+            {
+                const Array<SInt16, 4> Encoded {
+                    MeshQuantizer::EncodeSNorm16(Value[0]),
+                    MeshQuantizer::EncodeSNorm16(Value[1]),
+                    MeshQuantizer::EncodeSNorm16(Value[2]),
+                    MeshQuantizer::EncodeSNorm16(Value[3])
+                };
+                memcpy(Destination, Encoded.data(), sizeof(Encoded));
+                break;
+            }
+            default:
+            {
+                const Array<UInt16, 2> Encoded {
+                    MeshQuantizer::EncodeHalf(Value[0]),
+                    MeshQuantizer::EncodeHalf(Value[1])
+                };
+                memcpy(Destination, Encoded.data(), sizeof(Encoded));
+                break;
+            }
+            }
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector<Real32> ReadAccessor(
+        ConstRef<tinygltf::Model> GLTFModel,
+        ConstRef<tinygltf::Accessor> GLTFAccessor,
+        ConstRef<Data> Vertices,
+        ConstRef<Data> Indices)
+    {
+        const UInt32   Components = tinygltf::GetNumComponentsInType(GLTFAccessor.type);
+        Vector<Real32> Values(GLTFAccessor.count * Components, 0.0f);
+
+        if (GLTFAccessor.bufferView < 0 || GLTFAccessor.bufferView >= GLTFModel.bufferViews.size())
+        {
+            return Values;
+        }
+
+        // Buffer views were repacked into two blocks at this point, pick the one that holds the view.
+        ConstRef<tinygltf::BufferView> GLTFView = GLTFModel.bufferViews[GLTFAccessor.bufferView];
+        ConstRef<Data>                 Block    = (GLTFView.target == TINYGLTF_TARGET_ARRAY_BUFFER ? Vertices : Indices);
+
+        if (!IsWithin(GLTFModel, GLTFAccessor, Block, GLTFView.target))
+        {
+            return Values;
+        }
+
+        const UInt32           Size   = tinygltf::GetComponentSizeInBytes(GLTFAccessor.componentType);
+        const UInt32           Stride = GLTFAccessor.ByteStride(GLTFView);
+        const Ptr<const UInt8> Input  = Block.GetData<UInt8>() + GLTFView.byteOffset + GLTFAccessor.byteOffset;
+
+        for (UInt32 Element = 0; Element < GLTFAccessor.count; ++Element)
+        {
+            for (UInt32 Component = 0; Component < Components; ++Component)
+            {
+                const Ptr<const UInt8> Address = Input + Element * Stride + Component * Size;
+                Ref<Real32>            Value   = Values[Element * Components + Component];
+
+                switch (GLTFAccessor.componentType)
+                {
+                case TINYGLTF_COMPONENT_TYPE_FLOAT:
+                    memcpy(AddressOf(Value), Address, sizeof(Real32));
+                    break;
+                case TINYGLTF_COMPONENT_TYPE_BYTE:
+                {
+                    const SInt8 Integer = static_cast<SInt8>(* Address);
+                    Value = (GLTFAccessor.normalized ? Max(Integer / 127.0f, -1.0f) : Integer);
+                    break;
+                }
+                case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                    Value = (GLTFAccessor.normalized ? * Address / 255.0f : * Address);
+                    break;
+                case TINYGLTF_COMPONENT_TYPE_SHORT:
+                {
+                    SInt16 Integer;
+                    memcpy(AddressOf(Integer), Address, sizeof(SInt16));
+                    Value = (GLTFAccessor.normalized ? Max(Integer / 32767.0f, -1.0f) : Integer);
+                    break;
+                }
+                case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+                {
+                    UInt16 Integer;
+                    memcpy(AddressOf(Integer), Address, sizeof(UInt16));
+                    Value = (GLTFAccessor.normalized ? Integer / 65535.0f : Integer);
+                    break;
+                }
+                case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+                {
+                    UInt32 Integer;
+                    memcpy(AddressOf(Integer), Address, sizeof(UInt32));
+                    Value = static_cast<Real32>(Integer);
+                    break;
+                }
+                default:
+                    break;
+                }
+            }
+        }
+        return Values;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Transformf LoadNode(ConstRef<tinygltf::Node> GLTFNode)
+    {
+        Vector3f    Position(0.0f, 0.0f, 0.0f);
+        Vector3f    Scale(1.0f, 1.0f, 1.0f);
+        Quaternionf Rotation;
+
+        if (GLTFNode.matrix.size() == 16)
+        {
+            // Decompose the matrix, assuming it has no shear as required by the specification for nodes
+            // that are targeted by animations.
+            ConstRef<Vector<Real64>> M = GLTFNode.matrix;
+
+            Position = Vector3f(M[12], M[13], M[14]);
+            Scale    = Vector3f(
+                Vector3f(M[0], M[1], M[2]).GetLength(),
+                Vector3f(M[4], M[5], M[6]).GetLength(),
+                Vector3f(M[8], M[9], M[10]).GetLength());
+
+            if (Scale.GetX() > 0.0f && Scale.GetY() > 0.0f && Scale.GetZ() > 0.0f)
+            {
+                const Real32 R00 = M[0] / Scale.GetX(), R10 = M[1] / Scale.GetX(), R20 = M[2]  / Scale.GetX();
+                const Real32 R01 = M[4] / Scale.GetY(), R11 = M[5] / Scale.GetY(), R21 = M[6]  / Scale.GetY();
+                const Real32 R02 = M[8] / Scale.GetZ(), R12 = M[9] / Scale.GetZ(), R22 = M[10] / Scale.GetZ();
+
+                if (const Real32 Trace = R00 + R11 + R22; Trace > 0.0f)
+                {
+                    const Real32 S = Sqrt(Trace + 1.0f) * 2.0f;
+                    Rotation = Quaternionf((R21 - R12) / S, (R02 - R20) / S, (R10 - R01) / S, 0.25f * S);
+                }
+                else if (R00 > R11 && R00 > R22)
+                {
+                    const Real32 S = Sqrt(1.0f + R00 - R11 - R22) * 2.0f;
+                    Rotation = Quaternionf(0.25f * S, (R01 + R10) / S, (R02 + R20) / S, (R21 - R12) / S);
+                }
+                else if (R11 > R22)
+                {
+                    const Real32 S = Sqrt(1.0f + R11 - R00 - R22) * 2.0f;
+                    Rotation = Quaternionf((R01 + R10) / S, 0.25f * S, (R12 + R21) / S, (R02 - R20) / S);
+                }
+                else
+                {
+                    const Real32 S = Sqrt(1.0f + R22 - R00 - R11) * 2.0f;
+                    Rotation = Quaternionf((R02 + R20) / S, (R12 + R21) / S, 0.25f * S, (R10 - R01) / S);
+                }
+            }
+            return Transformf(Position, Scale, Quaternionf::Normalize(Rotation));
+        }
+
+        if (GLTFNode.translation.size() == 3)
+        {
+            Position = Vector3f(GLTFNode.translation[0], GLTFNode.translation[1], GLTFNode.translation[2]);
+        }
+        if (GLTFNode.rotation.size() == 4)
+        {
+            Rotation = Quaternionf(GLTFNode.rotation[0], GLTFNode.rotation[1], GLTFNode.rotation[2], GLTFNode.rotation[3]);
+        }
+        if (GLTFNode.scale.size() == 3)
+        {
+            Scale = Vector3f(GLTFNode.scale[0], GLTFNode.scale[1], GLTFNode.scale[2]);
+        }
+        return Transformf(Position, Scale, Rotation);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Matrix4f LoadSkeleton(
+        ConstRef<tinygltf::Model> GLTFModel,
+        ConstRef<tinygltf::Skin> GLTFSkin,
+        ConstRef<Data> Vertices,
+        ConstRef<Data> Indices,
+        Ref<Vector<Graphic::Skin::Joint>> Joints,
+        Ref<Table<SInt32, UInt32>> Mapping,
+        Ref<Vector<UInt32>> Remap)
+    {
+        Vector<SInt32> Parents(GLTFModel.nodes.size(), -1);
+
+        for (UInt32 Node = 0; Node < GLTFModel.nodes.size(); ++Node)
+        {
+            for (const SInt32 Child : GLTFModel.nodes[Node].children)
+            {
+                Parents[Child] = Node;
+            }
+        }
+
+        const auto GetDepth = [&](SInt32 Node)
+        {
+            UInt32 Depth = 0;
+
+            for (; Parents[Node] >= 0; Node = Parents[Node])
+            {
+                ++Depth;
+            }
+            return Depth;
+        };
+
+        // Sort the joints by depth so that parents always come before their children, the runtime relies
+        // on it to resolve the hierarchy in a single pass.
+        const UInt32   Count = GLTFSkin.joints.size();
+        Vector<UInt32> Order(Count);
+
+        for (UInt32 Slot = 0; Slot < Count; ++Slot)
+        {
+            Order[Slot] = Slot;
+        }
+        Sort(Order, [&](UInt32 First, UInt32 Second)
+        {
+            return GetDepth(GLTFSkin.joints[First]) < GetDepth(GLTFSkin.joints[Second]);
+        });
+
+        Remap.resize(Count);
+
+        for (UInt32 Joint = 0; Joint < Count; ++Joint)
+        {
+            Mapping[GLTFSkin.joints[Order[Joint]]] = Joint;
+            Remap[Order[Joint]] = Joint;
+        }
+
+        Vector<Real32> Inverses;
+
+        if (GLTFSkin.inverseBindMatrices >= 0)
+        {
+            Inverses = ReadAccessor(GLTFModel, GLTFModel.accessors[GLTFSkin.inverseBindMatrices], Vertices, Indices);
+        }
+
+        Matrix4f Root;
+        Bool     Rooted = false;
+
+        Joints.resize(Count);
+
+        for (UInt32 Joint = 0; Joint < Count; ++Joint)
+        {
+            const UInt32              Slot   = Order[Joint];
+            const SInt32              Node   = GLTFSkin.joints[Slot];
+            Ref<Graphic::Skin::Joint> Target = Joints[Joint];
+
+            Target.Name = GLTFModel.nodes[Node].name;
+            Target.Rest = LoadNode(GLTFModel.nodes[Node]);
+
+            if (Inverses.size() >= (Slot + 1) * 16)
+            {
+                const Ptr<const Real32> M = Inverses.data() + Slot * 16;
+                Target.Inverse = Matrix4f(
+                    M[0],  M[1],  M[2],  M[3],
+                    M[4],  M[5],  M[6],  M[7],
+                    M[8],  M[9],  M[10], M[11],
+                    M[12], M[13], M[14], M[15]);
+            }
+
+            // Skip over any node in between that doesn't belong to the skin.
+            SInt32 Parent = Parents[Node];
+
+            while (Parent >= 0 && Mapping.find(Parent) == Mapping.end())
+            {
+                Parent = Parents[Parent];
+            }
+            Target.Parent = (Parent >= 0 ? static_cast<SInt32>(Mapping[Parent]) : -1);
+
+            // Nodes above the top most joint still move the whole skeleton, bake them into a single root.
+            if (Target.Parent < 0 && !Rooted)
+            {
+                for (SInt32 Ancestor = Parents[Node]; Ancestor >= 0; Ancestor = Parents[Ancestor])
+                {
+                    Root = LoadNode(GLTFModel.nodes[Ancestor]).Compute() * Root;
+                }
+                Rooted = true;
+            }
+        }
+        return Root;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SPtr<Graphic::Animation> LoadAnimation(
+        ConstRef<tinygltf::Model> GLTFModel,
+        ConstRef<tinygltf::Animation> GLTFAnimation,
+        ConstRef<Table<SInt32, UInt32>> Mapping,
+        ConstRef<Data> Vertices,
+        ConstRef<Data> Indices)
+    {
+        Vector<Graphic::Animation::Channel> Channels;
+
+        for (ConstRef<tinygltf::AnimationChannel> GLTFChannel : GLTFAnimation.channels)
+        {
+            const auto Joint = Mapping.find(GLTFChannel.target_node);
+
+            if (Joint == Mapping.end() || GLTFChannel.sampler < 0)
+            {
+                continue;
+            }
+
+            Graphic::Animation::Channel Channel;
+            Channel.Joint = Joint->second;
+
+            if (GLTFChannel.target_path == "translation")
+            {
+                Channel.Target = Graphic::Animation::Path::Translation;
+            }
+            else if (GLTFChannel.target_path == "rotation")
+            {
+                Channel.Target = Graphic::Animation::Path::Rotation;
+            }
+            else if (GLTFChannel.target_path == "scale")
+            {
+                Channel.Target = Graphic::Animation::Path::Scale;
+            }
+            else
+            {
+                continue;   // @NOT_SUPPORTED (Morph target weights)
+            }
+
+            ConstRef<tinygltf::AnimationSampler> GLTFSampler = GLTFAnimation.samplers[GLTFChannel.sampler];
+            ConstRef<tinygltf::Accessor>         GLTFOutput  = GLTFModel.accessors[GLTFSampler.output];
+
+            // Cubic spline tracks store an in-tangent, the value and an out-tangent per key, only the value
+            // is kept and the track is played back linearly.
+            const Bool   Cubic      = (GLTFSampler.interpolation == "CUBICSPLINE");
+            const UInt32 Components = tinygltf::GetNumComponentsInType(GLTFOutput.type);
+
+            Channel.Mode  = (GLTFSampler.interpolation == "STEP"
+                ? Graphic::Animation::Interpolation::Step
+                : Graphic::Animation::Interpolation::Linear);
+            Channel.Times = ReadAccessor(GLTFModel, GLTFModel.accessors[GLTFSampler.input], Vertices, Indices);
+
+            const Vector<Real32> Values = ReadAccessor(GLTFModel, GLTFOutput, Vertices, Indices);
+            const UInt32         Keys   = Channel.Times.size();
+
+            if (Components < 3 || Values.size() != Keys * Components * (Cubic ? 3 : 1))
+            {
+                Log::Warn("GLTFLoader: Malformed channel for node {} in {}", GLTFChannel.target_node, GLTFAnimation.name);
+                continue;
+            }
+
+            Channel.Values.resize(Keys);
+
+            for (UInt32 Key = 0; Key < Keys; ++Key)
+            {
+                const Ptr<const Real32> Value = Values.data() + (Cubic ? Key * 3 + 1 : Key) * Components;
+                Channel.Values[Key] = Vector4f(Value[0], Value[1], Value[2], Components > 3 ? Value[3] : 0.0f);
+            }
+            Channels.emplace_back(Move(Channel));
+        }
+        return NewPtr<Graphic::Animation>(SStr(GLTFAnimation.name), Move(Channels));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool LoadInfluences(
+        ConstRef<tinygltf::Model> GLTFModel,
+        ConstRef<tinygltf::Primitive> GLTFPrimitive,
+        ConstRef<Vector<UInt32>> Remap,
+        UInt32 Skeleton,
+        ConstRef<Data> Vertices,
+        ConstRef<Data> Indices,
+        Ref<Graphic::Skin::Stream> Stream)
+    {
+        const auto Position = GLTFPrimitive.attributes.find("POSITION");
+        const auto Normal   = GLTFPrimitive.attributes.find("NORMAL");
+        const auto Joints   = GLTFPrimitive.attributes.find("JOINTS_0");
+        const auto Weights  = GLTFPrimitive.attributes.find("WEIGHTS_0");
+
+        if (Position == GLTFPrimitive.attributes.end()
+            || Joints == GLTFPrimitive.attributes.end() || Weights == GLTFPrimitive.attributes.end())
+        {
+            return false;
+        }
+
+        ConstRef<tinygltf::Accessor> GLTFPositions = GLTFModel.accessors[Position->second];
+        ConstRef<tinygltf::Accessor> GLTFJoints    = GLTFModel.accessors[Joints->second];
+        ConstRef<tinygltf::Accessor> GLTFWeights   = GLTFModel.accessors[Weights->second];
+
+        const UInt32 Count = GLTFPositions.count;
+
+        if (GLTFPositions.type != TINYGLTF_TYPE_VEC3 || GLTFPositions.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT
+            || GLTFJoints.type != TINYGLTF_TYPE_VEC4
+            || GLTFWeights.type != TINYGLTF_TYPE_VEC4 || GLTFJoints.count != Count || GLTFWeights.count != Count)
+        {
+            return false;
+        }
+
+        const Vector<Real32> Points      = ReadAccessor(GLTFModel, GLTFPositions, Vertices, Indices);
+        const Vector<Real32> Influences  = ReadAccessor(GLTFModel, GLTFJoints, Vertices, Indices);
+        const Vector<Real32> Percentages = ReadAccessor(GLTFModel, GLTFWeights, Vertices, Indices);
+
+        Stream.Positions.resize(Count);
+        Stream.Joints.resize(Count);
+        Stream.Weights.resize(Count);
+
+        for (UInt32 Vertex = 0; Vertex < Count; ++Vertex)
+        {
+            Stream.Positions[Vertex] = Vector3f(Points[Vertex * 3], Points[Vertex * 3 + 1], Points[Vertex * 3 + 2]);
+
+            Real32 Total = 0.0f;
+
+            for (UInt32 Influence = 0; Influence < Graphic::Skin::k_MaxInfluences; ++Influence)
+            {
+                // Joints outside of the skeleton are dropped here, the runtime indexes the palette unchecked.
+                const Real32 Slot   = Influences[Vertex * 4 + Influence];
+                const Bool   Usable = Slot >= 0.0f && Slot < Remap.size()
+                                   && Remap[static_cast<UInt32>(Slot)] < Skeleton;
+
+                Stream.Joints[Vertex][Influence]  = (Usable ? Remap[static_cast<UInt32>(Slot)] : 0);
+                Stream.Weights[Vertex][Influence] = (Usable ? Max(Percentages[Vertex * 4 + Influence], 0.0f) : 0.0f);
+
+                Total += Stream.Weights[Vertex][Influence];
+            }
+
+            // Exporters don't always normalize the weights, which shows up as vertices drifting away.
+            for (Ref<Real32> Weight : Stream.Weights[Vertex])
+            {
+                Weight = (Total > 0.0f ? Weight / Total : 0.0f);
+            }
+        }
+
+        if (Normal == GLTFPrimitive.attributes.end())
+        {
+            return true;
+        }
+
+        if (ConstRef<tinygltf::Accessor> GLTFNormals = GLTFModel.accessors[Normal->second];
+            GLTFNormals.type == TINYGLTF_TYPE_VEC3 && GLTFNormals.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT
+            && GLTFNormals.count == Count)
+        {
+            const Vector<Real32> Directions = ReadAccessor(GLTFModel, GLTFNormals, Vertices, Indices);
+
+            Stream.Normals.resize(Count);
+
+            for (UInt32 Vertex = 0; Vertex < Count; ++Vertex)
+            {
+                Stream.Normals[Vertex] = Vector3f(
+                    Directions[Vertex * 3], Directions[Vertex * 3 + 1], Directions[Vertex * 3 + 2]);
+            }
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Bool GLTFLoader::OnLoad(Ref<Service> Service, Any<Data> File, Ref<Graphic::Model> Asset)
     {
         tinygltf::TinyGLTF GLTFLoader;
@@ -142,18 +1000,56 @@ namespace Content
             return false;
         }
 
+        // The target of a view is optional, so untargeted views are classified by how the primitives use them.
+        // Vertex data must land in the vertex block, anything else (indices, images, skins...) in the other one.
+        for (ConstRef<tinygltf::Mesh> GLTFMesh : GLTFModel.meshes)
+        {
+            for (ConstRef<tinygltf::Primitive> GLTFPrimitive : GLTFMesh.primitives)
+            {
+                const auto Classify = [&](SInt32 Accessor, SInt32 Target)
+                {
+                    if (Accessor < 0 || Accessor >= GLTFModel.accessors.size())
+                    {
+                        return;
+                    }
+
+                    const SInt32 View = GLTFModel.accessors[Accessor].bufferView;
+
+                    if (View >= 0 && View < GLTFModel.bufferViews.size() && GLTFModel.bufferViews[View].target == 0)
+                    {
+                        GLTFModel.bufferViews[View].target = Target;
+                    }
+                };
+
+                for (const auto & [Name, Accessor] : GLTFPrimitive.attributes)
+                {
+                    Classify(Accessor, TINYGLTF_TARGET_ARRAY_BUFFER);
+                }
+                Classify(GLTFPrimitive.indices, TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER);
+            }
+        }
+
         // Find how many bytes we need for buffer(s) and create them
         UInt32 BytesForVertices = 0;
         UInt32 BytesForIndices  = 0;
         for (ConstRef<tinygltf::BufferView> View : GLTFModel.bufferViews)
         {
+            if (View.buffer < 0 || View.buffer >= GLTFModel.buffers.size()
+                || View.byteOffset + View.byteLength > GLTFModel.buffers[View.buffer].data.size())
+            {
+                Log::Warn("GLTFLoader: Buffer view out of range in '{}'", Asset.GetKey().GetUrl());
+                return false;
+            }
+
             if (View.target == TINYGLTF_TARGET_ARRAY_BUFFER)
             {
                 BytesForVertices += View.byteLength;
             }
             else
             {
-                BytesForIndices += View.byteLength;
+                // Index views are drawn from an offset expressed in elements, so each one starts on a boundary
+                // that suits any index size.
+                BytesForIndices = Align(BytesForIndices, sizeof(UInt32)) + View.byteLength;
             }
         }
 
@@ -173,6 +1069,8 @@ namespace Content
             }
             else
             {
+                OffsetForIndices = Align(OffsetForIndices, sizeof(UInt32));
+
                 memcpy(
                      BlockForIndices.GetData<UInt8>() + OffsetForIndices,
                      AddressOf(GLTFModel.buffers[View.buffer].data[View.byteOffset]), View.byteLength);
@@ -229,15 +1127,87 @@ namespace Content
             Materials[ID++] = Material;
         }
 
-        // Parse each mesh from the model
+        // Optimize each primitive for the post-transform cache, overdraw and vertex fetch
+        Table<SInt32, UInt32> GLTFReferences;
+        for (ConstRef<tinygltf::Mesh> GLTFMesh : GLTFModel.meshes)
+        {
+            for (ConstRef<tinygltf::Primitive> GLTFPrimitive : GLTFMesh.primitives)
+            {
+                ++GLTFReferences[GLTFPrimitive.indices];
+
+                for (const auto & [Name, Accessor] : GLTFPrimitive.attributes)
+                {
+                    ++GLTFReferences[Accessor];
+                }
+            }
+        }
+
+        using Details = Array<Graphic::Mesh::Detail, Graphic::Mesh::k_MaxDetails>;
+
+        MeshOptimizer::Statistics Before;
+        MeshOptimizer::Statistics After;
+        Vector<UInt8>             BytesForDetails;
+        Vector<Details>           Levels(GLTFModel.meshes.size());
+
+        for (UInt32 ID = 0; ConstRef<tinygltf::Mesh> GLTFMesh : GLTFModel.meshes)
+        {
+            if (GLTFMesh.primitives.size() == 1)
+            {
+                OptimizePrimitive(
+                    GLTFModel,
+                    GLTFMesh.primitives[0],
+                    GLTFReferences,
+                    BlockForVertices,
+                    BlockForIndices,
+                    BytesForDetails,
+                    Levels[ID],
+                    Before,
+                    After);
+            }
+            ++ID;
+        }
+
+        if (Before.Triangles > 0)
+        {
+            Log::Info("GLTFLoader: Optimized '{}' ({} triangles), ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}",
+                Asset.GetKey().GetUrl(), Before.Triangles, Before.GetACMR(), After.GetACMR(), Before.GetATVR(), After.GetATVR());
+        }
+
+        // Parse the skeleton and its animation(s), only a single skin per model is supported
+        Vector<Graphic::Skin::Joint>     Joints;
+        Vector<Graphic::Skin::Stream>    Streams;
+        Vector<SPtr<Graphic::Animation>> Animations;
+        Table<SInt32, UInt32>            Mapping;
+        Vector<UInt32>                   Remap;
+        Matrix4f                         Root;
+
+        if (!GLTFModel.skins.empty())
+        {
+            if (GLTFModel.skins.size() > 1)
+            {
+                Log::Warn("GLTFLoader: Multiple skins unsupported, only the first one of '{}' is used", Asset.GetKey().GetUrl());
+            }
+
+            Root = LoadSkeleton(GLTFModel, GLTFModel.skins[0], BlockForVertices, BlockForIndices, Joints, Mapping, Remap);
+
+            for (ConstRef<tinygltf::Animation> GLTFAnimation : GLTFModel.animations)
+            {
+                Animations.emplace_back(LoadAnimation(GLTFModel, GLTFAnimation, Mapping, BlockForVertices, BlockForIndices));
+            }
+        }
+
+        // Parse each mesh from the model, quantizing the vertices into a new block
         const SPtr<Graphic::Mesh> Mesh = NewPtr<Graphic::Mesh>(Uri { Asset.GetKey() });
-        Mesh->Load(Move(BlockForVertices), Move(BlockForIndices));
 
-        for (ConstRef<tinygltf::Mesh> GLTFMesh : GLTFModel.meshes)
+        Vector<UInt8>                            BytesForAttributes;
+        Table<SInt32, Graphic::Mesh::Attribute> Attributes;
+
+        for (UInt32 ID = 0; ConstRef<tinygltf::Mesh> GLTFMesh : GLTFModel.meshes)
         {
             if (GLTFMesh.primitives.size() > 1)
             {
                 Log::Warn("GLTFLoader: Multiple primitives unsupported, skipping {}", GLTFMesh.name);
+                ++ID;
                 continue;
             }
 
@@ -246,23 +1216,86 @@ namespace Content
             // Parse material
             Graphic::Mesh::Primitive Primitive;
             Primitive.Material = static_cast<SInt8>(GLTFPrimitive.material);
+            Primitive.Details  = Levels[ID++];
+
+            // Parse bounds
+            if (const auto Position = GLTFPrimitive.attributes.find("POSITION"); Position != GLTFPrimitive.attributes.end())
+            {
+                ConstRef<tinygltf::Accessor> GLTFAccessor = GLTFModel.accessors[Position->second];
+
+                if (GLTFAccessor.minValues.size() == 3 && GLTFAccessor.maxValues.size() == 3)
+                {
+                    Primitive.Minimum = Vector3f(GLTFAccessor.minValues[0], GLTFAccessor.minValues[1], GLTFAccessor.minValues[2]);
+                    Primitive.Maximum = Vector3f(GLTFAccessor.maxValues[0], GLTFAccessor.maxValues[1], GLTFAccessor.maxValues[2]);
+                }
+                else if (GLTFAccessor.type == TINYGLTF_TYPE_VEC3
+                    && GLTFAccessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT && GLTFAccessor.count > 0
+                    && IsWithin(GLTFModel, GLTFAccessor, BlockForVertices, TINYGLTF_TARGET_ARRAY_BUFFER))
+                {
+                    ConstRef<tinygltf::BufferView> GLTFView = GLTFModel.bufferViews[GLTFAccessor.bufferView];
+
+                    const Ptr<const UInt8> Input  = BlockForVertices.GetData<UInt8>() + GLTFView.byteOffset + GLTFAccessor.byteOffset;
+                    const UInt32           Stride = GLTFAccessor.ByteStride(GLTFView);
+
+                    memcpy(AddressOf(Primitive.Minimum), Input, sizeof(Vector3f));
+                    Primitive.Maximum = Primitive.Minimum;
+
+                    for (UInt32 Vertex = 1; Vertex < GLTFAccessor.count; ++Vertex)
+                    {
+                        Vector3f Point;
+                        memcpy(AddressOf(Point), Input + Vertex * Stride, sizeof(Vector3f));
+
+                        Primitive.Minimum = Vector3f::Min(Primitive.Minimum, Point);
+                        Primitive.Maximum = Vector3f::Max(Primitive.Maximum, Point);
+                    }
+                }
+            }
+
+            // Parse skinning influences, which are kept on the CPU for deforming the primitive every frame
+            Graphic::Skin::Stream Stream;
+
+            const Bool Skinned = !Joints.empty()
+                && LoadInfluences(
+                    GLTFModel, GLTFPrimitive, Remap, Joints.size(), BlockForVertices, BlockForIndices, Stream);
+
+            if (Skinned)
+            {
+                Stream.Primitive = Mesh->GetPrimitives().size();
+                Streams.emplace_back(Move(Stream));
+            }
 
             // Parse vertices
             for (const auto & [Name, Accessor] : GLTFPrimitive.attributes)
             {
-                ConstRef<tinygltf::Accessor>   GLTFAccessor = GLTFModel.accessors[Accessor];
-                ConstRef<tinygltf::BufferView> GLTFView     = GLTFModel.bufferViews[GLTFAccessor.bufferView];
+                const Graphic::VertexSemantic Semantic = As(Name);
 
-                const UInt32 Length = tinygltf::GetComponentSizeInBytes(GLTFAccessor.componentType)
-                                    * tinygltf::GetNumComponentsInType(GLTFAccessor.type)
-                                    * GLTFAccessor.count;
-                const UInt32 Offset = GLTFView.byteOffset + GLTFAccessor.byteOffset;
-                const UInt32 Stride = GLTFAccessor.ByteStride(GLTFView);
+                if (Semantic == Graphic::VertexSemantic::None)
+                {
+                    continue;
+                }
+
+                auto Iterator = Attributes.find(Accessor);
 
-                if (const Graphic::VertexSemantic Semantic = As(Name); Semantic != Graphic::VertexSemantic::None)
+                if (Iterator == Attributes.end())
                 {
-                    Primitive.Attributes[CastEnum(Semantic)] = { Length, Offset, Stride };
+                    Graphic::Mesh::Attribute Attribute;
+
+                    if (!QuantizeAttribute(
+                        GLTFModel,
+                        GLTFModel.accessors[Accessor],
+                        Semantic,
+                        BlockForVertices,
+                        Primitive,
+                        Skinned,
+                        BytesForAttributes,
+                        Attribute))
+                    {
+                        Log::Warn("GLTFLoader: Unsupported attribute {} of {}", Name, GLTFMesh.name);
+                        continue;
+                    }
+                    Iterator = Attributes.emplace(Accessor, Attribute).first;
                 }
+                Primitive.Attributes[CastEnum(Semantic)] = Iterator->second;
             }
 
             // Parse indices
@@ -278,13 +1311,30 @@ namespace Content
                 const UInt32 Stride = GLTFAccessor.ByteStride(GLTFView);
 
                 Primitive.Indices = { Length, Offset, Stride };
+                Primitive.Details[0].Indices = Primitive.Indices;
             }
 
             // Continue with the next submesh
             Mesh->AddPrimitive(Move(Primitive));
         }
 
+        Log::Info("GLTFLoader: Quantized '{}' vertices from {} to {} bytes",
+            Asset.GetKey().GetUrl(), BlockForVertices.GetSize(), BytesForAttributes.size());
+
+        Data BlockForAttributes(BytesForAttributes.size());
+        memcpy(BlockForAttributes.GetData<UInt8>(), BytesForAttributes.data(), BytesForAttributes.size());
+
+        Data BlockForElements(BlockForIndices.GetSize() + BytesForDetails.size());
+        memcpy(BlockForElements.GetData<UInt8>(), BlockForIndices.GetData<UInt8>(), BlockForIndices.GetSize());
+        memcpy(BlockForElements.GetData<UInt8>() + BlockForIndices.GetSize(), BytesForDetails.data(), BytesForDetails.size());
+
+        Mesh->Load(Move(BlockForAttributes), Move(BlockForElements));
         Asset.Load(Mesh, Move(Materials));
+
+        if (!Joints.empty())
+        {
+            Asset.SetSkin(NewPtr<Graphic::Skin>(Root, Move(Joints), Move(Streams)), Move(Animations));
+        }
         return true;
     }
 }
\ No newline at end of file
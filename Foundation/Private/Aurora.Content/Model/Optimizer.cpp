@@ -0,0 +1,342 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Optimizer.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    MeshOptimizer::Statistics MeshOptimizer::Analyze(CPtr<const UInt32> Indices, UInt32 Vertices, UInt32 CacheSize)
+    {
+        Statistics Result;
+        Result.Triangles = Indices.size() / 3;
+
+        // Simulate a FIFO post-transform cache, a vertex is resident while fewer than
+        // CacheSize misses happened since it was last inserted.
+        Vector<UInt32> Timestamps(Vertices, 0);
+        UInt32         Time = CacheSize + 1;
+
+        for (const UInt32 Index : Indices)
+        {
+            if (Timestamps[Index] == 0)
+            {
+                ++Result.Vertices;
+            }
+
+            if (Time - Timestamps[Index] > CacheSize)
+            {
+                Timestamps[Index] = Time++;
+                ++Result.Misses;
+            }
+        }
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector<UInt32> MeshOptimizer::OptimizeVertexCache(CPtr<UInt32> Indices, UInt32 Vertices, UInt32 CacheSize)
+    {
+        Vector<UInt32> Clusters;
+
+        const UInt32 Triangles = Indices.size() / 3;
+        if (Triangles == 0)
+        {
+            return Clusters;
+        }
+
+        // Build the vertex to triangle adjacency, the live count of each vertex is the amount
+        // of triangles still waiting to be emitted that reference it.
+        Vector<UInt32> Live(Vertices, 0);
+        Vector<UInt32> Offsets(Vertices + 1, 0);
+        Vector<UInt32> Adjacency(Triangles * 3);
+
+        for (const UInt32 Index : Indices)
+        {
+            ++Live[Index];
+        }
+
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            Offsets[Vertex + 1] = Offsets[Vertex] + Live[Vertex];
+        }
+
+        Vector<UInt32> Fill(Offsets.begin(), Offsets.end() - 1);
+        for (UInt32 Triangle = 0; Triangle < Triangles; ++Triangle)
+        {
+            for (UInt32 Corner = 0; Corner < 3; ++Corner)
+            {
+                Adjacency[Fill[Indices[Triangle * 3 + Corner]]++] = Triangle;
+            }
+        }
+
+        // Tipsify (Sander, Nehab and Barczak 2007), fan around the vertex that will stay longer in
+        // the cache, falling back to recently used vertices and finally to a linear scan. Every time
+        // the linear scan is hit the cache is effectively cold, which is where a cluster starts.
+        Vector<UInt32> Output;
+        Vector<UInt32> Candidates;
+        Vector<UInt32> DeadEnd;
+        Vector<Bool>   Emitted(Triangles, false);
+        Vector<UInt32> Timestamps(Vertices, 0);
+        UInt32         Time    = CacheSize + 1;
+        UInt32         Scan    = 0;
+        UInt32         Fanning = k_Invalid;
+
+        Output.reserve(Indices.size());
+        DeadEnd.reserve(Indices.size());
+
+        do
+        {
+            if (Fanning == k_Invalid)
+            {
+                while (Scan < Vertices && Live[Scan] == 0)
+                {
+                    ++Scan;
+                }
+
+                if (Scan == Vertices)
+                {
+                    break;
+                }
+
+                Fanning = Scan;
+                Clusters.push_back(Output.size() / 3);
+            }
+
+            Candidates.clear();
+
+            for (UInt32 Slot = Offsets[Fanning]; Slot < Offsets[Fanning + 1]; ++Slot)
+            {
+                const UInt32 Triangle = Adjacency[Slot];
+
+                if (Emitted[Triangle])
+                {
+                    continue;
+                }
+                Emitted[Triangle] = true;
+
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const UInt32 Vertex = Indices[Triangle * 3 + Corner];
+
+                    Output.push_back(Vertex);
+                    DeadEnd.push_back(Vertex);
+                    Candidates.push_back(Vertex);
+
+                    --Live[Vertex];
+
+                    if (Time - Timestamps[Vertex] > CacheSize)
+                    {
+                        Timestamps[Vertex] = Time++;
+                    }
+                }
+            }
+
+            // Pick the candidate that will still be in the cache after emitting all of its triangles,
+            // preferring the oldest one so the newer entries survive for the next fan.
+            UInt32 Priority = 0;
+            Fanning = k_Invalid;
+
+            for (const UInt32 Vertex : Candidates)
+            {
+                if (Live[Vertex] == 0)
+                {
+                    continue;
+                }
+
+                const UInt32 Age   = Time - Timestamps[Vertex];
+                const UInt32 Score = (Age + 2 * Live[Vertex] <= CacheSize ? Age : 0);
+
+                if (Fanning == k_Invalid || Score > Priority)
+                {
+                    Fanning  = Vertex;
+                    Priority = Score;
+                }
+            }
+
+            while (Fanning == k_Invalid && !DeadEnd.empty())
+            {
+                const UInt32 Vertex = DeadEnd.back();
+                DeadEnd.pop_back();
+
+                if (Live[Vertex] > 0)
+                {
+                    Fanning = Vertex;
+                }
+            }
+        }
+        while (true);
+
+        std::copy(Output.begin(), Output.end(), Indices.begin());
+        return Clusters;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void MeshOptimizer::OptimizeOverdraw(
+        CPtr<UInt32> Indices, CPtr<const Vector3f> Positions, CPtr<const UInt32> Clusters, UInt32 CacheSize, Real32 Threshold)
+    {
+        const UInt32 Triangles = Indices.size() / 3;
+        if (Triangles == 0 || Clusters.empty())
+        {
+            return;
+        }
+
+        // Split the hard clusters further wherever the cluster has amortized the cold cache well
+        // enough, so reordering them does not cost more than the threshold over the current ACMR.
+        const Real32   Limit = Analyze(Indices, Positions.size(), CacheSize).GetACMR() * Threshold;
+        Vector<UInt32> Boundaries;
+        Vector<UInt32> Timestamps(Positions.size(), 0);
+        UInt32         Time = CacheSize + 1;
+
+        for (UInt32 Cluster = 0; Cluster < Clusters.size(); ++Cluster)
+        {
+            const UInt32 End   = (Cluster + 1 < Clusters.size() ? Clusters[Cluster + 1] : Triangles);
+            UInt32       Start = Clusters[Cluster];
+            UInt32       Miss  = 0;
+
+            Boundaries.push_back(Start);
+            Time += CacheSize + 1;
+
+            for (UInt32 Triangle = Start; Triangle < End; ++Triangle)
+            {
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    if (const UInt32 Vertex = Indices[Triangle * 3 + Corner]; Time - Timestamps[Vertex] > CacheSize)
+                    {
+                        Timestamps[Vertex] = Time++;
+                        ++Miss;
+                    }
+                }
+
+                if (Triangle + 1 < End && static_cast<Real32>(Miss) / (Triangle - Start + 1) <= Limit)
+                {
+                    Start = Triangle + 1;
+                    Miss  = 0;
+                    Time += CacheSize + 1;
+                    Boundaries.push_back(Start);
+                }
+            }
+        }
+
+        // Sort the clusters so the ones facing away from the center of the mesh are drawn first, they are
+        // the most likely to occlude the rest of the mesh (Sander, Nehab and Barczak 2007).
+        Vector3f       Center;
+        Real32         Area = 0.0f;
+        Vector<Real32> Keys(Boundaries.size());
+
+        for (UInt32 Triangle = 0; Triangle < Triangles; ++Triangle)
+        {
+            ConstRef<Vector3f> P0 = Positions[Indices[Triangle * 3 + 0]];
+            ConstRef<Vector3f> P1 = Positions[Indices[Triangle * 3 + 1]];
+            ConstRef<Vector3f> P2 = Positions[Indices[Triangle * 3 + 2]];
+
+            const Real32 Weight = Vector3f::Cross(P1 - P0, P2 - P0).GetLength();
+            Center += (P0 + P1 + P2) * (Weight / 3.0f);
+            Area   += Weight;
+        }
+
+        if (Area > 0.0f)
+        {
+            Center /= Area;
+        }
+
+        for (UInt32 Cluster = 0; Cluster < Boundaries.size(); ++Cluster)
+        {
+            const UInt32 End = (Cluster + 1 < Boundaries.size() ? Boundaries[Cluster + 1] : Triangles);
+
+            Vector3f Centroid;
+            Vector3f Normal;
+            Real32   Weight = 0.0f;
+
+            for (UInt32 Triangle = Boundaries[Cluster]; Triangle < End; ++Triangle)
+            {
+                ConstRef<Vector3f> P0 = Positions[Indices[Triangle * 3 + 0]];
+                ConstRef<Vector3f> P1 = Positions[Indices[Triangle * 3 + 1]];
+                ConstRef<Vector3f> P2 = Positions[Indices[Triangle * 3 + 2]];
+
+                const Vector3f Face   = Vector3f::Cross(P1 - P0, P2 - P0);
+                const Real32   Length = Face.GetLength();
+
+                Centroid += (P0 + P1 + P2) * (Length / 3.0f);
+                Normal   += Face;
+                Weight   += Length;
+            }
+
+            if (Weight > 0.0f)
+            {
+                Centroid /= Weight;
+            }
+            Keys[Cluster] = (Centroid - Center).Dot(Vector3f::Normalize(Normal));
+        }
+
+        Vector<UInt32> Order(Boundaries.size());
+        for (UInt32 Cluster = 0; Cluster < Order.size(); ++Cluster)
+        {
+            Order[Cluster] = Cluster;
+        }
+
+        Sort(Order, [&Keys](UInt32 First, UInt32 Second)
+        {
+            return Keys[First] > Keys[Second] || (Keys[First] == Keys[Second] && First < Second);
+        });
+
+        Vector<UInt32> Output;
+        Output.reserve(Indices.size());
+
+        for (const UInt32 Cluster : Order)
+        {
+            const UInt32 End = (Cluster + 1 < Boundaries.size() ? Boundaries[Cluster + 1] : Triangles);
+            Output.insert(Output.end(), Indices.begin() + Boundaries[Cluster] * 3, Indices.begin() + End * 3);
+        }
+        std::copy(Output.begin(), Output.end(), Indices.begin());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 MeshOptimizer::OptimizeVertexFetch(CPtr<UInt32> Indices, UInt32 Vertices, Ref<Vector<UInt32>> Remap)
+    {
+        // Renumber the vertices in the order they are first referenced, so the vertex fetch walks
+        // memory linearly, unreferenced vertices are moved to the end of the buffer.
+        Remap.assign(Vertices, k_Invalid);
+
+        UInt32 Next = 0;
+
+        for (Ref<UInt32> Index : Indices)
+        {
+            if (Remap[Index] == k_Invalid)
+            {
+                Remap[Index] = Next++;
+            }
+            Index = Remap[Index];
+        }
+
+        const UInt32 Referenced = Next;
+
+        for (Ref<UInt32> Slot : Remap)
+        {
+            if (Slot == k_Invalid)
+            {
+                Slot = Next++;
+            }
+        }
+        return Referenced;
+    }
+}
\ No newline at end of file
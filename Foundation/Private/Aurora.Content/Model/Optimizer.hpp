@@ -0,0 +1,92 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Vector3.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=(Undocumented)=-
+    class MeshOptimizer final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_CacheSize         = 16;
+
+        // -=(Undocumented)=-
+        static constexpr Real32 k_OverdrawThreshold = 1.05f;
+
+        // -=(Undocumented)=-
+        struct Statistics
+        {
+            // -=(Undocumented)=-
+            UInt32 Triangles = 0;
+
+            // -=(Undocumented)=-
+            UInt32 Vertices  = 0;
+
+            // -=(Undocumented)=-
+            UInt32 Misses    = 0;
+
+            // -=(Undocumented)=-
+            Real32 GetACMR() const
+            {
+                return Triangles > 0 ? static_cast<Real32>(Misses) / Triangles : 0.0f;
+            }
+
+            // -=(Undocumented)=-
+            Real32 GetATVR() const
+            {
+                return Vertices > 0 ? static_cast<Real32>(Misses) / Vertices : 0.0f;
+            }
+
+            // -=(Undocumented)=-
+            Ref<Statistics> operator+=(ConstRef<Statistics> Other)
+            {
+                Triangles += Other.Triangles;
+                Vertices  += Other.Vertices;
+                Misses    += Other.Misses;
+                return (* this);
+            }
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        static Statistics Analyze(CPtr<const UInt32> Indices, UInt32 Vertices, UInt32 CacheSize = k_CacheSize);
+
+        // -=(Undocumented)=-
+        static Vector<UInt32> OptimizeVertexCache(CPtr<UInt32> Indices, UInt32 Vertices, UInt32 CacheSize = k_CacheSize);
+
+        // -=(Undocumented)=-
+        static void OptimizeOverdraw(
+            CPtr<UInt32> Indices,
+            CPtr<const Vector3f> Positions,
+            CPtr<const UInt32> Clusters,
+            UInt32 CacheSize = k_CacheSize,
+            Real32 Threshold = k_OverdrawThreshold);
+
+        // -=(Undocumented)=-
+        static UInt32 OptimizeVertexFetch(CPtr<UInt32> Indices, UInt32 Vertices, Ref<Vector<UInt32>> Remap);
+
+    private:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Invalid = ~0u;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Quantizer.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt16 MeshQuantizer::EncodeHalf(Real32 Value)
+    {
+        UInt32 Bits;
+        memcpy(AddressOf(Bits), AddressOf(Value), sizeof(Bits));
+
+        const UInt32 Sign     = (Bits >> 16) & 0x8000;
+        const SInt32 Exponent = static_cast<SInt32>((Bits >> 23) & 0xFF) - 127 + 15;
+        UInt32       Mantissa = Bits & 0x007FFFFF;
+
+        // Infinity and NaN keep their class, NaN is kept quiet.
+        if (((Bits >> 23) & 0xFF) == 0xFF)
+        {
+            return static_cast<UInt16>(Sign | 0x7C00 | (Mantissa ? 0x0200 : 0));
+        }
+
+        // Overflow saturates to infinity.
+        if (Exponent >= 31)
+        {
+            return static_cast<UInt16>(Sign | 0x7C00);
+        }
+
+        // Underflow produces a denormal or a signed zero.
+        if (Exponent <= 0)
+        {
+            if (Exponent < -10)
+            {
+                return static_cast<UInt16>(Sign);
+            }
+
+            Mantissa |= 0x00800000;
+
+            const UInt32 Shift = 14 - Exponent;
+            const UInt32 Half  = (Mantissa >> Shift) + ((Mantissa >> (Shift - 1)) & 1);
+            return static_cast<UInt16>(Sign | Half);
+        }
+
+        // Round to nearest, a carry out of the mantissa correctly bumps the exponent.
+        const UInt32 Half = (Sign | (static_cast<UInt32>(Exponent) << 10) | (Mantissa >> 13)) + ((Mantissa >> 12) & 1);
+        return static_cast<UInt16>(Half);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SInt16 MeshQuantizer::EncodeSNorm16(Real32 Value)
+    {
+        const Real32 Scaled = Clamp(Value, -1.0f, +1.0f) * 32767.0f;
+        return static_cast<SInt16>(Scaled + (Scaled >= 0.0f ? 0.5f : -0.5f));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt16 MeshQuantizer::EncodeUNorm16(Real32 Value)
+    {
+        return static_cast<UInt16>(Clamp(Value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Array<SInt16, 2> MeshQuantizer::EncodeOctahedral(ConstRef<Vector3f> Normal)
+    {
+        // Project the unit sphere onto the octahedron and unfold the lower hemisphere over the upper one,
+        // the shader reverses it with n = (x, y, 1 - |x| - |y|) and n.xy -= sign(n.xy) * max(-n.z, 0).
+        const Real32 Norm = Abs(Normal.GetX()) + Abs(Normal.GetY()) + Abs(Normal.GetZ());
+
+        if (Norm <= 0.0f)
+        {
+            return { 0, 0 };
+        }
+
+        Real32 X = Normal.GetX() / Norm;
+        Real32 Y = Normal.GetY() / Norm;
+
+        if (Normal.GetZ() < 0.0f)
+        {
+            const Real32 Fold = X;
+            X = (1.0f - Abs(Y))    * (Fold >= 0.0f ? 1.0f : -1.0f);
+            Y = (1.0f - Abs(Fold)) * (Y    >= 0.0f ? 1.0f : -1.0f);
+        }
+        return { EncodeSNorm16(X), EncodeSNorm16(Y) };
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Array<UInt16, 4> MeshQuantizer::EncodePosition(ConstRef<Vector3f> Position, ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum)
+    {
+        const Vector3f Extent = Maximum - Minimum;
+        const Vector3f Offset = Position - Minimum;
+
+        return {
+            EncodeUNorm16(Extent.GetX() > 0.0f ? Offset.GetX() / Extent.GetX() : 0.0f),
+            EncodeUNorm16(Extent.GetY() > 0.0f ? Offset.GetY() / Extent.GetY() : 0.0f),
+            EncodeUNorm16(Extent.GetZ() > 0.0f ? Offset.GetZ() / Extent.GetZ() : 0.0f),
+            UINT16_MAX
+        };
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Real32 MeshQuantizer::DecodeSNorm16(SInt16 Value)
+    {
+        return Max(static_cast<Real32>(Value) / 32767.0f, -1.0f);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Real32 MeshQuantizer::DecodeUNorm16(UInt16 Value)
+    {
+        return static_cast<Real32>(Value) / 65535.0f;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector3f MeshQuantizer::DecodeOctahedral(ConstRef<Array<SInt16, 2>> Value)
+    {
+        Real32 X = DecodeSNorm16(Value[0]);
+        Real32 Y = DecodeSNorm16(Value[1]);
+
+        const Real32 Z    = 1.0f - Abs(X) - Abs(Y);
+        const Real32 Fold = Max(-Z, 0.0f);
+
+        X -= (X >= 0.0f ? Fold : -Fold);
+        Y -= (Y >= 0.0f ? Fold : -Fold);
+        return Vector3f::Normalize(Vector3f(X, Y, Z));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector3f MeshQuantizer::DecodePosition(ConstRef<Array<UInt16, 4>> Value, ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum)
+    {
+        const Vector3f Extent = Maximum - Minimum;
+
+        return Vector3f(
+            Minimum.GetX() + DecodeUNorm16(Value[0]) * Extent.GetX(),
+            Minimum.GetY() + DecodeUNorm16(Value[1]) * Extent.GetY(),
+            Minimum.GetZ() + DecodeUNorm16(Value[2]) * Extent.GetZ());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Vector3.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=(Undocumented)=-
+    class MeshQuantizer final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static UInt16 EncodeHalf(Real32 Value);
+
+        // -=(Undocumented)=-
+        static SInt16 EncodeSNorm16(Real32 Value);
+
+        // -=(Undocumented)=-
+        static UInt16 EncodeUNorm16(Real32 Value);
+
+        // -=(Undocumented)=-
+        static Array<SInt16, 2> EncodeOctahedral(ConstRef<Vector3f> Normal);
+
+        // -=(Undocumented)=-
+        static Array<UInt16, 4> EncodePosition(ConstRef<Vector3f> Position, ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum);
+
+        // -=(Undocumented)=-
+        static Real32 DecodeSNorm16(SInt16 Value);
+
+        // -=(Undocumented)=-
+        static Real32 DecodeUNorm16(UInt16 Value);
+
+        // -=(Undocumented)=-
+        static Vector3f DecodeOctahedral(ConstRef<Array<SInt16, 2>> Value);
+
+        // -=(Undocumented)=-
+        static Vector3f DecodePosition(ConstRef<Array<UInt16, 4>> Value, ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum);
+    };
+}
\ No newline at end of file
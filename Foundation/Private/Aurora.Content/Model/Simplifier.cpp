@@ -0,0 +1,365 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Simplifier.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Real32 MeshSimplifier::Simplify(CPtr<const UInt32> Indices, CPtr<const Vector3f> Positions, UInt32 Target, Ref<Vector<UInt32>> Output)
+    {
+        const UInt32 Vertices = Positions.size();
+
+        Output.assign(Indices.begin(), Indices.end());
+
+        if (Target >= Output.size() || Vertices == 0)
+        {
+            return 0.0f;
+        }
+
+        // Normalize the positions into the unit cube, so the quadrics keep their precision
+        // regardless of the scale of the mesh.
+        Vector3f Minimum = Positions[0];
+        Vector3f Maximum = Positions[0];
+
+        for (ConstRef<Vector3f> Position : Positions)
+        {
+            Minimum = Vector3f::Min(Minimum, Position);
+            Maximum = Vector3f::Max(Maximum, Position);
+        }
+
+        const Vector3f Extent = Maximum - Minimum;
+        const Real32   Scale  = Max(Max(Extent.GetX(), Extent.GetY()), Extent.GetZ());
+
+        if (Scale <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        Vector<Vector3f> Points(Vertices);
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            Points[Vertex] = (Positions[Vertex] - Minimum) / Scale;
+        }
+
+        // Weld the vertices by position, vertices sharing a position with different attributes
+        // are seams (UV, normal or color discontinuities) and are never moved.
+        Vector<UInt32> Order(Vertices);
+        Vector<UInt32> Wedges(Vertices);
+        Vector<UInt32> Copies(Vertices, 0);
+
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            Order[Vertex] = Vertex;
+        }
+
+        Sort(Order, [&Points](UInt32 First, UInt32 Second)
+        {
+            ConstRef<Vector3f> P0 = Points[First];
+            ConstRef<Vector3f> P1 = Points[Second];
+
+            if (P0.GetX() != P1.GetX()) return P0.GetX() < P1.GetX();
+            if (P0.GetY() != P1.GetY()) return P0.GetY() < P1.GetY();
+            if (P0.GetZ() != P1.GetZ()) return P0.GetZ() < P1.GetZ();
+            return First < Second;
+        });
+
+        for (UInt32 Element = 0; Element < Vertices; ++Element)
+        {
+            const UInt32 Vertex = Order[Element];
+            const UInt32 Wedge  = (Element > 0 && Points[Order[Element - 1]] == Points[Vertex] ? Wedges[Order[Element - 1]] : Vertex);
+
+            Wedges[Vertex] = Wedge;
+            ++Copies[Wedge];
+        }
+
+        // Lock the seams and the open or non-manifold borders, so silhouettes and texture charts are kept.
+        Vector<Bool>          Locked(Vertices, false);
+        Table<UInt64, UInt32> Edges;
+
+        for (UInt32 Element = 0; Element < Output.size(); Element += 3)
+        {
+            for (UInt32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const UInt64 V0 = Wedges[Output[Element + Corner]];
+                const UInt64 V1 = Wedges[Output[Element + (Corner + 1) % 3]];
+
+                ++Edges[V0 < V1 ? (V0 << 32 | V1) : (V1 << 32 | V0)];
+            }
+        }
+
+        for (const auto & [Edge, Count] : Edges)
+        {
+            if (Count != 2)
+            {
+                Locked[Edge >> 32]        = true;
+                Locked[Edge & 0xFFFFFFFF] = true;
+            }
+        }
+
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            Locked[Vertex] = Locked[Wedges[Vertex]] || Copies[Wedges[Vertex]] > 1;
+        }
+
+        // Accumulate the plane quadric of every triangle into its welded vertices.
+        Vector<Quadric> Quadrics(Vertices);
+
+        for (UInt32 Element = 0; Element < Output.size(); Element += 3)
+        {
+            ConstRef<Vector3f> P0 = Points[Output[Element + 0]];
+            ConstRef<Vector3f> P1 = Points[Output[Element + 1]];
+            ConstRef<Vector3f> P2 = Points[Output[Element + 2]];
+
+            const Vector3f Normal = Vector3f::Cross(P1 - P0, P2 - P0);
+            const Real32   Area   = Normal.GetLength();
+
+            if (Area > 0.0f)
+            {
+                const Vector3f Direction = Normal / Area;
+
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    Quadrics[Wedges[Output[Element + Corner]]].Add(Direction, -Direction.Dot(P0), Area);
+                }
+            }
+        }
+
+        // Collapse edges in passes, each pass applies the cheapest collapses whose neighbourhoods don't
+        // overlap, merging the source vertex into an existing one so every level shares the vertex buffer.
+        Vector<Collapse> Candidates;
+        Vector<UInt32>   Remap(Vertices);
+        Vector<Bool>     Touched(Vertices);
+        Vector<UInt32>   Offsets(Vertices + 1);
+        Vector<UInt32>   Adjacency;
+        Real64           Error = 0.0;
+
+        while (Output.size() > Target)
+        {
+            const UInt32 Triangles = Output.size() / 3;
+
+            // Build the vertex to triangle adjacency of the current level.
+            std::fill(Offsets.begin(), Offsets.end(), 0);
+
+            for (const UInt32 Index : Output)
+            {
+                ++Offsets[Index + 1];
+            }
+
+            for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+            {
+                Offsets[Vertex + 1] += Offsets[Vertex];
+            }
+
+            Adjacency.resize(Output.size());
+
+            Vector<UInt32> Fill(Offsets.begin(), Offsets.end() - 1);
+            for (UInt32 Element = 0; Element < Output.size(); ++Element)
+            {
+                Adjacency[Fill[Output[Element]]++] = Element / 3;
+            }
+
+            // Gather every collapse along the edges of the current level.
+            Candidates.clear();
+
+            for (UInt32 Element = 0; Element < Output.size(); Element += 3)
+            {
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const UInt32 V0 = Output[Element + Corner];
+                    const UInt32 V1 = Output[Element + (Corner + 1) % 3];
+
+                    Quadric Combined = Quadrics[Wedges[V0]];
+                    Combined.Add(Quadrics[Wedges[V1]]);
+
+                    if (!Locked[V0])
+                    {
+                        Candidates.push_back({ V0, V1, Combined.Evaluate(Points[V1]) });
+                    }
+                    if (!Locked[V1])
+                    {
+                        Candidates.push_back({ V1, V0, Combined.Evaluate(Points[V0]) });
+                    }
+                }
+            }
+
+            Sort(Candidates, [](ConstRef<Collapse> First, ConstRef<Collapse> Second)
+            {
+                return First.Cost < Second.Cost;
+            });
+
+            // Apply the cheapest collapses first, rejecting the ones that would flip a triangle.
+            const UInt32 Removable = (Output.size() - Target) / 3;
+            UInt32       Removed   = 0;
+
+            for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+            {
+                Remap[Vertex]   = Vertex;
+                Touched[Vertex] = false;
+            }
+
+            for (ConstRef<Collapse> Candidate : Candidates)
+            {
+                if (Removed >= Removable)
+                {
+                    break;
+                }
+
+                if (Touched[Candidate.Source] || Touched[Candidate.Target])
+                {
+                    continue;
+                }
+
+                Bool   Flipped = false;
+                UInt32 Dropped = 0;
+
+                for (UInt32 Slot = Offsets[Candidate.Source]; Slot < Offsets[Candidate.Source + 1] && !Flipped; ++Slot)
+                {
+                    const Ptr<const UInt32> Triangle = Output.data() + Adjacency[Slot] * 3;
+
+                    if (Triangle[0] == Candidate.Target || Triangle[1] == Candidate.Target || Triangle[2] == Candidate.Target)
+                    {
+                        ++Dropped;
+                        continue;
+                    }
+
+                    Array<Vector3f, 3> Corners;
+                    for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                    {
+                        Corners[Corner] = Points[Triangle[Corner]];
+                    }
+
+                    const Vector3f Before = Vector3f::Cross(Corners[1] - Corners[0], Corners[2] - Corners[0]);
+
+                    for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                    {
+                        if (Triangle[Corner] == Candidate.Source)
+                        {
+                            Corners[Corner] = Points[Candidate.Target];
+                        }
+                    }
+
+                    const Vector3f After = Vector3f::Cross(Corners[1] - Corners[0], Corners[2] - Corners[0]);
+                    Flipped = (Before.Dot(After) <= 0.0f);
+                }
+
+                if (Flipped || Dropped == 0)
+                {
+                    continue;
+                }
+
+                // Lock the whole neighbourhood of the collapse until the next pass.
+                for (UInt32 Slot = Offsets[Candidate.Source]; Slot < Offsets[Candidate.Source + 1]; ++Slot)
+                {
+                    const Ptr<const UInt32> Triangle = Output.data() + Adjacency[Slot] * 3;
+
+                    Touched[Triangle[0]] = true;
+                    Touched[Triangle[1]] = true;
+                    Touched[Triangle[2]] = true;
+                }
+
+                Remap[Candidate.Source] = Candidate.Target;
+                Quadrics[Wedges[Candidate.Target]].Add(Quadrics[Wedges[Candidate.Source]]);
+
+                Error    = Max(Error, Candidate.Cost);
+                Removed += Dropped;
+            }
+
+            if (Removed == 0)
+            {
+                break;
+            }
+
+            // Rewrite the triangles and drop the degenerated ones.
+            UInt32 Written = 0;
+
+            for (UInt32 Triangle = 0; Triangle < Triangles; ++Triangle)
+            {
+                const UInt32 V0 = Remap[Output[Triangle * 3 + 0]];
+                const UInt32 V1 = Remap[Output[Triangle * 3 + 1]];
+                const UInt32 V2 = Remap[Output[Triangle * 3 + 2]];
+
+                if (V0 != V1 && V1 != V2 && V0 != V2)
+                {
+                    Output[Written++] = V0;
+                    Output[Written++] = V1;
+                    Output[Written++] = V2;
+                }
+            }
+            Output.resize(Written);
+        }
+        return static_cast<Real32>(Sqrt(Error)) * Scale;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void MeshSimplifier::Quadric::Add(ConstRef<Quadric> Other)
+    {
+        XX += Other.XX;
+        XY += Other.XY;
+        XZ += Other.XZ;
+        XW += Other.XW;
+        YY += Other.YY;
+        YZ += Other.YZ;
+        YW += Other.YW;
+        ZZ += Other.ZZ;
+        ZW += Other.ZW;
+        WW += Other.WW;
+        Weight += Other.Weight;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void MeshSimplifier::Quadric::Add(ConstRef<Vector3f> Normal, Real32 Distance, Real32 Area)
+    {
+        const Real64 A = Normal.GetX();
+        const Real64 B = Normal.GetY();
+        const Real64 C = Normal.GetZ();
+        const Real64 D = Distance;
+
+        XX += A * A * Area;
+        XY += A * B * Area;
+        XZ += A * C * Area;
+        XW += A * D * Area;
+        YY += B * B * Area;
+        YZ += B * C * Area;
+        YW += B * D * Area;
+        ZZ += C * C * Area;
+        ZW += C * D * Area;
+        WW += D * D * Area;
+        Weight += Area;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Real64 MeshSimplifier::Quadric::Evaluate(ConstRef<Vector3f> Point) const
+    {
+        const Real64 X = Point.GetX();
+        const Real64 Y = Point.GetY();
+        const Real64 Z = Point.GetZ();
+
+        const Real64 Sum = XX * X * X + 2.0 * XY * X * Y + 2.0 * XZ * X * Z + 2.0 * XW * X
+                         + YY * Y * Y + 2.0 * YZ * Y * Z + 2.0 * YW * Y
+                         + ZZ * Z * Z + 2.0 * ZW * Z
+                         + WW;
+        return Weight > 0.0 ? Abs(Sum) / Weight : 0.0;
+    }
+}
\ No newline at end of file
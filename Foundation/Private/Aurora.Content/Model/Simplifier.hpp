@@ -0,0 +1,74 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Vector3.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=(Undocumented)=-
+    class MeshSimplifier final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static Real32 Simplify(CPtr<const UInt32> Indices, CPtr<const Vector3f> Positions, UInt32 Target, Ref<Vector<UInt32>> Output);
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Quadric
+        {
+            // -=(Undocumented)=-
+            Real64 XX = 0, XY = 0, XZ = 0, XW = 0;
+
+            // -=(Undocumented)=-
+            Real64 YY = 0, YZ = 0, YW = 0;
+
+            // -=(Undocumented)=-
+            Real64 ZZ = 0, ZW = 0;
+
+            // -=(Undocumented)=-
+            Real64 WW = 0;
+
+            // -=(Undocumented)=-
+            Real64 Weight = 0;
+
+            // -=(Undocumented)=-
+            void Add(ConstRef<Quadric> Other);
+
+            // -=(Undocumented)=-
+            void Add(ConstRef<Vector3f> Normal, Real32 Distance, Real32 Area);
+
+            // -=(Undocumented)=-
+            Real64 Evaluate(ConstRef<Vector3f> Point) const;
+        };
+
+        // -=(Undocumented)=-
+        struct Collapse
+        {
+            // -=(Undocumented)=-
+            UInt32 Source;
+
+            // -=(Undocumented)=-
+            UInt32 Target;
+
+            // -=(Undocumented)=-
+            Real64 Cost;
+        };
+    };
+}
\ No newline at end of file
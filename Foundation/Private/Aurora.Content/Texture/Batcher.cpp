@@ -0,0 +1,135 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Batcher.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TextureBatcher::Add(ConstSPtr<Graphic::Texture> Texture)
+    {
+        // The texels are needed on the CPU, which only readable texture(s) keep after being created.
+        if (!Texture->GetData().HasData())
+        {
+            Log::Warn("TextureBatcher: '{}' is not readable, skipping", Texture->GetKey().GetUrl());
+            return;
+        }
+
+        // Arrays can't be nested, and multisampled texture(s) can't be initialized from memory.
+        if (Texture->IsArray() || Texture->GetSamples() > 1)
+        {
+            Log::Warn("TextureBatcher: Unsupported texture '{}', skipping", Texture->GetKey().GetUrl());
+            return;
+        }
+
+        mTextures.emplace_back(Texture);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector<TextureBatcher::Batch> TextureBatcher::Bake(ConstRef<Uri> Key)
+    {
+        Vector<Batch> Batches;
+
+        // Group the texture(s) sharing the same format, size and chain of level(s).
+        Sort(mTextures, [](ConstSPtr<Graphic::Texture> First, ConstSPtr<Graphic::Texture> Second)
+        {
+            if (First->GetFormat() != Second->GetFormat())
+            {
+                return First->GetFormat() < Second->GetFormat();
+            }
+            if (First->GetWidth() != Second->GetWidth())
+            {
+                return First->GetWidth() < Second->GetWidth();
+            }
+            if (First->GetHeight() != Second->GetHeight())
+            {
+                return First->GetHeight() < Second->GetHeight();
+            }
+            if (First->GetLevel() != Second->GetLevel())
+            {
+                return First->GetLevel() < Second->GetLevel();
+            }
+            return First->GetLayout() < Second->GetLayout();
+        });
+
+        // Cut each group into array(s) of up to the maximum number of layer(s).
+        for (UInt32 First = 0; First < mTextures.size();)
+        {
+            UInt32 Last = First + 1;
+
+            while (Last < mTextures.size()
+                && Last - First < k_MaxLayers && IsCompatible(* mTextures[First], * mTextures[Last]))
+            {
+                ++Last;
+            }
+
+            Flush(Key, CPtr<const SPtr<Graphic::Texture>>(mTextures.data() + First, Last - First), Batches);
+
+            First = Last;
+        }
+        return Batches;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool TextureBatcher::IsCompatible(ConstRef<Graphic::Texture> First, ConstRef<Graphic::Texture> Second)
+    {
+        return First.GetFormat() == Second.GetFormat()
+            && First.GetLayout() == Second.GetLayout()
+            && First.GetWidth()  == Second.GetWidth()
+            && First.GetHeight() == Second.GetHeight()
+            && First.GetLevel()  == Second.GetLevel()
+            && First.GetData().GetSize() == Second.GetData().GetSize();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TextureBatcher::Flush(ConstRef<Uri> Key, CPtr<const SPtr<Graphic::Texture>> Sources, Ref<Vector<Batch>> Output)
+    {
+        ConstRef<Graphic::Texture> Layout = * Sources[0];
+
+        // Each layer holds its whole chain of level(s), one after the other, as the driver(s) expect it.
+        const UInt Stride = Layout.GetData().GetSize();
+
+        Data Texels(Stride * Sources.size());
+
+        for (UInt32 Layer = 0; Layer < Sources.size(); ++Layer)
+        {
+            std::memcpy(Texels.GetData<UInt8>() + Stride * Layer, Sources[Layer]->GetData().GetData<UInt8>(), Stride);
+        }
+
+        Batch Batch;
+        Batch.Texture = NewPtr<Graphic::Texture>(Uri::Merge(Key, Format("Array{}", Output.size())));
+        Batch.Texture->Load(
+            Layout.GetFormat(),
+            Layout.GetLayout(),
+            Layout.GetWidth(),
+            Layout.GetHeight(),
+            Sources.size(),
+            Layout.GetLevel(),
+            Layout.GetSamples(),
+            Move(Texels));
+        Batch.Layers.assign(Sources.begin(), Sources.end());
+
+        Output.emplace_back(Move(Batch));
+    }
+}
\ No newline at end of file
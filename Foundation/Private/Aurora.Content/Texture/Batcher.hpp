@@ -0,0 +1,77 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Graphic/Texture.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=(Undocumented)=-
+    class TextureBatcher final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxLayers = 256;
+
+        // -=(Undocumented)=-
+        struct Batch
+        {
+            // -=(Undocumented)=-
+            SPtr<Graphic::Texture>         Texture;
+
+            // -=(Undocumented)=-
+            Vector<SPtr<Graphic::Texture>> Layers;
+
+            // -=(Undocumented)=-
+            SInt32 Find(ConstSPtr<Graphic::Texture> Source) const
+            {
+                const auto Iterator = std::find(Layers.begin(), Layers.end(), Source);
+                return (Iterator != Layers.end() ? std::distance(Layers.begin(), Iterator) : -1);
+            }
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        void Add(ConstSPtr<Graphic::Texture> Texture);
+
+        // -=(Undocumented)=-
+        Vector<Batch> Bake(ConstRef<Uri> Key);
+
+        // -=(Undocumented)=-
+        void Clear()
+        {
+            mTextures.clear();
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        static Bool IsCompatible(ConstRef<Graphic::Texture> First, ConstRef<Graphic::Texture> Second);
+
+        // -=(Undocumented)=-
+        static void Flush(ConstRef<Uri> Key, CPtr<const SPtr<Graphic::Texture>> Sources, Ref<Vector<Batch>> Output);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<SPtr<Graphic::Texture>> mTextures;
+    };
+}
\ No newline at end of file
@@ -220,7 +220,7 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    static auto Fill(Ptr<const UInt8> Data, UInt Layer, UInt Width, UInt Height, TextureFormat Layout)
+    static auto Fill(Ptr<const UInt8> Data, UInt Layer, UInt Layers, UInt Width, UInt Height, TextureFormat Layout)
     {
         constexpr static UInt8 kMapping[] = {
             4,      // TextureFormat::BC1UIntNorm
@@ -288,19 +288,24 @@ namespace Graphic
 
         if (Data)
         {
-            static D3D11_SUBRESOURCE_DATA Content[k_MaxMipmap];
+            static Vector<D3D11_SUBRESOURCE_DATA> Content;
+            Content.resize(Layer * Max<UInt>(Layers, 1));
 
-            for (UInt32 Level = 0; Level < Layer; ++Level)
+            // Subresources are ordered by layer first, each layer holding its full chain of levels.
+            for (UInt32 Slice = 0, Index = 0; Slice < Max<UInt>(Layers, 1); ++Slice)
             {
-                Content[Level].pSysMem          = Data;
-                Content[Level].SysMemPitch      = Width * (Depth / 8);
-                Content[Level].SysMemSlicePitch = 0;
+                for (UInt32 Level = 0, X = Width, Y = Height; Level < Layer; ++Level, ++Index)
+                {
+                    Content[Index].pSysMem          = Data;
+                    Content[Index].SysMemPitch      = X * (Depth / 8);
+                    Content[Index].SysMemSlicePitch = 0;
 
-                Data    += Width * Depth * Height;
-                Width  <<= 2u;
-                Height <<= 2u;
+                    Data += X * (Depth / 8) * Y;
+                    X     = Max(X >> 1u, 1u);
+                    Y     = Max(Y >> 1u, 1u);
+                }
             }
-            return Content;
+            return Content.data();
         }
         return static_cast<Ptr<D3D11_SUBRESOURCE_DATA>>(nullptr);
     }
@@ -761,9 +766,9 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void D3D11Driver::CreateTexture(Object ID, TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt8 Level, UInt8 Samples, CPtr<const UInt8> Data)
+    void D3D11Driver::CreateTexture(Object ID, TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt16 Layers, UInt8 Level, UInt8 Samples, CPtr<const UInt8> Data)
     {
-        CD3D11_TEXTURE2D_DESC Description(As(Format), Width, Height, 1, Level);
+        CD3D11_TEXTURE2D_DESC Description(As(Format), Width, Height, Max<UInt16>(Layers, 1), Level);
         Description.Usage      = Data.empty() ? D3D11_USAGE_DEFAULT : D3D11_USAGE_IMMUTABLE;
         Description.BindFlags  = Layout != TextureLayout::Destination ? D3D11_BIND_SHADER_RESOURCE : 0;
         Description.MiscFlags  = Level < 1 ? D3D11_RESOURCE_MISC_GENERATE_MIPS : 0;
@@ -786,15 +791,25 @@ namespace Graphic
             }
         }
 
-        const Ptr<const D3D11_SUBRESOURCE_DATA> Memory = Fill(Data.data(), Level, Width, Height, Format);
+        const Ptr<const D3D11_SUBRESOURCE_DATA> Memory = Fill(Data.data(), Level, Layers, Width, Height, Format);
         CheckIfFail(mDevice->CreateTexture2D(& Description, Memory, mTextures[ID].Object.GetAddressOf()));
 
         if (Layout != TextureLayout::Destination)
         {
-            const D3D11_SRV_DIMENSION Type
-                = Samples > 1 ? D3D11_SRV_DIMENSION_TEXTURE2DMS : D3D11_SRV_DIMENSION_TEXTURE2D;
+            // A texture created with layers is always viewed as an array, even with a single layer, so that
+            // shaders declaring an array can sample it regardless of how many textures were grouped in it.
+            D3D11_SRV_DIMENSION Type;
+
+            if (Layers > 0)
+            {
+                Type = Samples > 1 ? D3D11_SRV_DIMENSION_TEXTURE2DMSARRAY : D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+            }
+            else
+            {
+                Type = Samples > 1 ? D3D11_SRV_DIMENSION_TEXTURE2DMS : D3D11_SRV_DIMENSION_TEXTURE2D;
+            }
 
-            const CD3D11_SHADER_RESOURCE_VIEW_DESC Descriptor(Type, As(Format), 0, Level);
+            const CD3D11_SHADER_RESOURCE_VIEW_DESC Descriptor(Type, As(Format), 0, Level, 0, Layers);
             CheckIfFail(mDevice->CreateShaderResourceView(
                 mTextures[ID].Object.Get(), AddressOf(Descriptor), mTextures[ID].Resource.GetAddressOf()));
         }
@@ -803,11 +818,15 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void D3D11Driver::UpdateTexture(Object ID, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, CPtr<const UInt8> Data)
+    void D3D11Driver::UpdateTexture(Object ID, UInt16 Layer, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, CPtr<const UInt8> Data)
     {
-        const D3D11_BOX Rect = CD3D11_BOX(
+        D3D11_TEXTURE2D_DESC Description;
+        mTextures[ID].Object->GetDesc(& Description);
+
+        const UINT      Resource = D3D11CalcSubresource(Level, Layer, Description.MipLevels);
+        const D3D11_BOX Rect     = CD3D11_BOX(
                 Offset.GetLeft(), Offset.GetTop(), 0, Offset.GetRight(), Offset.GetBottom(), 1);
-        mDeviceImmediate->UpdateSubresource(mTextures[ID].Object.Get(), Level, AddressOf(Rect), Data.data(), Pitch, 0);
+        mDeviceImmediate->UpdateSubresource(mTextures[ID].Object.Get(), Resource, AddressOf(Rect), Data.data(), Pitch, 0);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -1364,7 +1383,8 @@ namespace Graphic
         if (Min != k_MaxSlots && Max > 0)
         {
             const UInt Count = Max - Min;
-            mDeviceImmediate->PSSetSamplers(Min, Count, Array + Min); // TODO: Do we also need other stages?
+            mDeviceImmediate->VSSetSamplers(Min, Count, Array + Min);
+            mDeviceImmediate->PSSetSamplers(Min, Count, Array + Min);
         }
     }
 
@@ -1390,7 +1410,8 @@ namespace Graphic
         if (Min != k_MaxSlots && Max > 0)
         {
             const UInt Count = Max - Min;
-            mDeviceImmediate->PSSetShaderResources(Min, Count, Array + Min);    // TODO: Do we also need other stages?
+            mDeviceImmediate->VSSetShaderResources(Min, Count, Array + Min);
+            mDeviceImmediate->PSSetShaderResources(Min, Count, Array + Min);
         }
     }
 
@@ -61,10 +61,10 @@ namespace Graphic
         void DeletePipeline(Object ID) override;
 
         // \see Driver::CreateTexture
-        void CreateTexture(Object ID, TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt8 Level, UInt8 Samples, CPtr<const UInt8> Data) override;
+        void CreateTexture(Object ID, TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt16 Layers, UInt8 Level, UInt8 Samples, CPtr<const UInt8> Data) override;
 
         // \see Driver::UpdateTexture
-        void UpdateTexture(Object ID, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, CPtr<const UInt8> Data) override;
+        void UpdateTexture(Object ID, UInt16 Layer, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, CPtr<const UInt8> Data) override;
 
         // \see Driver::CopyTexture
         void CopyTexture(Object DstTexture, UInt8 DstLevel, ConstRef<Vector2i> DstOffset, Object SrcTexture, UInt8 SrcLevel, ConstRef<Recti> SrcOffset) override;
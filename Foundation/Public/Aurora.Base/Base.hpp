@@ -24,5 +24,8 @@
 #include "Logger/Log.hpp"
 
 #include "Memory/Data.hpp"
+#include "Memory/TLSF.hpp"
 
-#include "Subsystem/Subsystem.hpp"
\ No newline at end of file
+#include "Subsystem/Subsystem.hpp"
+
+#include "Thread/Scheduler.hpp"
\ No newline at end of file
@@ -0,0 +1,309 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "TLSF.hpp"
+#include <bit>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+inline namespace Core
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    TLSF::TLSF(UInt32 Capacity)
+    {
+        Reset(Capacity);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TLSF::Reset(UInt32 Capacity)
+    {
+        mCapacity    = Capacity;
+        mUsage       = 0;
+        mFirstBitmap = 0;
+        mSecondBitmap.fill(0);
+        mHeads.fill(k_Invalid);
+        mNodes.clear();
+        mPool.clear();
+
+        if (Capacity > 0)
+        {
+            InsertFree(CreateNode(0, Capacity));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    TLSF::Allocation TLSF::Allocate(UInt32 Size, UInt32 Alignment)
+    {
+        // Round the size to the alignment so that every block carved out of the heap keeps its
+        // neighbours aligned, the worst case padding is only needed after a differently aligned request.
+        const UInt32 Length  = Align(Size, Alignment);
+        const UInt64 Request = static_cast<UInt64>(Length) + (Alignment - 1);
+
+        if (Size == 0 || Request > mCapacity - mUsage)
+        {
+            return Allocation();
+        }
+
+        const UInt32 ID = FindFree(static_cast<UInt32>(Request));
+
+        if (ID == k_Invalid)
+        {
+            return Allocation();
+        }
+
+        RemoveFree(ID);
+
+        const UInt32 Offset = Align(mNodes[ID].Offset, Alignment);
+        const UInt32 Used   = (Offset - mNodes[ID].Offset) + Length;
+
+        // Split the remainder of the block into a new free node, linked right after the allocated one.
+        if (const UInt32 Remainder = mNodes[ID].Size - Used; Remainder > 0)
+        {
+            const UInt32 Split = CreateNode(mNodes[ID].Offset + Used, Remainder);
+
+            mNodes[Split].Previous = ID;
+            mNodes[Split].Next     = mNodes[ID].Next;
+
+            if (mNodes[ID].Next != k_Invalid)
+            {
+                mNodes[mNodes[ID].Next].Previous = Split;
+            }
+            mNodes[ID].Next = Split;
+            mNodes[ID].Size = Used;
+
+            InsertFree(Split);
+        }
+
+        mNodes[ID].Used = true;
+        mUsage += mNodes[ID].Size;
+
+        return Allocation(Offset, Size, ID);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TLSF::Free(ConstRef<Allocation> Allocation)
+    {
+        if (!Allocation.IsValid() || !mNodes[Allocation.Node].Used)
+        {
+            return;
+        }
+
+        UInt32 ID = Allocation.Node;
+
+        mNodes[ID].Used = false;
+        mUsage -= mNodes[ID].Size;
+
+        // Coalesce with the physical neighbours, so that the heap never holds two adjacent free blocks.
+        if (const UInt32 Previous = mNodes[ID].Previous; Previous != k_Invalid && !mNodes[Previous].Used)
+        {
+            RemoveFree(Previous);
+
+            mNodes[Previous].Size += mNodes[ID].Size;
+            mNodes[Previous].Next  = mNodes[ID].Next;
+
+            if (mNodes[ID].Next != k_Invalid)
+            {
+                mNodes[mNodes[ID].Next].Previous = Previous;
+            }
+            DeleteNode(ID);
+
+            ID = Previous;
+        }
+
+        if (const UInt32 Next = mNodes[ID].Next; Next != k_Invalid && !mNodes[Next].Used)
+        {
+            RemoveFree(Next);
+
+            mNodes[ID].Size += mNodes[Next].Size;
+            mNodes[ID].Next  = mNodes[Next].Next;
+
+            if (mNodes[Next].Next != k_Invalid)
+            {
+                mNodes[mNodes[Next].Next].Previous = ID;
+            }
+            DeleteNode(Next);
+        }
+
+        InsertFree(ID);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TLSF::GetBin(UInt32 Size, Ref<UInt32> First, Ref<UInt32> Second)
+    {
+        // Small sizes are mapped linearly into the first level, everything else is split into a power of
+        // two class (first level) and an evenly spaced subdivision of that class (second level).
+        if (Size < k_SecondLevels)
+        {
+            First  = 0;
+            Second = Size;
+        }
+        else
+        {
+            const UInt32 Log2 = std::bit_width(Size) - 1;
+
+            First  = Log2 - k_SecondBits + 1;
+            Second = (Size >> (Log2 - k_SecondBits)) - k_SecondLevels;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 TLSF::CreateNode(UInt32 Offset, UInt32 Size)
+    {
+        UInt32 ID;
+
+        if (mPool.empty())
+        {
+            ID = mNodes.size();
+            mNodes.emplace_back();
+        }
+        else
+        {
+            ID = mPool.back();
+            mPool.pop_back();
+            mNodes[ID] = Node();
+        }
+
+        mNodes[ID].Offset = Offset;
+        mNodes[ID].Size   = Size;
+        return ID;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TLSF::DeleteNode(UInt32 ID)
+    {
+        mPool.emplace_back(ID);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TLSF::InsertFree(UInt32 ID)
+    {
+        UInt32 First;
+        UInt32 Second;
+        GetBin(mNodes[ID].Size, First, Second);
+
+        const UInt32 Bin  = First * k_SecondLevels + Second;
+        const UInt32 Head = mHeads[Bin];
+
+        mNodes[ID].PreviousFree = k_Invalid;
+        mNodes[ID].NextFree     = Head;
+
+        if (Head != k_Invalid)
+        {
+            mNodes[Head].PreviousFree = ID;
+        }
+        mHeads[Bin] = ID;
+
+        mFirstBitmap         |= (1u << First);
+        mSecondBitmap[First] |= (1u << Second);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TLSF::RemoveFree(UInt32 ID)
+    {
+        UInt32 First;
+        UInt32 Second;
+        GetBin(mNodes[ID].Size, First, Second);
+
+        const UInt32 Bin      = First * k_SecondLevels + Second;
+        const UInt32 Previous = mNodes[ID].PreviousFree;
+        const UInt32 Next     = mNodes[ID].NextFree;
+
+        if (Previous != k_Invalid)
+        {
+            mNodes[Previous].NextFree = Next;
+        }
+        else
+        {
+            mHeads[Bin] = Next;
+        }
+
+        if (Next != k_Invalid)
+        {
+            mNodes[Next].PreviousFree = Previous;
+        }
+
+        if (mHeads[Bin] == k_Invalid)
+        {
+            mSecondBitmap[First] &= ~(1u << Second);
+
+            if (mSecondBitmap[First] == 0)
+            {
+                mFirstBitmap &= ~(1u << First);
+            }
+        }
+
+        mNodes[ID].PreviousFree = k_Invalid;
+        mNodes[ID].NextFree     = k_Invalid;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 TLSF::FindFree(UInt32 Size) const
+    {
+        // Round the request up to the next bin, so that any block found there is guaranteed to fit and
+        // the search never has to walk a free list.
+        UInt64 Rounded = Size;
+
+        if (Size >= k_SecondLevels)
+        {
+            Rounded += (1ull << (std::bit_width(Size) - 1 - k_SecondBits)) - 1;
+        }
+
+        if (Rounded > UINT32_MAX)
+        {
+            return k_Invalid;
+        }
+
+        UInt32 First;
+        UInt32 Second;
+        GetBin(static_cast<UInt32>(Rounded), First, Second);
+
+        UInt32 Bitmap = mSecondBitmap[First] & (~0u << Second);
+
+        if (Bitmap == 0)
+        {
+            const UInt32 Levels = (First + 1 < k_FirstLevels ? mFirstBitmap & (~0u << (First + 1)) : 0);
+
+            if (Levels == 0)
+            {
+                return k_Invalid;
+            }
+
+            First  = std::countr_zero(Levels);
+            Bitmap = mSecondBitmap[First];
+        }
+
+        Second = std::countr_zero(Bitmap);
+        return mHeads[First * k_SecondLevels + Second];
+    }
+}
\ No newline at end of file
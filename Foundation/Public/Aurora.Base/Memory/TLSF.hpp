@@ -0,0 +1,143 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Base/Trait.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+inline namespace Core
+{
+    // -=(Undocumented)=-
+    class TLSF final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Invalid      = UINT32_MAX;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_FirstLevels  = 32;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_SecondBits   = 4;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_SecondLevels = 1u << k_SecondBits;
+
+        // -=(Undocumented)=-
+        struct Allocation
+        {
+            // -=(Undocumented)=-
+            UInt32 Offset = 0;
+
+            // -=(Undocumented)=-
+            UInt32 Size   = 0;
+
+            // -=(Undocumented)=-
+            UInt32 Node   = k_Invalid;
+
+            // -=(Undocumented)=-
+            Bool IsValid() const
+            {
+                return Node != k_Invalid;
+            }
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        explicit TLSF(UInt32 Capacity = 0);
+
+        // -=(Undocumented)=-
+        void Reset(UInt32 Capacity);
+
+        // -=(Undocumented)=-
+        Allocation Allocate(UInt32 Size, UInt32 Alignment = 1);
+
+        // -=(Undocumented)=-
+        void Free(ConstRef<Allocation> Allocation);
+
+        // -=(Undocumented)=-
+        UInt32 GetCapacity() const
+        {
+            return mCapacity;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetUsage() const
+        {
+            return mUsage;
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Node
+        {
+            // -=(Undocumented)=-
+            UInt32 Offset       = 0;
+
+            // -=(Undocumented)=-
+            UInt32 Size         = 0;
+
+            // -=(Undocumented)=-
+            UInt32 Previous     = k_Invalid;
+
+            // -=(Undocumented)=-
+            UInt32 Next         = k_Invalid;
+
+            // -=(Undocumented)=-
+            UInt32 PreviousFree = k_Invalid;
+
+            // -=(Undocumented)=-
+            UInt32 NextFree     = k_Invalid;
+
+            // -=(Undocumented)=-
+            Bool   Used         = false;
+        };
+
+        // -=(Undocumented)=-
+        static void GetBin(UInt32 Size, Ref<UInt32> First, Ref<UInt32> Second);
+
+        // -=(Undocumented)=-
+        UInt32 CreateNode(UInt32 Offset, UInt32 Size);
+
+        // -=(Undocumented)=-
+        void DeleteNode(UInt32 ID);
+
+        // -=(Undocumented)=-
+        void InsertFree(UInt32 ID);
+
+        // -=(Undocumented)=-
+        void RemoveFree(UInt32 ID);
+
+        // -=(Undocumented)=-
+        UInt32 FindFree(UInt32 Size) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UInt32                                        mCapacity;
+        UInt32                                        mUsage;
+        UInt32                                        mFirstBitmap;
+        Array<UInt32, k_FirstLevels>                  mSecondBitmap;
+        Array<UInt32, k_FirstLevels * k_SecondLevels> mHeads;
+        Vector<Node>                                  mNodes;
+        Vector<UInt32>                                mPool;
+    };
+}
\ No newline at end of file
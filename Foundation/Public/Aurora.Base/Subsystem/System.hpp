@@ -47,6 +47,12 @@ inline namespace Core
         {
         }
 
+        // -=(Undocumented)=-
+        ~System()
+        {
+            RemoveAllSubsystems();
+        }
+
         // -=(Undocumented)=-
         void SetMode(Mode Mode)
         {
@@ -124,6 +130,20 @@ inline namespace Core
             }
         }
 
+        // -=(Undocumented)=-
+        void RemoveAllSubsystems()
+        {
+            mTickables.clear();
+
+            // Subsystems are released last-to-first, so each one can still reach the ones it was created after
+            // (e.g. to release the GPU objects it owns through the graphics service).
+            while (!mRegistry.empty())
+            {
+                const SPtr<Subsystem> SubsystemPtr = Move(mRegistry.back());
+                mRegistry.pop_back();
+            }
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -0,0 +1,131 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Scheduler.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+inline namespace Core
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Scheduler::Scheduler()
+        : mCount      { 0 },
+          mGeneration { 0 },
+          mCursor     { 0 },
+          mPending    { 0 }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Scheduler::~Scheduler()
+    {
+        // Ask every worker to stop and wake them up, so they observe the request and leave their loop.
+        for (Ref<Thread> Worker : mWorkers)
+        {
+            Worker.request_stop();
+        }
+
+        mGeneration.fetch_add(1, std::memory_order_release);
+        mGeneration.notify_all();
+
+        mWorkers.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Scheduler::Initialize(UInt32 Threads)
+    {
+        if (mWorkers.empty())
+        {
+            for (UInt32 Worker = 0; Worker < Threads; ++Worker)
+            {
+                mWorkers.emplace_back(std::bind_front(&Scheduler::OnWork, this), mGeneration.load());
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Scheduler::Dispatch(UInt32 Count, Any<Task> Function)
+    {
+        mTask  = Move(Function);
+        mCount = Count;
+        mCursor.store(0, std::memory_order_relaxed);
+
+        // Wake the workers up and help them on the calling thread, items are handed out one at a time
+        // through the cursor so a heavy item does not stall the rest.
+        if (!mWorkers.empty() && Count > 1)
+        {
+            mPending.store(mWorkers.size(), std::memory_order_relaxed);
+            mGeneration.fetch_add(1, std::memory_order_release);
+            mGeneration.notify_all();
+
+            OnDrain();
+
+            for (UInt32 Pending = mPending.load(std::memory_order_acquire); Pending > 0;)
+            {
+                mPending.wait(Pending, std::memory_order_acquire);
+                Pending = mPending.load(std::memory_order_acquire);
+            }
+        }
+        else
+        {
+            OnDrain();
+        }
+
+        mTask = nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Scheduler::OnWork(std::stop_token Token, UInt32 Generation)
+    {
+        while (not Token.stop_requested())
+        {
+            // Sleep until a new batch is published (or we are asked to leave).
+            mGeneration.wait(Generation, std::memory_order_acquire);
+            Generation = mGeneration.load(std::memory_order_acquire);
+
+            if (Token.stop_requested())
+            {
+                break;
+            }
+
+            OnDrain();
+
+            if (mPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                mPending.notify_all();
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Scheduler::OnDrain()
+    {
+        for (UInt32 Item = mCursor.fetch_add(1); Item < mCount; Item = mCursor.fetch_add(1))
+        {
+            mTask(Item);
+        }
+    }
+}
\ No newline at end of file
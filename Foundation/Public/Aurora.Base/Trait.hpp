@@ -42,6 +42,13 @@ inline namespace Core
         return First > Second ? First : Second;
     }
 
+    // -=(Undocumented)=-
+    template<typename Type>
+    constexpr Type Abs(Type Value)
+    {
+        return Value < 0 ? -Value : Value;
+    }
+
     // -=(Undocumented)=-
     template<typename Type>
     constexpr Type Clamp(Type Value, Type  Minimum, Type Maximum)
@@ -16,9 +16,11 @@
 #include <array>
 #include <bitset>
 #include <cmath>
+#include <condition_variable>
 #include <format>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <string>
 #include <unordered_dense.h>
@@ -199,4 +201,10 @@ inline namespace Core
 
     // -=(Undocumented)=-
     using Thread      = std::jthread;
+
+    // -=(Undocumented)=-
+    using Mutex       = std::mutex;
+
+    // -=(Undocumented)=-
+    using Condition   = std::condition_variable_any;
 }
\ No newline at end of file
@@ -60,6 +60,8 @@ namespace Content
         // -=(Undocumented)=-
         SPtr<Type> GetOrCreate(ConstRef<Uri> Key, Bool CreateIfNeeded)
         {
+            const std::scoped_lock Guard(mMutex);
+
             SPtr<Type> Result;
 
             if (const auto Iterator = mRegistry.find(Key.GetPath()); Iterator != mRegistry.end())
@@ -78,6 +80,8 @@ namespace Content
         // -=(Undocumented)=-
         Bool Remove(ConstRef<Uri> Key)
         {
+            const std::scoped_lock Guard(mMutex);
+
             if (const auto Iterator = mRegistry.find(Key.GetPath()); Iterator != mRegistry.end())
             {
                 ConstSPtr<Type> Asset = Iterator->second;
@@ -94,6 +98,8 @@ namespace Content
         // -=(Undocumented)=-
         Vector<SPtr<Type>> Prune(Bool Force)
         {
+            const std::scoped_lock Guard(mMutex);
+
             Vector<SPtr<Type>> Collection;
 
             for (auto Iterator = mRegistry.begin(); Iterator != mRegistry.end();)
@@ -119,6 +125,7 @@ namespace Content
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+        Mutex                   mMutex;
         StringTable<SPtr<Type>> mRegistry;
         UInt                    mBudget;
         UInt                    mUsage;
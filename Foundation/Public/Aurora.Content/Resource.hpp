@@ -28,7 +28,7 @@ namespace Content
         // -=(Undocumented)=-
         enum class Status
         {
-            None, Loaded, Failed
+            None, Queued, Decoded, Loaded, Failed
         };
 
     public:
@@ -45,22 +45,10 @@ namespace Content
         virtual ~Resource() = default;
 
         // -=(Undocumented)=-
-        Bool Create(Ref<Subsystem::Context> Context)
-        {
-            Delete(Context);
-
-            const Bool Result = OnCreate(Context);
+        static ConstPtr<Uri> GetActive();
 
-            if (Result)
-            {
-                SetStatus(Status::Loaded);
-            }
-            else
-            {
-                SetStatus(Status::Failed);
-            }
-            return Result;
-        }
+        // -=(Undocumented)=-
+        Bool Create(Ref<Subsystem::Context> Context);
 
         // -=(Undocumented)=-
         void Delete(Ref<Subsystem::Context> Context)
@@ -95,13 +83,26 @@ namespace Content
         // -=(Undocumented)=-
         void SetStatus(Status Status)
         {
-            mStatus = Status;
+            mStatus.store(Status, std::memory_order_release);
+            mStatus.notify_all();
         }
 
         // -=(Undocumented)=-
         Status GetStatus() const
         {
-            return mStatus;
+            return mStatus.load(std::memory_order_acquire);
+        }
+
+        // -=(Undocumented)=-
+        Bool Transition(Status From, Status To)
+        {
+            return mStatus.compare_exchange_strong(From, To, std::memory_order_acq_rel);
+        }
+
+        // -=(Undocumented)=-
+        void Wait(Status Current) const
+        {
+            mStatus.wait(Current, std::memory_order_acquire);
         }
 
         // -=(Undocumented)=-
@@ -113,13 +114,13 @@ namespace Content
         // -=(Undocumented)=-
         Bool HasFailed() const
         {
-            return mStatus == Status::Failed;
+            return GetStatus() == Status::Failed;
         }
 
         // -=(Undocumented)=-
         Bool HasLoaded() const
         {
-            return mStatus == Status::Loaded;
+            return GetStatus() == Status::Loaded;
         }
 
     protected:
@@ -140,9 +141,9 @@ namespace Content
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        const Uri  mKey;
-        UInt       mMemory;
-        Status     mStatus;
+        const Uri      mKey;
+        UInt           mMemory;
+        Atomic<Status> mStatus;
     };
 
     // -=(Undocumented)=-
@@ -45,10 +45,63 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    // Whether the calling thread belongs to the loading pool, assets decoded there are created on the main thread.
+    thread_local Bool t_Worker = false;
+
+    // Assets acquired by the loader currently running on this thread, its creation waits for them.
+    thread_local Ptr<Vector<SPtr<Resource>>> t_Dependencies = nullptr;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Service::Service(Ref<Context> Context)
-        : AbstractSubsystem(Context)
+        : AbstractSubsystem(Context),
+          mOutstanding { 0 }
     {
         RegisterDefaultResources();
+
+        // Decoding is a mix of I/O and parsing, so every core but the main thread's one is put to work.
+        const UInt32 Threads = Max(SDL_GetNumLogicalCPUCores() - 1, 1);
+
+        for (UInt32 Worker = 0; Worker < Threads; ++Worker)
+        {
+            mWorkers.emplace_back(std::bind_front(&Service::OnWork, this));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Service::~Service()
+    {
+        // Cached assets are released while the subsystems they were created with are still alive, anything the
+        // graphics service reports afterwards was held by someone else.
+        Table<UInt, FPtr<void()>> Unloaders;
+
+        {
+            const std::scoped_lock Guard(mRegistry);
+            Unloaders = mUnloaders;
+        }
+
+        for (const auto & [_, Unload] : Unloaders)
+        {
+            Unload();
+        }
+
+        // Wake every worker through its stop token and join them before the queues they use are destroyed.
+        for (Ref<Thread> Worker : mWorkers)
+        {
+            Worker.request_stop();
+        }
+        mWorkers.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::OnTick(Real64 Time, Real64 Delta)
+    {
+        Complete();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -56,6 +109,8 @@ namespace Content
 
     void Service::AddLoader(ConstSPtr<Loader> Loader)
     {
+        const std::scoped_lock Guard(mRegistry);
+
         for (const CStr Extension : Loader->GetExtensions())
         {
             mLoaders.try_emplace(Extension, Loader);
@@ -67,6 +122,7 @@ namespace Content
 
     void Service::RemoveLoader(CStr Extension)
     {
+        const std::scoped_lock Guard(mRegistry);
         mLoaders.erase(Extension);
     }
 
@@ -75,6 +131,7 @@ namespace Content
 
     void Service::AddLocator(CStr Schema, ConstSPtr<Locator> Locator)
     {
+        const std::scoped_lock Guard(mRegistry);
         mLocators.try_emplace(Schema, Locator);
     }
 
@@ -83,6 +140,7 @@ namespace Content
 
     void Service::RemoveLocator(CStr Schema)
     {
+        const std::scoped_lock Guard(mRegistry);
         mLocators.erase(Schema);
     }
 
@@ -91,12 +149,24 @@ namespace Content
 
     Data Service::Find(ConstRef<Uri> Key)
     {
-        if (const auto It = mLocators.find(Key.GetSchema()); It != mLocators.end())
+        if (ConstSPtr<Locator> Locator = GetLocator(Key.GetSchema()))
         {
-            return It->second->Read(Key.GetPath());
+            return Locator->Read(Key.GetPath());
         }
 
-        for (const auto & [_, Locator] : mLocators)
+        // Locators are read outside of the lock, loading threads would otherwise wait on each other's I/O.
+        Vector<SPtr<Locator>> Locators;
+
+        {
+            const std::scoped_lock Guard(mRegistry);
+
+            for (const auto & [_, Locator] : mLocators)
+            {
+                Locators.emplace_back(Locator);
+            }
+        }
+
+        for (ConstSPtr<Locator> Locator : Locators)
         {
             if (Data Data = Locator->Read(Key.GetPath()); Data.HasData())
             {
@@ -111,9 +181,9 @@ namespace Content
 
     Bool Service::Save(ConstRef<Uri> Key, CPtr<const UInt8> Data)
     {
-        if (const auto It = mLocators.find(Key.GetSchema()); It != mLocators.end())
+        if (ConstSPtr<Locator> Locator = GetLocator(Key.GetSchema()))
         {
-            It->second->Write(Key.GetPath(), Data);
+            Locator->Write(Key.GetPath(), Data);
             return true;
         }
         return false;
@@ -124,9 +194,9 @@ namespace Content
 
     Bool Service::Delete(ConstRef<Uri> Key)
     {
-        if (const auto It = mLocators.find(Key.GetSchema()); It != mLocators.end())
+        if (ConstSPtr<Locator> Locator = GetLocator(Key.GetSchema()))
         {
-            It->second->Delete(Key.GetPath());
+            Locator->Delete(Key.GetPath());
             return true;
         }
         return false;
@@ -135,6 +205,21 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void Service::Flush()
+    {
+        while (mOutstanding.load(std::memory_order_acquire) > 0)
+        {
+            {
+                std::unique_lock Lock(mMutex);
+                mCondition.wait(Lock, [this]() { return !mCompletions.empty(); });
+            }
+            Complete();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     void Service::RegisterDefaultResources()
     {
         AddLocator("Engine://", NewPtr<MemoryLocator>());
@@ -179,14 +264,34 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    SPtr<Loader> Service::GetLoader(CStr Extension)
+    {
+        const std::scoped_lock Guard(mRegistry);
+
+        const auto Iterator = mLoaders.find(Extension);
+        return (Iterator != mLoaders.end() ? Iterator->second : nullptr);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SPtr<Locator> Service::GetLocator(CStr Schema)
+    {
+        const std::scoped_lock Guard(mRegistry);
+
+        const auto Iterator = mLocators.find(Schema);
+        return (Iterator != mLocators.end() ? Iterator->second : nullptr);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Bool Service::Parse(ConstSPtr<Resource> Asset)
     {
         ConstRef<Uri> Key = Asset->GetKey();
 
-        if (const auto Iterator = mLoaders.find(Key.GetExtension()); Iterator != mLoaders.end())
+        if (ConstSPtr<Loader> Loader = GetLoader(Key.GetExtension()))
         {
-            ConstSPtr<Loader> Loader = Iterator->second;
-
             if (Data File = Find(Key); File.HasData())
             {
                 if (Loader->Load(* this, Move(File), * Asset))
@@ -206,4 +311,180 @@ namespace Content
         }
         return false;
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Acquire(ConstSPtr<Resource> Asset)
+    {
+        if (t_Dependencies)
+        {
+            t_Dependencies->emplace_back(Asset);
+        }
+
+        // Whoever moves the asset out of 'None' owns its decoding, the same goes for a request that no worker has
+        // picked up yet, otherwise a worker waiting on it could starve the pool.
+        Bool Owner = Asset->Transition(Resource::Status::None, Resource::Status::Queued);
+
+        if (!Owner)
+        {
+            const std::scoped_lock Guard(mMutex);
+
+            if (const auto Iterator = std::find(mRequests.begin(), mRequests.end(), Asset); Iterator != mRequests.end())
+            {
+                mRequests.erase(Iterator);
+                mOutstanding.fetch_sub(1, std::memory_order_release);
+                Owner = true;
+            }
+        }
+
+        if (Owner)
+        {
+            if (t_Worker)
+            {
+                // Loaders may depend on other assets (e.g. a pipeline on its shaders), those are decoded right away
+                // but created on the main thread like any other request.
+                mOutstanding.fetch_add(1, std::memory_order_relaxed);
+                Decode(Asset);
+            }
+            else if (Parse(Asset))
+            {
+                Process(Asset, true);
+            }
+            else
+            {
+                Asset->SetStatus(Resource::Status::Failed);
+            }
+            return;
+        }
+
+        // Another thread is decoding it, wait for its data before handing it to the caller.
+        for (Resource::Status Status = Asset->GetStatus(); Status == Resource::Status::Queued;)
+        {
+            Asset->Wait(Status);
+            Status = Asset->GetStatus();
+        }
+
+        if (!t_Worker)
+        {
+            Finish(Asset);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Enqueue(ConstSPtr<Resource> Asset)
+    {
+        mOutstanding.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            const std::scoped_lock Guard(mMutex);
+            mRequests.emplace_back(Asset);
+        }
+        mCondition.notify_all();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Decode(ConstSPtr<Resource> Asset)
+    {
+        Vector<SPtr<Resource>> Dependencies;
+
+        const Ptr<Vector<SPtr<Resource>>> Previous = std::exchange(t_Dependencies, AddressOf(Dependencies));
+        const Bool Decoded = Parse(Asset);
+        t_Dependencies = Previous;
+
+        {
+            const std::scoped_lock Guard(mMutex);
+
+            if (Decoded && !Dependencies.empty())
+            {
+                mDependencies.insert_or_assign(Asset.get(), Move(Dependencies));
+            }
+            Asset->SetStatus(Decoded ? Resource::Status::Decoded : Resource::Status::Failed);
+
+            mCompletions.emplace_back(Asset);
+        }
+        mCondition.notify_all();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Complete()
+    {
+        Vector<SPtr<Resource>> Completions;
+
+        {
+            const std::scoped_lock Guard(mMutex);
+            Swap(Completions, mCompletions);
+        }
+
+        for (ConstSPtr<Resource> Asset : Completions)
+        {
+            Finish(Asset);
+        }
+        mOutstanding.fetch_sub(Completions.size(), std::memory_order_release);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Finish(ConstSPtr<Resource> Asset)
+    {
+        // Creation touches other subsystems (e.g. the device), so it only ever happens on the main thread. A
+        // synchronous load may have already created the asset while it was waiting here.
+        if (Asset->GetStatus() != Resource::Status::Decoded)
+        {
+            return;
+        }
+
+        Vector<SPtr<Resource>> Dependencies;
+
+        {
+            const std::scoped_lock Guard(mMutex);
+
+            if (const auto Iterator = mDependencies.find(Asset.get()); Iterator != mDependencies.end())
+            {
+                Dependencies = Move(Iterator->second);
+                mDependencies.erase(Iterator);
+            }
+        }
+
+        // A dependency is always decoded before the loader that acquired it returns, so it's created first here
+        // no matter which completion or synchronous load reaches the asset.
+        for (ConstSPtr<Resource> Dependency : Dependencies)
+        {
+            Finish(Dependency);
+        }
+        Process(Asset, true);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::OnWork(std::stop_token Token)
+    {
+        t_Worker = true;
+
+        while (!Token.stop_requested())
+        {
+            SPtr<Resource> Asset;
+
+            {
+                std::unique_lock Lock(mMutex);
+
+                if (!mCondition.wait(Lock, Token, [this]() { return !mRequests.empty(); }))
+                {
+                    break;
+                }
+
+                Asset = Move(mRequests.front());
+                mRequests.erase(mRequests.begin());
+            }
+            Decode(Asset);
+        }
+    }
 }
\ No newline at end of file
@@ -13,6 +13,7 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Factory.hpp"
+#include "Future.hpp"
 #include "Loader.hpp"
 #include "Locator.hpp"
 
@@ -23,13 +24,19 @@
 namespace Content
 {
     // -=(Undocumented)=-
-    class Service final : public AbstractSubsystem<Service>
+    class Service final : public AbstractSubsystem<Service>, public Tickable
     {
     public:
 
         // -=(Undocumented)=-
         explicit Service(Ref<Context> Context);
 
+        // -=(Undocumented)=-
+        ~Service();
+
+        // \see Tickable::OnTick(Real64, Real64)
+        void OnTick(Real64 Time, Real64 Delta) override;
+
         // -=(Undocumented)=-
         void AddLoader(ConstSPtr<Loader> Loader);
 
@@ -93,18 +100,40 @@ namespace Content
         template<typename Type>
         SPtr<Type> Load(ConstRef<Uri> Key, Bool Async = false)
         {
+            if (Async)
+            {
+                return LoadAsync<Type>(Key).Get();
+            }
+
+            Track<Type>();
+
             ConstSPtr<Type> Asset = Type::GetFactory().GetOrCreate(Key, true);
 
             if (Asset && !Asset->HasFinished())
             {
-                // TODO: Asynchronous
-
-                Process(Asset, Parse(Asset));
+                Acquire(Asset);
             }
-
             return Asset;
         }
 
+        // -=(Undocumented)=-
+        template<typename Type>
+        Future<Type> LoadAsync(ConstRef<Uri> Key)
+        {
+            Track<Type>();
+
+            ConstSPtr<Type> Asset = Type::GetFactory().GetOrCreate(Key, true);
+
+            if (Asset && Asset->Transition(Resource::Status::None, Resource::Status::Queued))
+            {
+                Enqueue(Asset);
+            }
+            return Future<Type>(Asset);
+        }
+
+        // -=(Undocumented)=-
+        void Flush();
+
         // -=(Undocumented)=-
         template<typename Type>
         void Reload(ConstSPtr<Type> Asset, Bool Async = false)
@@ -140,6 +169,12 @@ namespace Content
         template<typename Type>
         void Prune(Bool Force)
         {
+            if (Force)
+            {
+                // Requests still in flight hold assets that are about to be dropped, let them land first.
+                Flush();
+            }
+
             for (const Vector<SPtr<Type>> Assets = Type::GetFactory().Prune(Force); ConstSPtr<Type> Asset : Assets)
             {
                 Process(Asset, false);
@@ -169,9 +204,41 @@ namespace Content
         // -=(Undocumented)=-
         void RegisterDefaultResources();
 
+        // -=(Undocumented)=-
+        SPtr<Loader> GetLoader(CStr Extension);
+
+        // -=(Undocumented)=-
+        SPtr<Locator> GetLocator(CStr Schema);
+
+        // -=(Undocumented)=-
+        template<typename Type>
+        void Track()
+        {
+            const std::scoped_lock Guard(mRegistry);
+            mUnloaders.try_emplace(Hash<Type>(), [this]() { Prune<Type>(true); });
+        }
+
         // -=(Undocumented)=-
         Bool Parse(ConstSPtr<Resource> Asset);
 
+        // -=(Undocumented)=-
+        void Acquire(ConstSPtr<Resource> Asset);
+
+        // -=(Undocumented)=-
+        void Enqueue(ConstSPtr<Resource> Asset);
+
+        // -=(Undocumented)=-
+        void Decode(ConstSPtr<Resource> Asset);
+
+        // -=(Undocumented)=-
+        void Complete();
+
+        // -=(Undocumented)=-
+        void Finish(ConstSPtr<Resource> Asset);
+
+        // -=(Undocumented)=-
+        void OnWork(std::stop_token Token);
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -179,5 +246,18 @@ namespace Content
 
         StringTable<SPtr<Loader>>  mLoaders;
         StringTable<SPtr<Locator>> mLocators;
+        Table<UInt, FPtr<void()>>  mUnloaders;
+        Mutex                      mRegistry;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Thread>                               mWorkers;
+        Mutex                                        mMutex;
+        Condition                                    mCondition;
+        Vector<SPtr<Resource>>                       mRequests;
+        Vector<SPtr<Resource>>                       mCompletions;
+        Table<Ptr<Resource>, Vector<SPtr<Resource>>> mDependencies;
+        Atomic<UInt32>                               mOutstanding;
     };
 }
\ No newline at end of file
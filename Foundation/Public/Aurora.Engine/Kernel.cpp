@@ -32,6 +32,9 @@ namespace Engine
 
     Kernel::~Kernel()
     {
+        // Subsystems go away before the device and the logger, so whatever they report on shutdown still lands.
+        RemoveAllSubsystems();
+
         Log::Shutdown();
     }
 
@@ -77,6 +80,17 @@ namespace Engine
                 Log::Warn("Kernel: Failed to create graphics service, disabling service.");
                 RemoveSubsystem<Graphic::Service>();
             }
+            else
+            {
+                // Create the texture streamer (idle until given a budget)
+                Log::Info("Kernel: Creating texture streamer");
+                AddSubsystem<Graphic::Streamer>();
+
+                // Create the clustered light assignment
+                Log::Info("Kernel: Creating lighting service");
+                ConstSPtr<Graphic::Lighting> LightingService = AddSubsystem<Graphic::Lighting>();
+                LightingService->Initialize(Min(SDL_GetNumLogicalCPUCores() / 2, 4));
+            }
 
             // Create the audio service
             Log::Info("Kernel: Creating audio service");
@@ -86,12 +100,24 @@ namespace Engine
                 Log::Warn("Kernel: Failed to create audio service, disabling service.");
                 RemoveSubsystem<Audio::Service>();
             }
+
+            // Create the particle service
+            Log::Info("Kernel: Creating particle service");
+            ConstSPtr<Particle::Service> ParticleService = AddSubsystem<Particle::Service>();
+            ParticleService->Initialize(Min(SDL_GetNumLogicalCPUCores() / 2, 4));
         }
 
         // Create the content service
         Log::Info("Kernel: Creating content service");
         AddSubsystem<Content::Service>();
 
+        // Create the debug draw service (loads its pipelines through the content service)
+        if (GetSubsystem<Graphic::Service>())
+        {
+            Log::Info("Kernel: Creating debug draw service");
+            AddSubsystem<Graphic::Debug>()->Initialize();
+        }
+
         // Create the network service
         Log::Info("Kernel: Creating network service");
         ConstSPtr<Network::Service> NetworkService = AddSubsystem<Network::Service>();
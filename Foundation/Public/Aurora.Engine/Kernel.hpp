@@ -16,12 +16,17 @@
 
 #include "Aurora.Content/Service.hpp"
 
+#include "Aurora.Graphic/Debug.hpp"
+#include "Aurora.Graphic/Lighting.hpp"
 #include "Aurora.Graphic/Service.hpp"
+#include "Aurora.Graphic/Streamer.hpp"
 
 #include "Aurora.Input/Service.hpp"
 
 #include "Aurora.Network/Service.hpp"
 
+#include "Aurora.Particle/Service.hpp"
+
 #include "Device.hpp"
 
 #include "Properties.hpp"
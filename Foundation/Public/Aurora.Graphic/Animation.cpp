@@ -0,0 +1,158 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Animation.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Animation::Animation(Any<SStr> Name, Any<Vector<Channel>> Channels)
+        : mName     { Move(Name) },
+          mDuration { 0.0f },
+          mChannels { Move(Channels) }
+    {
+        for (ConstRef<Channel> Channel : mChannels)
+        {
+            if (!Channel.Times.empty())
+            {
+                mDuration = Max(mDuration, Channel.Times.back());
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Animator::Animator()
+        : mAnimation { nullptr },
+          mTime      { 0.0f }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Animator::Sample(ConstRef<Animation> Animation, Real32 Time, Bool Loop, Ref<Pose> Pose)
+    {
+        const Real32 Duration = Animation.GetDuration();
+
+        if (Duration > 0.0f)
+        {
+            Time = (Loop ? fmodf(Max(Time, 0.0f), Duration) : Clamp(Time, 0.0f, Duration));
+        }
+
+        // Each channel remembers the keyframe it sampled last, so that playing forward only walks a
+        // handful of keys per frame instead of searching the whole track; rewinding starts over.
+        CPtr<const Animation::Channel> Channels = Animation.GetChannels();
+
+        if (mAnimation != AddressOf(Animation) || Time < mTime)
+        {
+            mAnimation = AddressOf(Animation);
+            mCursors.assign(Channels.size(), 0);
+        }
+        mTime = Time;
+
+        for (UInt32 Index = 0; Index < Channels.size(); ++Index)
+        {
+            ConstRef<Animation::Channel> Channel = Channels[Index];
+
+            if (Channel.Times.empty() || Channel.Joint >= Pose.size())
+            {
+                continue;
+            }
+
+            const UInt32 First  = Seek(Channel, mCursors[Index], Time);
+            const UInt32 Second = Min<UInt32>(First + 1, Channel.Times.size() - 1);
+
+            Real32 Percentage = 0.0f;
+
+            if (Channel.Mode == Animation::Interpolation::Linear && Second != First)
+            {
+                const Real32 Delta = Channel.Times[Second] - Channel.Times[First];
+                Percentage = (Delta > 0.0f ? Clamp((Time - Channel.Times[First]) / Delta, 0.0f, 1.0f) : 0.0f);
+            }
+
+            ConstRef<Vector4f> Start = Channel.Values[First];
+            ConstRef<Vector4f> End   = Channel.Values[Second];
+
+            switch (Channel.Target)
+            {
+            case Animation::Path::Translation:
+            {
+                const Vector4f Value = Vector4f::Lerp(Start, End, Percentage);
+                Pose[Channel.Joint].SetPosition(Vector3f(Value.GetX(), Value.GetY(), Value.GetZ()));
+                break;
+            }
+            case Animation::Path::Rotation:
+            {
+                const Quaternionf Value = Quaternionf::Lerp(
+                    Quaternionf(Start.GetX(), Start.GetY(), Start.GetZ(), Start.GetW()),
+                    Quaternionf(End.GetX(), End.GetY(), End.GetZ(), End.GetW()), Percentage);
+                Pose[Channel.Joint].SetRotation(Quaternionf::Normalize(Value));
+                break;
+            }
+            case Animation::Path::Scale:
+            {
+                const Vector4f Value = Vector4f::Lerp(Start, End, Percentage);
+                Pose[Channel.Joint].SetScale(Vector3f(Value.GetX(), Value.GetY(), Value.GetZ()));
+                break;
+            }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Animator::Blend(ConstRef<Pose> Source, ConstRef<Pose> Target, Real32 Weight, Ref<Pose> Output)
+    {
+        const UInt32 Count = Min(Source.size(), Target.size());
+
+        Output.resize(Count);
+
+        for (UInt32 Joint = 0; Joint < Count; ++Joint)
+        {
+            ConstRef<Transformf> First  = Source[Joint];
+            ConstRef<Transformf> Second = Target[Joint];
+
+            // Normalized lerp is close enough to slerp between neighbouring poses and far cheaper.
+            const Quaternionf Rotation = Quaternionf::Lerp(First.GetRotation(), Second.GetRotation(), Weight);
+
+            Output[Joint] = Transformf(
+                Vector3f::Lerp(First.GetPosition(), Second.GetPosition(), Weight),
+                Vector3f::Lerp(First.GetScale(), Second.GetScale(), Weight),
+                Quaternionf::Normalize(Rotation));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Animator::Seek(ConstRef<Animation::Channel> Channel, Ref<UInt32> Cursor, Real32 Time) const
+    {
+        const UInt32 Last = Channel.Times.size() - 1;
+
+        Cursor = Min(Cursor, Last);
+
+        while (Cursor < Last && Channel.Times[Cursor + 1] <= Time)
+        {
+            ++Cursor;
+        }
+        return Cursor;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Transform.hpp"
+#include "Aurora.Math/Vector4.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    using Pose = Vector<Transformf>;
+
+    // -=(Undocumented)=-
+    class Animation final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        enum class Path : UInt8
+        {
+            Translation,
+            Rotation,
+            Scale,
+        };
+
+        // -=(Undocumented)=-
+        enum class Interpolation : UInt8
+        {
+            Step,
+            Linear,
+        };
+
+        // -=(Undocumented)=-
+        struct Channel
+        {
+            // -=(Undocumented)=-
+            UInt32           Joint  = 0;
+
+            // -=(Undocumented)=-
+            Path             Target = Path::Translation;
+
+            // -=(Undocumented)=-
+            Interpolation    Mode   = Interpolation::Linear;
+
+            // -=(Undocumented)=-
+            Vector<Real32>   Times;
+
+            // -=(Undocumented)=-
+            Vector<Vector4f> Values;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        Animation(Any<SStr> Name, Any<Vector<Channel>> Channels);
+
+        // -=(Undocumented)=-
+        ConstRef<SStr> GetName() const
+        {
+            return mName;
+        }
+
+        // -=(Undocumented)=-
+        Real32 GetDuration() const
+        {
+            return mDuration;
+        }
+
+        // -=(Undocumented)=-
+        CPtr<const Channel> GetChannels() const
+        {
+            return mChannels;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        SStr            mName;
+        Real32          mDuration;
+        Vector<Channel> mChannels;
+    };
+
+    // -=(Undocumented)=-
+    class Animator final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        Animator();
+
+        // -=(Undocumented)=-
+        void Sample(ConstRef<Animation> Animation, Real32 Time, Bool Loop, Ref<Pose> Pose);
+
+        // -=(Undocumented)=-
+        void Reset()
+        {
+            mAnimation = nullptr;
+        }
+
+        // -=(Undocumented)=-
+        static void Blend(ConstRef<Pose> Source, ConstRef<Pose> Target, Real32 Weight, Ref<Pose> Output);
+
+    private:
+
+        // -=(Undocumented)=-
+        UInt32 Seek(ConstRef<Animation::Channel> Channel, Ref<UInt32> Cursor, Real32 Time) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Ptr<const Animation> mAnimation;
+        Real32               mTime;
+        Vector<UInt32>       mCursors;
+    };
+}
\ No newline at end of file
@@ -109,4 +109,50 @@ namespace Graphic
 
         return Vector2f(Coordinates.GetX(), Coordinates.GetY());
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Real32 Camera::GetCoverage(ConstRef<Vector3f> Center, Real32 Radius) const
+    {
+        constexpr Real32 k_Epsilon = 1.0e-4f;
+
+        // The W component of the clip position is the view depth for perspective projection(s) and
+        // one for orthographic projection(s), so the projected radius is valid for both.
+        const Real32 Depth = mWorld.GetComponent(3)  * Center.GetX()
+                           + mWorld.GetComponent(7)  * Center.GetY()
+                           + mWorld.GetComponent(11) * Center.GetZ()
+                           + mWorld.GetComponent(15);
+
+        return Radius * mProjection.GetComponent(5) / Max(Depth, k_Epsilon);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Camera::IsVisible(ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum) const
+    {
+        // Extract each frustum plane from the rows of the world matrix, the box is outside as soon as
+        // its corner furthest along the normal of any plane lies behind it.
+        for (UInt32 Plane = 0; Plane < 6; ++Plane)
+        {
+            const UInt32 Row  = Plane >> 1;
+            const Real32 Sign = (Plane & 1 ? -1.0f : 1.0f);
+
+            const Real32 A = mWorld.GetComponent(3)  + Sign * mWorld.GetComponent(Row);
+            const Real32 B = mWorld.GetComponent(7)  + Sign * mWorld.GetComponent(Row + 4);
+            const Real32 C = mWorld.GetComponent(11) + Sign * mWorld.GetComponent(Row + 8);
+            const Real32 D = mWorld.GetComponent(15) + Sign * mWorld.GetComponent(Row + 12);
+
+            const Real32 X = (A >= 0.0f ? Maximum.GetX() : Minimum.GetX());
+            const Real32 Y = (B >= 0.0f ? Maximum.GetY() : Minimum.GetY());
+            const Real32 Z = (C >= 0.0f ? Maximum.GetZ() : Minimum.GetZ());
+
+            if (A * X + B * Y + C * Z + D < 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 }
\ No newline at end of file
@@ -325,6 +325,12 @@ namespace Graphic
         // -=(Undocumented)=-
         Vector2f GetScreenCoordinates(ConstRef<Vector2f> Position, ConstRef<Rectf> Viewport) const;
 
+        // -=(Undocumented)=-
+        Real32 GetCoverage(ConstRef<Vector3f> Center, Real32 Radius) const;
+
+        // -=(Undocumented)=-
+        Bool IsVisible(ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum) const;
+
     private:
 
         static constexpr UInt32 k_DirtyBitTransformation = 1 << 0;
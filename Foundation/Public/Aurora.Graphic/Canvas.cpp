@@ -0,0 +1,534 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Canvas.hpp"
+#include "Aurora.Content/Service.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    struct Outline
+    {
+        // -=(Undocumented)=-
+        Vector4f Color;
+
+        // -=(Undocumented)=-
+        Real32   Thickness;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Canvas::Canvas(Ref<Subsystem::Context> Context)
+        : mGraphics  { Context.GetSubsystem<Service>() },
+          mStreamer  { Context.GetSubsystem<Streamer>() },
+          mIndices   { 0 },
+          mSort      { false },
+          mAssemble  { false }
+    {
+        ConstSPtr<Content::Service> Content = Context.GetSubsystem<Content::Service>();
+        mImagePipeline = Content->Load<Pipeline>("Engine://Pipeline/UI.effect");
+        mTextPipeline  = Content->Load<Pipeline>("Engine://Pipeline/UIText.effect");
+
+        // Images without a texture of their own sample a single white texel, so they share the pipeline (and
+        // the batches) with the textured ones.
+        constexpr UInt8 k_DefaultMipmaps = 1;
+        constexpr UInt8 k_DefaultSamples = 1;
+
+        Data Texel(sizeof(UInt32));
+        * Texel.GetData<UInt32>() = 0xFFFFFFFF;
+
+        mBlank = NewPtr<Texture>("Canvas_Blank");
+        mBlank->Load(
+            TextureFormat::RGBA8UIntNorm, TextureLayout::Source, 1, 1, k_DefaultMipmaps, k_DefaultSamples, Move(Texel));
+        mBlank->Create(Context);
+
+        // Every widget is made out of quads, so a single static index buffer serves all of them.
+        Data Indices(k_MaxQuads * 6 * sizeof(UInt16));
+
+        const Ptr<UInt16> Elements = Indices.GetData<UInt16>();
+
+        for (UInt32 Quad = 0; Quad < k_MaxQuads; ++Quad)
+        {
+            const UInt16 Base = Quad * 4;
+
+            Elements[Quad * 6 + 0] = Base + 0;
+            Elements[Quad * 6 + 1] = Base + 1;
+            Elements[Quad * 6 + 2] = Base + 2;
+            Elements[Quad * 6 + 3] = Base + 0;
+            Elements[Quad * 6 + 4] = Base + 2;
+            Elements[Quad * 6 + 5] = Base + 3;
+        }
+        mIndices = mGraphics->CreateBuffer(Usage::Index, Move(Indices));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Canvas::~Canvas()
+    {
+        mGraphics->FreeGeometry(Usage::Vertex, mGeometry);
+        mGraphics->DeleteBuffer(mIndices);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Canvas::CreateImage(ConstRef<Rectf> Bounds, ConstSPtr<Texture> Texture, Color Tint)
+    {
+        const UInt32 ID = Allocate(Kind::Image, Bounds, Tint);
+        mWidgets[ID].Image = Texture;
+        return ID;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Canvas::CreateText(
+        ConstRef<Rectf> Bounds, ConstSPtr<Font> Font, CStr16 Text, Real32 Size, Font::Alignment Alignment,
+        Color Tint)
+    {
+        const UInt32 ID = Allocate(Kind::Text, Bounds, Tint);
+
+        Ref<Widget> Widget = mWidgets[ID];
+        Widget.Typeface  = Font;
+        Widget.Text      = Text;
+        Widget.Size      = Size;
+        Widget.Alignment = Alignment;
+        return ID;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::Delete(UInt32 ID)
+    {
+        mWidgets[ID] = Widget();
+        mFree.push_back(ID);
+
+        mSort     = true;
+        mAssemble = true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::SetBounds(UInt32 ID, ConstRef<Rectf> Bounds)
+    {
+        if (Ref<Widget> Widget = mWidgets[ID]; Widget.Bounds != Bounds)
+        {
+            Widget.Bounds = Bounds;
+            Invalidate(Widget);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::SetSource(UInt32 ID, ConstRef<Rectf> Source)
+    {
+        if (Ref<Widget> Widget = mWidgets[ID]; Widget.Source != Source)
+        {
+            Widget.Source = Source;
+            Invalidate(Widget);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::SetTint(UInt32 ID, Color Tint)
+    {
+        Ref<Widget> Widget = mWidgets[ID];
+
+        if (Widget.Tint == Tint.GetValue())
+        {
+            return;
+        }
+
+        // The layout stays the same, the cached geometry only needs its color patched.
+        Widget.Tint = Tint.GetValue();
+
+        for (Ref<Vertex> Vertex : Widget.Geometry)
+        {
+            Vertex.Tint = Widget.Tint;
+        }
+        mAssemble = mAssemble || Widget.Visible;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::SetText(UInt32 ID, CStr16 Text)
+    {
+        if (Ref<Widget> Widget = mWidgets[ID]; Widget.Text != Text)
+        {
+            Widget.Text = Text;
+            Invalidate(Widget);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::SetVisible(UInt32 ID, Bool Visible)
+    {
+        if (Ref<Widget> Widget = mWidgets[ID]; Widget.Visible != Visible)
+        {
+            Widget.Visible = Visible;
+            mSort          = true;
+            mAssemble      = true;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::SetLayer(UInt32 ID, UInt16 Layer)
+    {
+        if (Ref<Widget> Widget = mWidgets[ID]; Widget.Layer != Layer)
+        {
+            Widget.Layer = Layer;
+            mSort        = true;
+            mAssemble    = true;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::Draw(Ref<Encoder> Encoder, ConstRef<Camera> Camera)
+    {
+        // A frame where nothing changed replays the batches over the geometry that is already on the device.
+        if (mAssemble)
+        {
+            Assemble();
+        }
+
+        // Nothing is drawn until the quads and their indices have left the upload queue.
+        if (mBatches.empty() || mGraphics->IsBufferPending(mIndices) || mGraphics->IsBufferPending(mGeometry.Buffer))
+        {
+            return;
+        }
+
+        const Binding Scene = mGraphics->Allocate<Matrix4f>(Usage::Uniform, CastSpan(Camera.GetWorld()));
+
+        constexpr Outline k_Outline { Vector4f(0.0f, 0.0f, 0.0f, 0.0f), 0.0f };
+
+        for (ConstRef<Batch> Batch : mBatches)
+        {
+            for (UInt32 Quad = 0; Quad < Batch.Quads; Quad += k_MaxQuads)
+            {
+                const UInt32 Count = Min(Batch.Quads - Quad, k_MaxQuads);
+
+                Encoder.SetVertices(0, Binding(mGeometry.Buffer, sizeof(Vertex), mGeometry.GetOffset()));
+                Encoder.SetIndices(Binding(mIndices, sizeof(UInt16), 0));
+                Encoder.SetUniforms(0, Scene);
+
+                if (Batch.Type == Kind::Text)
+                {
+                    ConstSPtr<Material> Material = Batch.Owner->Typeface->GetMaterial();
+
+                    Encoder.SetUniforms(2, mGraphics->Allocate<UInt8>(Usage::Uniform, Material->GetParameters()));
+                    Encoder.SetUniforms(3, mGraphics->Allocate<Outline>(Usage::Uniform, CastSpan(k_Outline)));
+                    Encoder.SetPipeline(* mTextPipeline);
+                    Encoder.SetTexture(0, * Material->GetTexture(TextureSlot::Diffuse));
+
+                    if (mStreamer)
+                    {
+                        mStreamer->Request(* Material, Batch.Extent);
+                    }
+                    Encoder.SetSampler(0, Material->GetSampler(TextureSlot::Diffuse));
+                }
+                else
+                {
+                    ConstSPtr<Texture> Texture = (Batch.Owner->Image ? Batch.Owner->Image : mBlank);
+
+                    Encoder.SetPipeline(* mImagePipeline);
+                    Encoder.SetTexture(0, * Texture);
+
+                    if (mStreamer)
+                    {
+                        mStreamer->Request(* Texture, Batch.Extent);
+                    }
+                    Encoder.SetSampler(0, Sampler(TextureEdge::Clamp, TextureEdge::Clamp, TextureFilter::Trilinear));
+                }
+                Encoder.Draw(Count * 6, (Batch.First + Quad) * 4, 0);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Canvas::Allocate(Kind Type, ConstRef<Rectf> Bounds, Color Tint)
+    {
+        UInt32 ID;
+
+        if (mFree.empty())
+        {
+            ID = mWidgets.size();
+            mWidgets.emplace_back();
+        }
+        else
+        {
+            ID = mFree.back();
+            mFree.pop_back();
+        }
+
+        Ref<Widget> Widget = mWidgets[ID];
+        Widget.Type   = Type;
+        Widget.Bounds = Bounds;
+        Widget.Tint   = Tint.GetValue();
+
+        mSort     = true;
+        mAssemble = true;
+        return ID;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::Invalidate(Ref<Widget> Widget)
+    {
+        Widget.Dirty = true;
+
+        // A hidden widget is built once it becomes visible again, which already forces a new assembly.
+        mAssemble = mAssemble || Widget.Visible;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::Build(Ref<Widget> Widget)
+    {
+        Widget.Geometry.clear();
+        Widget.Dirty = false;
+
+        const auto AddQuad = [&](ConstRef<Rectf> Plane, ConstRef<Rectf> Image)
+        {
+            const UInt32 Tint = Widget.Tint;
+            Widget.Geometry.push_back(Vertex { Vector2f(Plane.GetLeft(),  Plane.GetTop()),
+                                               Vector2f(Image.GetLeft(),  Image.GetTop()),    Tint });
+            Widget.Geometry.push_back(Vertex { Vector2f(Plane.GetRight(), Plane.GetTop()),
+                                               Vector2f(Image.GetRight(), Image.GetTop()),    Tint });
+            Widget.Geometry.push_back(Vertex { Vector2f(Plane.GetRight(), Plane.GetBottom()),
+                                               Vector2f(Image.GetRight(), Image.GetBottom()), Tint });
+            Widget.Geometry.push_back(Vertex { Vector2f(Plane.GetLeft(),  Plane.GetBottom()),
+                                               Vector2f(Image.GetLeft(),  Image.GetBottom()), Tint });
+        };
+
+        if (Widget.Type == Kind::Image)
+        {
+            AddQuad(Widget.Bounds, Widget.Source);
+            return;
+        }
+
+        if (Widget.Type != Kind::Text || !Widget.Typeface)
+        {
+            return;
+        }
+
+        ConstSPtr<Font>         Font    = Widget.Typeface;
+        ConstRef<Font::Metrics> Metrics = Font->GetMetrics();
+
+        const Real32 Size   = Widget.Size;
+        const Real32 Height = Metrics.UnderlineHeight * Size;
+
+        // Measure every line first, the alignment places the block inside of the widget's bounds.
+        Vector<Real32> Widths(1, 0.0f);
+
+        for (UInt32 Previous = 0, Symbol = 0; Symbol < Widget.Text.size(); ++Symbol)
+        {
+            const UInt32 Codepoint = Widget.Text[Symbol];
+
+            if (Codepoint == '\n')
+            {
+                Widths.push_back(0.0f);
+                Previous = 0;
+            }
+            else if (const Ptr<const Font::Glyph> Glyph = Font->GetGlyph(Codepoint))
+            {
+                Widths.back() += (Font->GetKerning(Previous, Codepoint) + Glyph->Advance) * Size;
+                Previous = Codepoint;
+            }
+        }
+
+        // The alignments are laid out column by column (left, center, right), each one with four rows
+        // (top, middle, bottom, baseline).
+        const UInt32 Column = CastEnum(Widget.Alignment) / 4;
+        const UInt32 Row    = CastEnum(Widget.Alignment) % 4;
+        const Real32 Block  = Height * Widths.size();
+
+        Real32 OriginY = Widget.Bounds.GetTop();
+
+        switch (Row)
+        {
+        case 1:
+            OriginY += (Widget.Bounds.GetHeight() - Block) * 0.5f;
+            break;
+        case 2:
+            OriginY  = Widget.Bounds.GetBottom() - Block;
+            break;
+        case 3:
+            OriginY  = Widget.Bounds.GetBottom() - Metrics.Ascender * Size - Height * (Widths.size() - 1);
+            break;
+        default:
+            break;
+        }
+
+        const auto GetOriginX = [&](UInt32 Line)
+        {
+            return Widget.Bounds.GetLeft() + (Widget.Bounds.GetWidth() - Widths[Line]) * Column * 0.5f;
+        };
+
+        UInt32 Line    = 0;
+        Real32 CursorX = GetOriginX(Line);
+        Real32 CursorY = OriginY;
+
+        for (UInt32 Previous = 0, Symbol = 0; Symbol < Widget.Text.size(); ++Symbol)
+        {
+            const UInt32 Codepoint = Widget.Text[Symbol];
+
+            if (Codepoint == '\n')
+            {
+                CursorX  = GetOriginX(++Line);
+                CursorY += Height;
+                Previous = 0;
+                continue;
+            }
+
+            const Ptr<const Font::Glyph> Glyph = Font->GetGlyph(Codepoint);
+
+            if (!Glyph)
+            {
+                continue;
+            }
+
+            CursorX += Font->GetKerning(Previous, Codepoint) * Size;
+
+            if (ConstRef<Rectf> Plane = Glyph->PlaneBounds; Plane.GetWidth() != 0.0f)
+            {
+                AddQuad(Rectf(CursorX + Plane.GetLeft()  * Size,
+                              CursorY + Plane.GetTop()    * Size,
+                              CursorX + Plane.GetRight()  * Size,
+                              CursorY + Plane.GetBottom() * Size), Glyph->ImageBounds);
+            }
+
+            CursorX += Glyph->Advance * Size;
+            Previous = Codepoint;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Canvas::Assemble()
+    {
+        mAssemble = false;
+
+        if (mSort)
+        {
+            mSort = false;
+            mOrder.clear();
+
+            for (UInt32 ID = 0; ID < mWidgets.size(); ++ID)
+            {
+                if (mWidgets[ID].Type != Kind::None && mWidgets[ID].Visible)
+                {
+                    mOrder.push_back(ID);
+                }
+            }
+
+            // Widgets on the same layer keep their creation order.
+            std::stable_sort(mOrder.begin(), mOrder.end(), [this](UInt32 First, UInt32 Second)
+            {
+                return mWidgets[First].Layer < mWidgets[Second].Layer;
+            });
+        }
+
+        // Only the widgets whose content or layout changed build their geometry again, everything else is
+        // copied straight out of their cache.
+        UInt32 Quads = 0;
+
+        for (const UInt32 ID : mOrder)
+        {
+            Ref<Widget> Widget = mWidgets[ID];
+
+            if (Widget.Dirty)
+            {
+                Build(Widget);
+            }
+            Quads += Widget.Geometry.size() / 4;
+        }
+
+        // The previous geometry may still be in use by the frames in flight, the service defers its release.
+        mGraphics->FreeGeometry(Usage::Vertex, mGeometry);
+
+        mGeometry = Range();
+        mBatches.clear();
+
+        if (Quads == 0)
+        {
+            return;
+        }
+
+        Data Bytes(Quads * 4 * sizeof(Vertex));
+
+        const Ptr<Vertex> Vertices = Bytes.GetData<Vertex>();
+
+        UInt32 First = 0;
+
+        for (const UInt32 ID : mOrder)
+        {
+            Ref<Widget> Widget = mWidgets[ID];
+
+            const UInt32 Count = Widget.Geometry.size() / 4;
+
+            if (Count == 0)
+            {
+                continue;
+            }
+
+            std::memcpy(Vertices + First * 4, Widget.Geometry.data(), Widget.Geometry.size() * sizeof(Vertex));
+
+            // How many pixels the whole texture would span at the widget's size, glyph atlases are sampled at
+            // their own resolution so they always ask for every level.
+            const Real32 Extent = (Widget.Type == Kind::Text
+                ? std::numeric_limits<Real32>::max()
+                : Max(Widget.Bounds.GetWidth()  / Max(Widget.Source.GetWidth(), 1.0e-4f),
+                      Widget.Bounds.GetHeight() / Max(Widget.Source.GetHeight(), 1.0e-4f)));
+
+            // Consecutive widgets that sample the same texture are drawn together.
+            const Bool Merge = !mBatches.empty() && mBatches.back().Type == Widget.Type && (Widget.Type == Kind::Text
+                ? mBatches.back().Owner->Typeface == Widget.Typeface
+                : mBatches.back().Owner->Image    == Widget.Image);
+
+            if (Merge)
+            {
+                mBatches.back().Quads += Count;
+                mBatches.back().Extent = Max(mBatches.back().Extent, Extent);
+            }
+            else
+            {
+                mBatches.push_back(Batch { Widget.Type, AddressOf(Widget), First, Count, Extent });
+            }
+            First += Count;
+        }
+
+        mGeometry = mGraphics->AllocateGeometry(Usage::Vertex, Move(Bytes));
+    }
+}
\ No newline at end of file
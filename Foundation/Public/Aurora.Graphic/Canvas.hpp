@@ -0,0 +1,199 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Camera.hpp"
+#include "Font.hpp"
+#include "Service.hpp"
+#include "Streamer.hpp"
+#include "Aurora.Math/Color.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    class Canvas final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxQuads = 16 * 1024;
+
+        // -=(Undocumented)=-
+        struct Vertex
+        {
+            // -=(Undocumented)=-
+            Vector2f Position;
+
+            // -=(Undocumented)=-
+            Vector2f TexCoord;
+
+            // -=(Undocumented)=-
+            UInt32   Tint;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        explicit Canvas(Ref<Subsystem::Context> Context);
+
+        // -=(Undocumented)=-
+        ~Canvas();
+
+        // -=(Undocumented)=-
+        UInt32 CreateImage(ConstRef<Rectf> Bounds, ConstSPtr<Texture> Texture, Color Tint);
+
+        // -=(Undocumented)=-
+        UInt32 CreateText(
+            ConstRef<Rectf> Bounds, ConstSPtr<Font> Font, CStr16 Text, Real32 Size, Font::Alignment Alignment,
+            Color Tint);
+
+        // -=(Undocumented)=-
+        void Delete(UInt32 ID);
+
+        // -=(Undocumented)=-
+        void SetBounds(UInt32 ID, ConstRef<Rectf> Bounds);
+
+        // -=(Undocumented)=-
+        void SetSource(UInt32 ID, ConstRef<Rectf> Source);
+
+        // -=(Undocumented)=-
+        void SetTint(UInt32 ID, Color Tint);
+
+        // -=(Undocumented)=-
+        void SetText(UInt32 ID, CStr16 Text);
+
+        // -=(Undocumented)=-
+        void SetVisible(UInt32 ID, Bool Visible);
+
+        // -=(Undocumented)=-
+        void SetLayer(UInt32 ID, UInt16 Layer);
+
+        // -=(Undocumented)=-
+        void Draw(Ref<Encoder> Encoder, ConstRef<Camera> Camera);
+
+    private:
+
+        // -=(Undocumented)=-
+        enum class Kind : UInt8
+        {
+            None,
+            Image,
+            Text,
+        };
+
+        // -=(Undocumented)=-
+        struct Widget
+        {
+            // -=(Undocumented)=-
+            Kind            Type      = Kind::None;
+
+            // -=(Undocumented)=-
+            Bool            Visible   = true;
+
+            // -=(Undocumented)=-
+            Bool            Dirty     = true;
+
+            // -=(Undocumented)=-
+            UInt16          Layer     = 0;
+
+            // -=(Undocumented)=-
+            UInt32          Tint      = 0;
+
+            // -=(Undocumented)=-
+            Rectf           Bounds;
+
+            // -=(Undocumented)=-
+            Rectf           Source    = Rectf(0.0f, 0.0f, 1.0f, 1.0f);
+
+            // -=(Undocumented)=-
+            SPtr<Texture>   Image;
+
+            // -=(Undocumented)=-
+            SPtr<Font>      Typeface;
+
+            // -=(Undocumented)=-
+            SStr16          Text;
+
+            // -=(Undocumented)=-
+            Real32          Size      = 0.0f;
+
+            // -=(Undocumented)=-
+            Font::Alignment Alignment = Font::Alignment::LeftTop;
+
+            // -=(Undocumented)=-
+            Vector<Vertex>  Geometry;
+        };
+
+        // -=(Undocumented)=-
+        struct Batch
+        {
+            // -=(Undocumented)=-
+            Kind        Type;
+
+            // -=(Undocumented)=-
+            Ptr<Widget> Owner;
+
+            // -=(Undocumented)=-
+            UInt32      First;
+
+            // -=(Undocumented)=-
+            UInt32      Quads;
+
+            // -=(Undocumented)=-
+            Real32      Extent;
+        };
+
+        // -=(Undocumented)=-
+        UInt32 Allocate(Kind Type, ConstRef<Rectf> Bounds, Color Tint);
+
+        // -=(Undocumented)=-
+        void Invalidate(Ref<Widget> Widget);
+
+        // -=(Undocumented)=-
+        void Build(Ref<Widget> Widget);
+
+        // -=(Undocumented)=-
+        void Assemble();
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        SPtr<Service>  mGraphics;
+        SPtr<Streamer> mStreamer;
+        SPtr<Pipeline> mImagePipeline;
+        SPtr<Pipeline> mTextPipeline;
+        SPtr<Texture>  mBlank;
+        Object         mIndices;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Widget> mWidgets;
+        Vector<UInt32> mFree;
+        Vector<UInt32> mOrder;
+        Bool           mSort;
+        Bool           mAssemble;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Range          mGeometry;
+        Vector<Batch>  mBatches;
+    };
+}
\ No newline at end of file
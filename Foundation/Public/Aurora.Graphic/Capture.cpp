@@ -0,0 +1,547 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Capture.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Capture::Capture(Any<UPtr<Driver>> Driver)
+        : mDriver { Move(Driver) },
+          mFile   { nullptr }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Capture::~Capture()
+    {
+        Close();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Capture::Open(CStr Filename)
+    {
+        Close();
+
+        mFile = SDL_IOFromFile(SStr(Filename).c_str(), "wb");
+
+        if (mFile)
+        {
+            constexpr UInt32 Header[] = { k_Magic, k_Version };
+            SDL_WriteIO(mFile, Header, sizeof(Header));
+        }
+        else
+        {
+            Log::Warn("Graphics: Failed to open capture '{}': {}", Filename, SDL_GetError());
+        }
+        return mFile != nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::Flush()
+    {
+        // Each frame is stored as a size prefixed block, so a capture that was interrupted
+        // (crash, kill) can still be replayed up to the last frame that was completely written.
+        if (mFile && mWriter.HasData())
+        {
+            const UInt32 Size = mWriter.GetOffset();
+
+            SDL_WriteIO(mFile, AddressOf(Size), sizeof(Size));
+            SDL_WriteIO(mFile, mWriter.GetData().data(), Size);
+        }
+        mWriter.Clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UPtr<Driver> Capture::Release()
+    {
+        Close();
+        return Move(mDriver);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Capture::Initialize(Ptr<SDL_Window> Swapchain, UInt16 Width, UInt16 Height, UInt8 Samples)
+    {
+        mWriter.WriteEnum(Command::Initialize);
+        mWriter.WriteUInt16(Width);
+        mWriter.WriteUInt16(Height);
+        mWriter.WriteUInt8(Samples);
+
+        return mDriver->Initialize(Swapchain, Width, Height, Samples);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::Reset(UInt16 Width, UInt16 Height, UInt8 Samples)
+    {
+        mWriter.WriteEnum(Command::Reset);
+        mWriter.WriteUInt16(Width);
+        mWriter.WriteUInt16(Height);
+        mWriter.WriteUInt8(Samples);
+
+        mDriver->Reset(Width, Height, Samples);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ConstRef<Capabilities> Capture::GetCapabilities() const
+    {
+        return mDriver->GetCapabilities();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::CreateBuffer(Object ID, Usage Type, Bool Immutable, Ptr<const UInt8> Data, UInt32 Length)
+    {
+        mWriter.WriteEnum(Command::CreateBuffer);
+        mWriter.WriteUInt16(ID);
+        mWriter.WriteEnum(Type);
+        mWriter.WriteBool(Immutable);
+        mWriter.WriteUInt32(Length);
+        mWriter.WriteBlock(CPtr<const UInt8>(Data, Data ? Length : 0));
+
+        mDriver->CreateBuffer(ID, Type, Immutable, Data, Length);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::CopyBuffer(Object DstBuffer, UInt32 DstOffset, Object SrcBuffer, UInt32 SrcOffset, UInt32 Size)
+    {
+        mWriter.WriteEnum(Command::CopyBuffer);
+        mWriter.WriteUInt16(DstBuffer);
+        mWriter.WriteUInt32(DstOffset);
+        mWriter.WriteUInt16(SrcBuffer);
+        mWriter.WriteUInt32(SrcOffset);
+        mWriter.WriteUInt32(Size);
+
+        mDriver->CopyBuffer(DstBuffer, DstOffset, SrcBuffer, SrcOffset, Size);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::UpdateBuffer(Object ID, Bool Discard, UInt32 Offset, CPtr<const UInt8> Data)
+    {
+        mWriter.WriteEnum(Command::UpdateBuffer);
+        mWriter.WriteUInt16(ID);
+        mWriter.WriteBool(Discard);
+        mWriter.WriteUInt32(Offset);
+        mWriter.WriteBlock(Data);
+
+        mDriver->UpdateBuffer(ID, Discard, Offset, Data);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::DeleteBuffer(Object ID)
+    {
+        mWriter.WriteEnum(Command::DeleteBuffer);
+        mWriter.WriteUInt16(ID);
+
+        mDriver->DeleteBuffer(ID);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::CreatePass(Object ID, CPtr<const Attachment> Colors, CPtr<const Attachment> Resolves, ConstRef<Attachment> Auxiliary)
+    {
+        mWriter.WriteEnum(Command::CreatePass);
+        mWriter.WriteUInt16(ID);
+        mWriter.WriteBlock(Colors);
+        mWriter.WriteBlock(Resolves);
+        mWriter.Write(Auxiliary);
+
+        mDriver->CreatePass(ID, Colors, Resolves, Auxiliary);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::DeletePass(Object ID)
+    {
+        mWriter.WriteEnum(Command::DeletePass);
+        mWriter.WriteUInt16(ID);
+
+        mDriver->DeletePass(ID);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Fragment, CPtr<const UInt8> Geometry, ConstRef<Descriptor> Properties)
+    {
+        mWriter.WriteEnum(Command::CreatePipeline);
+        mWriter.WriteUInt16(ID);
+        mWriter.WriteBlock(Vertex);
+        mWriter.WriteBlock(Fragment);
+        mWriter.WriteBlock(Geometry);
+        mWriter.Write(Properties);
+
+        mDriver->CreatePipeline(ID, Vertex, Fragment, Geometry, Properties);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::DeletePipeline(Object ID)
+    {
+        mWriter.WriteEnum(Command::DeletePipeline);
+        mWriter.WriteUInt16(ID);
+
+        mDriver->DeletePipeline(ID);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::CreateTexture(Object ID, TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt16 Layers, UInt8 Level, UInt8 Samples, CPtr<const UInt8> Data)
+    {
+        mWriter.WriteEnum(Command::CreateTexture);
+        mWriter.WriteUInt16(ID);
+        mWriter.WriteEnum(Format);
+        mWriter.WriteEnum(Layout);
+        mWriter.WriteUInt16(Width);
+        mWriter.WriteUInt16(Height);
+        mWriter.WriteUInt16(Layers);
+        mWriter.WriteUInt8(Level);
+        mWriter.WriteUInt8(Samples);
+        mWriter.WriteBlock(Data);
+
+        mDriver->CreateTexture(ID, Format, Layout, Width, Height, Layers, Level, Samples, Data);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::UpdateTexture(Object ID, UInt16 Layer, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, CPtr<const UInt8> Data)
+    {
+        mWriter.WriteEnum(Command::UpdateTexture);
+        mWriter.WriteUInt16(ID);
+        mWriter.WriteUInt16(Layer);
+        mWriter.WriteUInt8(Level);
+        mWriter.WriteObject(Offset);
+        mWriter.WriteUInt32(Pitch);
+        mWriter.WriteBlock(Data);
+
+        mDriver->UpdateTexture(ID, Layer, Level, Offset, Pitch, Data);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::CopyTexture(Object DstTexture, UInt8 DstLevel, ConstRef<Vector2i> DstOffset, Object SrcTexture, UInt8 SrcLevel, ConstRef<Recti> SrcOffset)
+    {
+        mWriter.WriteEnum(Command::CopyTexture);
+        mWriter.WriteUInt16(DstTexture);
+        mWriter.WriteUInt8(DstLevel);
+        mWriter.WriteObject(DstOffset);
+        mWriter.WriteUInt16(SrcTexture);
+        mWriter.WriteUInt8(SrcLevel);
+        mWriter.WriteObject(SrcOffset);
+
+        mDriver->CopyTexture(DstTexture, DstLevel, DstOffset, SrcTexture, SrcLevel, SrcOffset);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data Capture::ReadTexture(Object ID, UInt8 Level, ConstRef<Recti> Offset)
+    {
+        return mDriver->ReadTexture(ID, Level, Offset);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::DeleteTexture(Object ID)
+    {
+        mWriter.WriteEnum(Command::DeleteTexture);
+        mWriter.WriteUInt16(ID);
+
+        mDriver->DeleteTexture(ID);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::Prepare(Object ID, ConstRef<Rectf> Viewport, Clear Target, Color Tint, Real32 Depth, UInt8 Stencil)
+    {
+        mWriter.WriteEnum(Command::Prepare);
+        mWriter.WriteUInt16(ID);
+        mWriter.WriteObject(Viewport);
+        mWriter.WriteEnum(Target);
+        mWriter.WriteObject(Tint);
+        mWriter.WriteReal32(Depth);
+        mWriter.WriteUInt8(Stencil);
+
+        mDriver->Prepare(ID, Viewport, Target, Tint, Depth, Stencil);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::Submit(CPtr<const Submission> Submissions)
+    {
+        mWriter.WriteEnum(Command::Submit);
+        mWriter.WriteBlock(Submissions);
+
+        mDriver->Submit(Submissions);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::Commit(Object ID, Bool Synchronised)
+    {
+        mWriter.WriteEnum(Command::Commit);
+        mWriter.WriteUInt16(ID);
+        mWriter.WriteBool(Synchronised);
+
+        mDriver->Commit(ID, Synchronised);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Capture::Parse(CPtr<UInt8> File, Ref<Vector<CPtr<UInt8>>> Frames)
+    {
+        Reader Input(File);
+
+        if (Input.ReadUInt32() != k_Magic || Input.ReadUInt32() != k_Version)
+        {
+            return false;
+        }
+
+        while (Input.GetAvailable() > 0)
+        {
+            const UInt32 Size = Input.ReadUInt32();
+
+            if (Size > Input.GetAvailable())
+            {
+                Log::Warn("Graphics: Capture is truncated after {} frame(s)", Frames.size());
+                break;
+            }
+            Frames.emplace_back(Input.Read<Ptr<UInt8>>(Size), Size);
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::Execute(Ref<Driver> Driver, Ptr<SDL_Window> Swapchain, CPtr<UInt8> Frame)
+    {
+        Reader Decoder(Frame);
+
+        while (Decoder.GetAvailable() > 0)
+        {
+            switch (Decoder.ReadEnum<Command>())
+            {
+            case Command::Initialize:
+            {
+                const auto Width   = Decoder.ReadUInt16();
+                const auto Height  = Decoder.ReadUInt16();
+                const auto Samples = Decoder.ReadUInt8();
+
+                if (Swapchain)
+                {
+                    SDL_SetWindowSize(Swapchain, Width, Height);
+                }
+                Driver.Initialize(Swapchain, Width, Height, Samples);
+                break;
+            }
+            case Command::Reset:
+            {
+                const auto Width   = Decoder.ReadUInt16();
+                const auto Height  = Decoder.ReadUInt16();
+                const auto Samples = Decoder.ReadUInt8();
+
+                Driver.Reset(Width, Height, Samples);
+                break;
+            }
+            case Command::CreateBuffer:
+            {
+                const auto ID        = Decoder.ReadUInt16();
+                const auto Type      = Decoder.ReadEnum<Usage>();
+                const auto Immutable = Decoder.ReadBool();
+                const auto Length    = Decoder.ReadUInt32();
+                const auto Bytes     = Decoder.ReadBlock<const UInt8>();
+
+                Driver.CreateBuffer(ID, Type, Immutable, Bytes.empty() ? nullptr : Bytes.data(), Length);
+                break;
+            }
+            case Command::CopyBuffer:
+            {
+                const auto DstBuffer = Decoder.ReadUInt16();
+                const auto DstOffset = Decoder.ReadUInt32();
+                const auto SrcBuffer = Decoder.ReadUInt16();
+                const auto SrcOffset = Decoder.ReadUInt32();
+                const auto Size      = Decoder.ReadUInt32();
+
+                Driver.CopyBuffer(DstBuffer, DstOffset, SrcBuffer, SrcOffset, Size);
+                break;
+            }
+            case Command::UpdateBuffer:
+            {
+                const auto ID      = Decoder.ReadUInt16();
+                const auto Discard = Decoder.ReadBool();
+                const auto Offset  = Decoder.ReadUInt32();
+                const auto Bytes   = Decoder.ReadBlock<const UInt8>();
+
+                Driver.UpdateBuffer(ID, Discard, Offset, Bytes);
+                break;
+            }
+            case Command::DeleteBuffer:
+            {
+                Driver.DeleteBuffer(Decoder.ReadUInt16());
+                break;
+            }
+            case Command::CreatePass:
+            {
+                const auto ID        = Decoder.ReadUInt16();
+                const auto Colors    = Decoder.ReadBlock<const Attachment>();
+                const auto Resolves  = Decoder.ReadBlock<const Attachment>();
+                const auto Auxiliary = Decoder.Read<Attachment>();
+
+                Driver.CreatePass(ID, Colors, Resolves, Auxiliary);
+                break;
+            }
+            case Command::DeletePass:
+            {
+                Driver.DeletePass(Decoder.ReadUInt16());
+                break;
+            }
+            case Command::CreatePipeline:
+            {
+                const auto ID         = Decoder.ReadUInt16();
+                const auto Vertex     = Decoder.ReadBlock<const UInt8>();
+                const auto Fragment   = Decoder.ReadBlock<const UInt8>();
+                const auto Geometry   = Decoder.ReadBlock<const UInt8>();
+                const auto Properties = Decoder.Read<Descriptor>();
+
+                Driver.CreatePipeline(ID, Vertex, Fragment, Geometry, Properties);
+                break;
+            }
+            case Command::DeletePipeline:
+            {
+                Driver.DeletePipeline(Decoder.ReadUInt16());
+                break;
+            }
+            case Command::CreateTexture:
+            {
+                const auto ID      = Decoder.ReadUInt16();
+                const auto Format  = Decoder.ReadEnum<TextureFormat>();
+                const auto Layout  = Decoder.ReadEnum<TextureLayout>();
+                const auto Width   = Decoder.ReadUInt16();
+                const auto Height  = Decoder.ReadUInt16();
+                const auto Layers  = Decoder.ReadUInt16();
+                const auto Level   = Decoder.ReadUInt8();
+                const auto Samples = Decoder.ReadUInt8();
+                const auto Bytes   = Decoder.ReadBlock<const UInt8>();
+
+                Driver.CreateTexture(ID, Format, Layout, Width, Height, Layers, Level, Samples, Bytes);
+                break;
+            }
+            case Command::CopyTexture:
+            {
+                const auto DstTexture = Decoder.ReadUInt16();
+                const auto DstLevel   = Decoder.ReadUInt8();
+                const auto DstOffset  = Decoder.ReadObject<Vector2i>();
+                const auto SrcTexture = Decoder.ReadUInt16();
+                const auto SrcLevel   = Decoder.ReadUInt8();
+                const auto SrcOffset  = Decoder.ReadObject<Recti>();
+
+                Driver.CopyTexture(DstTexture, DstLevel, DstOffset, SrcTexture, SrcLevel, SrcOffset);
+                break;
+            }
+            case Command::UpdateTexture:
+            {
+                const auto ID     = Decoder.ReadUInt16();
+                const auto Layer  = Decoder.ReadUInt16();
+                const auto Level  = Decoder.ReadUInt8();
+                const auto Offset = Decoder.ReadObject<Recti>();
+                const auto Pitch  = Decoder.ReadUInt32();
+                const auto Bytes  = Decoder.ReadBlock<const UInt8>();
+
+                Driver.UpdateTexture(ID, Layer, Level, Offset, Pitch, Bytes);
+                break;
+            }
+            case Command::DeleteTexture:
+            {
+                Driver.DeleteTexture(Decoder.ReadUInt16());
+                break;
+            }
+            case Command::Prepare:
+            {
+                const auto ID       = Decoder.ReadUInt16();
+                const auto Viewport = Decoder.ReadObject<Rectf>();
+                const auto Target   = Decoder.ReadEnum<Clear>();
+                const auto Tint     = Decoder.ReadObject<Color>();
+                const auto Depth    = Decoder.ReadReal32();
+                const auto Stencil  = Decoder.ReadUInt8();
+
+                Driver.Prepare(ID, Viewport, Target, Tint, Depth, Stencil);
+                break;
+            }
+            case Command::Submit:
+            {
+                Driver.Submit(Decoder.ReadBlock<const Submission>());
+                break;
+            }
+            case Command::Commit:
+            {
+                const auto ID           = Decoder.ReadUInt16();
+                const auto Synchronised = Decoder.ReadBool();
+
+                Driver.Commit(ID, Synchronised);
+                break;
+            }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Capture::Close()
+    {
+        if (mFile)
+        {
+            Flush();
+
+            SDL_CloseIO(mFile);
+            mFile = nullptr;
+        }
+    }
+}
\ No newline at end of file
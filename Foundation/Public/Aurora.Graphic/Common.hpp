@@ -12,6 +12,7 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Aurora.Base/Memory/TLSF.hpp"
 #include "Aurora.Math/Math.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -156,6 +157,14 @@ namespace Graphic
         Version_6,
     };
 
+    // -=(Undocumented)=-
+    enum class Priority : UInt8
+    {
+        Low,
+        Normal,
+        High,
+    };
+
     // -=(Undocumented)=-
     enum class Stage : UInt8
     {
@@ -435,6 +444,22 @@ namespace Graphic
         UInt32 Offset = 0;
     };
 
+    // -=(Undocumented)=-
+    struct Range
+    {
+        // -=(Undocumented)=-
+        Object           Buffer = 0;
+
+        // -=(Undocumented)=-
+        TLSF::Allocation Allocation;
+
+        // -=(Undocumented)=-
+        UInt32 GetOffset() const
+        {
+            return Allocation.Offset;
+        }
+    };
+
     // -=(Undocumented)=-
     struct Capabilities
     {
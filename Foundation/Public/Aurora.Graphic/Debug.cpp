@@ -0,0 +1,491 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Debug.hpp"
+#include "Aurora.Content/Service.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    struct Outline
+    {
+        // -=(Undocumented)=-
+        Vector4f Color;
+
+        // -=(Undocumented)=-
+        Real32   Thickness;
+    };
+
+    // -=(Undocumented)=-
+    static constexpr Array<UInt8, 24> k_Edges = {
+        0, 1, 1, 3, 3, 2, 2, 0, 4, 5, 5, 7, 7, 6, 6, 4, 0, 4, 1, 5, 2, 6, 3, 7
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Acquire(Ref<Atomic_Flag> Lock)
+    {
+        while (Lock.test_and_set(std::memory_order_acquire))
+        {
+            Lock.wait(true, std::memory_order_relaxed);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Release(Ref<Atomic_Flag> Lock)
+    {
+        Lock.clear(std::memory_order_release);
+        Lock.notify_one();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 GetSerial()
+    {
+        static Atomic<UInt32> Counter { 0 };
+        return Counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static ConstRef<Array<Vector2f, Debug::k_Segments>> GetCircle()
+    {
+        static const Array<Vector2f, Debug::k_Segments> Circle = []()
+        {
+            Array<Vector2f, Debug::k_Segments> Points;
+
+            for (UInt32 Segment = 0; Segment < Debug::k_Segments; ++Segment)
+            {
+                const Real32 Angle = (2.0f * k_PI * Segment) / Debug::k_Segments;
+                Points[Segment] = Vector2f(std::cos(Angle), std::sin(Angle));
+            }
+            return Points;
+        }();
+        return Circle;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Debug::Debug(Ref<Context> Context)
+        : AbstractSubsystem(Context),
+          mSerial { GetSerial() }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Debug::Initialize()
+    {
+        const SPtr<Content::Service> Content = GetSubsystem<Content::Service>();
+
+        if (!Content)
+        {
+            return false;
+        }
+
+        mPipelines[false] = Content->Load<Pipeline>("Engine://Pipeline/DebugOverlay.effect");
+        mPipelines[true]  = Content->Load<Pipeline>("Engine://Pipeline/Debug.effect");
+        mLabelPipeline    = Content->Load<Pipeline>("Engine://Pipeline/DebugLabel.effect");
+        return mPipelines[false] && mPipelines[true];
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::OnTick(Real64 Time, Real64 Delta)
+    {
+        for (Ref<Timed> Timed : mTimeds)
+        {
+            Timed.Remaining -= Delta;
+        }
+
+        for (Ref<Label> Label : mLabels)
+        {
+            Label.Remaining -= Delta;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::DrawLine(ConstRef<Vector3f> From, ConstRef<Vector3f> To, Color Tint, Real32 Duration, Bool Depth)
+    {
+        const Array<Vertex, 2> Vertices = {
+            Vertex { From, Tint.GetValue() },
+            Vertex { To,   Tint.GetValue() }
+        };
+        Submit(Vertices, Duration, Depth);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::DrawBox(ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum, Color Tint, Real32 Duration, Bool Depth)
+    {
+        Array<Vertex, k_Edges.size()> Vertices;
+
+        for (UInt32 Index = 0; Index < k_Edges.size(); ++Index)
+        {
+            const UInt8 Corner = k_Edges[Index];
+
+            Vertices[Index].Position = Vector3f(
+                (Corner & 1 ? Maximum : Minimum).GetX(),
+                (Corner & 2 ? Maximum : Minimum).GetY(),
+                (Corner & 4 ? Maximum : Minimum).GetZ());
+            Vertices[Index].Tint     = Tint.GetValue();
+        }
+        Submit(Vertices, Duration, Depth);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::DrawSphere(ConstRef<Vector3f> Center, Real32 Radius, Color Tint, Real32 Duration, Bool Depth)
+    {
+        ConstRef<Array<Vector2f, k_Segments>> Circle = GetCircle();
+
+        // One great circle around every axis, which reads as a sphere from any point of view.
+        Array<Vertex, k_Segments * 6> Vertices;
+
+        for (UInt32 Segment = 0, Index = 0; Segment < k_Segments; ++Segment)
+        {
+            const Vector2f First  = Circle[Segment] * Radius;
+            const Vector2f Second = Circle[(Segment + 1) % k_Segments] * Radius;
+
+            const auto Emit = [&](ConstRef<Vector3f> From, ConstRef<Vector3f> To)
+            {
+                Vertices[Index++] = Vertex { Center + From, Tint.GetValue() };
+                Vertices[Index++] = Vertex { Center + To,   Tint.GetValue() };
+            };
+            Emit(Vector3f(First.GetX(), First.GetY(), 0.0f), Vector3f(Second.GetX(), Second.GetY(), 0.0f));
+            Emit(Vector3f(First.GetX(), 0.0f, First.GetY()), Vector3f(Second.GetX(), 0.0f, Second.GetY()));
+            Emit(Vector3f(0.0f, First.GetX(), First.GetY()), Vector3f(0.0f, Second.GetX(), Second.GetY()));
+        }
+        Submit(Vertices, Duration, Depth);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::DrawFrustum(ConstRef<Matrix4f> World, Color Tint, Real32 Duration, Bool Depth)
+    {
+        // Unproject the corners of the clip volume (depth goes from 0 to 1) back into world space.
+        const Matrix4f Inverse = World.Inverse();
+
+        Array<Vertex, k_Edges.size()> Vertices;
+
+        for (UInt32 Index = 0; Index < k_Edges.size(); ++Index)
+        {
+            const UInt8 Corner = k_Edges[Index];
+
+            Vertices[Index].Position = Inverse * Vector3f(
+                Corner & 1 ? +1.0f : -1.0f,
+                Corner & 2 ? +1.0f : -1.0f,
+                Corner & 4 ? +1.0f :  0.0f);
+            Vertices[Index].Tint     = Tint.GetValue();
+        }
+        Submit(Vertices, Duration, Depth);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::DrawLabel(ConstRef<Vector3f> Position, CStr16 Text, Color Tint, Real32 Size, Real32 Duration)
+    {
+        Ref<Batch> Batch = GetBatch();
+
+        Acquire(Batch.Lock);
+        Batch.Labels.push_back(Label { Position, SStr16(Text), Tint.GetValue(), Size, Duration });
+        Release(Batch.Lock);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::Draw(Ref<Encoder> Encoder, ConstRef<Camera> Camera)
+    {
+        Collect();
+
+        if (const SPtr<Service> Graphics = GetSubsystem<Service>(); Graphics && mPipelines[false] && mPipelines[true])
+        {
+            const Binding Scene = Graphics->Allocate<Matrix4f>(Usage::Uniform, CastSpan(Camera.GetWorld()));
+
+            DrawLines(Encoder, * Graphics, Scene);
+
+            if (mFont && mLabelPipeline)
+            {
+                DrawLabels(Encoder, * Graphics, Scene, Camera);
+            }
+        }
+
+        // Immediate primitives live for a single frame, timed ones until their duration runs out.
+        mLines[false].clear();
+        mLines[true].clear();
+
+        std::erase_if(mTimeds, [](ConstRef<Timed> Timed)
+        {
+            return Timed.Remaining <= 0.0f;
+        });
+        std::erase_if(mLabels, [](ConstRef<Label> Label)
+        {
+            return Label.Remaining <= 0.0f;
+        });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Ref<Debug::Batch> Debug::GetBatch()
+    {
+        // Every thread records into a batch of its own, only the first submission of a thread has to go through
+        // the registry. The serial tells apart batches that belong to a previous instance of this service.
+        thread_local UInt32     t_Owner = 0;
+        thread_local Ptr<Batch> t_Batch = nullptr;
+
+        if (t_Owner != mSerial)
+        {
+            Acquire(mRegistry);
+            t_Batch = mBatches.emplace_back(NewUniquePtr<Batch>()).get();
+            t_Owner = mSerial;
+            Release(mRegistry);
+        }
+        return * t_Batch;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::Submit(CPtr<const Vertex> Vertices, Real32 Duration, Bool Depth)
+    {
+        Ref<Batch> Batch = GetBatch();
+
+        Acquire(Batch.Lock);
+
+        if (Duration > 0.0f)
+        {
+            for (UInt32 Index = 0; Index + 1 < Vertices.size(); Index += 2)
+            {
+                Batch.Timeds.push_back(Timed { Vertices[Index], Vertices[Index + 1], Duration, Depth });
+            }
+        }
+        else
+        {
+            Batch.Lines[Depth].insert(Batch.Lines[Depth].end(), Vertices.begin(), Vertices.end());
+        }
+
+        Release(Batch.Lock);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::Collect()
+    {
+        Acquire(mRegistry);
+
+        for (ConstRef<UPtr<Batch>> Batch : mBatches)
+        {
+            Acquire(Batch->Lock);
+
+            for (const Bool Depth : { false, true })
+            {
+                mLines[Depth].insert(mLines[Depth].end(), Batch->Lines[Depth].begin(), Batch->Lines[Depth].end());
+                Batch->Lines[Depth].clear();
+            }
+
+            mTimeds.insert(mTimeds.end(), Batch->Timeds.begin(), Batch->Timeds.end());
+            Batch->Timeds.clear();
+
+            std::move(Batch->Labels.begin(), Batch->Labels.end(), std::back_inserter(mLabels));
+            Batch->Labels.clear();
+
+            Release(Batch->Lock);
+        }
+
+        Release(mRegistry);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::DrawLines(Ref<Encoder> Encoder, Ref<Service> Graphics, ConstRef<Binding> Scene)
+    {
+        Array<UInt32, 2> Counts = {
+            static_cast<UInt32>(mLines[false].size()), static_cast<UInt32>(mLines[true].size())
+        };
+
+        for (ConstRef<Timed> Timed : mTimeds)
+        {
+            Counts[Timed.Depth] += 2;
+        }
+
+        const UInt32 Total = Min(Counts[false] + Counts[true], k_MaxVertices);
+
+        if (Total == 0)
+        {
+            return;
+        }
+
+        // Both layers share a single transient allocation, the depth tested one goes first so it is the one
+        // that survives when the frame goes over budget.
+        const Frame::Allocation<Vertex> Allocation = Graphics.Allocate<Vertex>(Usage::Vertex, Total);
+
+        UInt32 Written = 0;
+
+        for (const Bool Depth : { true, false })
+        {
+            const UInt32 First = Written;
+            const UInt32 Count = Min(static_cast<UInt32>(mLines[Depth].size()), Total - Written);
+
+            std::memcpy(Allocation.Pointer + Written, mLines[Depth].data(), Count * sizeof(Vertex));
+            Written += Count;
+
+            for (ConstRef<Timed> Timed : mTimeds)
+            {
+                if (Timed.Depth == Depth && Written + 2 <= Total)
+                {
+                    Allocation.Pointer[Written++] = Timed.From;
+                    Allocation.Pointer[Written++] = Timed.To;
+                }
+            }
+
+            if (Written > First)
+            {
+                Encoder.SetVertices(0, Allocation.Binding);
+                Encoder.SetUniforms(0, Scene);
+                Encoder.SetPipeline(* mPipelines[Depth]);
+                Encoder.Draw(Written - First, 0, First);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Debug::DrawLabels(
+        Ref<Encoder> Encoder, Ref<Service> Graphics, ConstRef<Binding> Scene, ConstRef<Camera> Camera)
+    {
+        UInt32 Capacity = 0;
+
+        for (ConstRef<Label> Label : mLabels)
+        {
+            Capacity += Label.Text.size();
+        }
+        Capacity = Min(Capacity, k_MaxGlyphs);
+
+        if (Capacity == 0)
+        {
+            return;
+        }
+
+        const Frame::Allocation<Character> Allocation = Graphics.Allocate<Character>(Usage::Vertex, Capacity * 6);
+
+        // Labels always face the camera, the rows of the view matrix are the camera axes in world space.
+        ConstRef<Matrix4f> View  = Camera.GetScene();
+        const Vector3f     Right = Vector3f( View.GetComponent(0),  View.GetComponent(4),  View.GetComponent(8));
+        const Vector3f     Down  = Vector3f(-View.GetComponent(1), -View.GetComponent(5), -View.GetComponent(9));
+
+        ConstRef<Font::Metrics> Metrics = mFont->GetMetrics();
+
+        UInt32 Written = 0;
+
+        for (ConstRef<Label> Label : mLabels)
+        {
+            Real32 CursorX = 0.0f;
+            Real32 CursorY = 0.0f;
+
+            for (UInt32 Previous = 0, Symbol = 0; Symbol < Label.Text.size() && Written < Capacity; ++Symbol)
+            {
+                const UInt32 Codepoint = Label.Text[Symbol];
+
+                if (Codepoint == '\n')
+                {
+                    CursorX  = 0.0f;
+                    CursorY += Metrics.UnderlineHeight * Label.Size;
+                    Previous = 0;
+                    continue;
+                }
+
+                const Ptr<const Font::Glyph> Glyph = mFont->GetGlyph(Codepoint);
+
+                if (!Glyph)
+                {
+                    continue;
+                }
+
+                CursorX += mFont->GetKerning(Previous, Codepoint) * Label.Size;
+
+                ConstRef<Rectf> Plane = Glyph->PlaneBounds;
+                ConstRef<Rectf> Image = Glyph->ImageBounds;
+
+                const auto GetCorner = [&](Real32 X, Real32 Y, Real32 U, Real32 V)
+                {
+                    const Vector3f Offset = Right * (CursorX + X * Label.Size) + Down * (CursorY + Y * Label.Size);
+                    return Character { Label.Position + Offset, Vector2f(U, V), Label.Tint };
+                };
+
+                const Character TopLeft
+                    = GetCorner(Plane.GetLeft(),  Plane.GetTop(),    Image.GetLeft(),  Image.GetTop());
+                const Character TopRight
+                    = GetCorner(Plane.GetRight(), Plane.GetTop(),    Image.GetRight(), Image.GetTop());
+                const Character BottomLeft
+                    = GetCorner(Plane.GetLeft(),  Plane.GetBottom(), Image.GetLeft(),  Image.GetBottom());
+                const Character BottomRight
+                    = GetCorner(Plane.GetRight(), Plane.GetBottom(), Image.GetRight(), Image.GetBottom());
+
+                const Ptr<Character> Quad = Allocation.Pointer + Written * 6;
+                Quad[0] = TopLeft;
+                Quad[1] = TopRight;
+                Quad[2] = BottomRight;
+                Quad[3] = TopLeft;
+                Quad[4] = BottomRight;
+                Quad[5] = BottomLeft;
+                ++Written;
+
+                CursorX += Glyph->Advance * Label.Size;
+                Previous = Codepoint;
+            }
+        }
+
+        if (Written == 0)
+        {
+            return;
+        }
+
+        // A thin dark outline keeps the labels readable on top of any kind of geometry.
+        constexpr Outline k_Outline { Vector4f(0.0f, 0.0f, 0.0f, 1.0f), 0.125f };
+
+        ConstSPtr<Material> Material   = mFont->GetMaterial();
+        const Binding       Parameters = Graphics.Allocate<UInt8>(Usage::Uniform, Material->GetParameters());
+        const Binding       Instance   = Graphics.Allocate<Outline>(Usage::Uniform, CastSpan(k_Outline));
+
+        Encoder.SetVertices(0, Allocation.Binding);
+        Encoder.SetUniforms(0, Scene);
+        Encoder.SetUniforms(2, Parameters);
+        Encoder.SetUniforms(3, Instance);
+        Encoder.SetPipeline(* mLabelPipeline);
+        Encoder.SetTexture(0, * Material->GetTexture(TextureSlot::Diffuse));
+        Encoder.SetSampler(0, Material->GetSampler(TextureSlot::Diffuse));
+        Encoder.Draw(Written * 6, 0, 0);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Camera.hpp"
+#include "Font.hpp"
+#include "Service.hpp"
+#include "Aurora.Math/Color.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    class Debug final : public AbstractSubsystem<Debug>, public Tickable
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxVertices = 64 * 1024;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxGlyphs   = 4 * 1024;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Segments    = 24;
+
+        // -=(Undocumented)=-
+        struct Vertex
+        {
+            // -=(Undocumented)=-
+            Vector3f Position;
+
+            // -=(Undocumented)=-
+            UInt32   Tint;
+        };
+
+        // -=(Undocumented)=-
+        struct Character
+        {
+            // -=(Undocumented)=-
+            Vector3f Position;
+
+            // -=(Undocumented)=-
+            Vector2f TexCoord;
+
+            // -=(Undocumented)=-
+            UInt32   Tint;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        explicit Debug(Ref<Context> Context);
+
+        // -=(Undocumented)=-
+        Bool Initialize();
+
+        // \see Tickable::OnTick(Real64, Real64)
+        void OnTick(Real64 Time, Real64 Delta) override;
+
+        // -=(Undocumented)=-
+        void SetFont(ConstSPtr<Font> Font)
+        {
+            mFont = Font;
+        }
+
+        // -=(Undocumented)=-
+        ConstSPtr<Font> GetFont() const
+        {
+            return mFont;
+        }
+
+        // -=(Undocumented)=-
+        void DrawLine(ConstRef<Vector3f> From, ConstRef<Vector3f> To, Color Tint,
+                      Real32 Duration = 0.0f, Bool Depth = true);
+
+        // -=(Undocumented)=-
+        void DrawBox(ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum, Color Tint,
+                     Real32 Duration = 0.0f, Bool Depth = true);
+
+        // -=(Undocumented)=-
+        void DrawSphere(ConstRef<Vector3f> Center, Real32 Radius, Color Tint,
+                        Real32 Duration = 0.0f, Bool Depth = true);
+
+        // -=(Undocumented)=-
+        void DrawFrustum(ConstRef<Matrix4f> World, Color Tint, Real32 Duration = 0.0f, Bool Depth = true);
+
+        // -=(Undocumented)=-
+        void DrawLabel(ConstRef<Vector3f> Position, CStr16 Text, Color Tint, Real32 Size, Real32 Duration = 0.0f);
+
+        // -=(Undocumented)=-
+        void Draw(Ref<Encoder> Encoder, ConstRef<Camera> Camera);
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Timed
+        {
+            // -=(Undocumented)=-
+            Vertex From;
+
+            // -=(Undocumented)=-
+            Vertex To;
+
+            // -=(Undocumented)=-
+            Real32 Remaining;
+
+            // -=(Undocumented)=-
+            Bool   Depth;
+        };
+
+        // -=(Undocumented)=-
+        struct Label
+        {
+            // -=(Undocumented)=-
+            Vector3f Position;
+
+            // -=(Undocumented)=-
+            SStr16   Text;
+
+            // -=(Undocumented)=-
+            UInt32   Tint;
+
+            // -=(Undocumented)=-
+            Real32   Size;
+
+            // -=(Undocumented)=-
+            Real32   Remaining;
+        };
+
+        // -=(Undocumented)=-
+        struct Batch
+        {
+            // -=(Undocumented)=-
+            Atomic_Flag              Lock;
+
+            // -=(Undocumented)=-
+            Array<Vector<Vertex>, 2> Lines;
+
+            // -=(Undocumented)=-
+            Vector<Timed>            Timeds;
+
+            // -=(Undocumented)=-
+            Vector<Label>            Labels;
+        };
+
+        // -=(Undocumented)=-
+        Ref<Batch> GetBatch();
+
+        // -=(Undocumented)=-
+        void Submit(CPtr<const Vertex> Vertices, Real32 Duration, Bool Depth);
+
+        // -=(Undocumented)=-
+        void Collect();
+
+        // -=(Undocumented)=-
+        void DrawLines(Ref<Encoder> Encoder, Ref<Service> Graphics, ConstRef<Binding> Scene);
+
+        // -=(Undocumented)=-
+        void DrawLabels(Ref<Encoder> Encoder, Ref<Service> Graphics, ConstRef<Binding> Scene, ConstRef<Camera> Camera);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UInt32                     mSerial;
+        Atomic_Flag                mRegistry;
+        Vector<UPtr<Batch>>        mBatches;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Array<Vector<Vertex>, 2>   mLines;
+        Vector<Timed>              mTimeds;
+        Vector<Label>              mLabels;
+        Array<SPtr<Pipeline>, 2>   mPipelines;
+        SPtr<Pipeline>             mLabelPipeline;
+        SPtr<Font>                 mFont;
+    };
+}
\ No newline at end of file
@@ -124,6 +124,18 @@ namespace Graphic
             SetTexture(Slot, Texture.GetID());
         }
 
+        // -=(Undocumented)=-
+        ConstRef<Submission> GetInFlight() const
+        {
+            return mInFlightCommand;
+        }
+
+        // -=(Undocumented)=-
+        void SetInFlight(ConstRef<Submission> Command)
+        {
+            mInFlightCommand = Command;
+        }
+
         // -=(Undocumented)=-
         void Draw(UInt32 Count, UInt32 Base, UInt32 Offset, UInt32 Instances = 0)
         {
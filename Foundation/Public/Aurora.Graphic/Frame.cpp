@@ -21,8 +21,10 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Frame::Initialize(Object Vertices, Object Indices, Object Uniforms)
+    void Frame::Initialize(Object Vertices, Object Indices, Object Uniforms, Object Sequence)
     {
+        mSequence = Sequence;
+
         CreateTransientBuffer(mHeap[CastEnum(Usage::Vertex)], Vertices, k_DefaultVertices);
         CreateTransientBuffer(mHeap[CastEnum(Usage::Index)], Indices, k_DefaultIndices);
         CreateTransientBuffer(mHeap[CastEnum(Usage::Uniform)], Uniforms, k_DefaultUniforms);
@@ -49,6 +51,9 @@ namespace Graphic
         // This method ensures that any previously encoded data is discarded,
         // making the encoder ready for new data to be processed.
         mEncoder.Clear();
+
+        // The uniform heap was emptied when uploaded, there is no block left to keep packing into.
+        mPacked.clear();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -35,6 +35,15 @@ namespace Graphic
         // -=(Undocumented)=-
         static constexpr UInt32 k_DefaultUniforms = 1 * 1024 * 1024;
 
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_PackedBlock     = 16 * 1024;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_PackedLimit     = k_PackedBlock / 16;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_UniformLimit    = UINT16_MAX / k_Alignment * k_Alignment;
+
         // -=(Undocumented)=-
         template<typename Format>
         struct Allocation
@@ -46,10 +55,24 @@ namespace Graphic
             Binding     Binding;
         };
 
+        // -=(Undocumented)=-
+        template<typename Format>
+        struct Packet
+        {
+            // -=(Undocumented)=-
+            Ptr<Format> Pointer;
+
+            // -=(Undocumented)=-
+            Binding     Uniforms;
+
+            // -=(Undocumented)=-
+            Binding     Index;
+        };
+
     public:
 
         // -=(Undocumented)=-
-        void Initialize(Object Vertices, Object Indices, Object Uniforms);
+        void Initialize(Object Vertices, Object Indices, Object Uniforms, Object Sequence);
 
         // -=(Undocumented)=-
         Ref<Encoder> GetEncoder()
@@ -61,23 +84,74 @@ namespace Graphic
         template<typename Format>
         Allocation<Format> Allocate(Usage Type, UInt32 Length, UInt32 Stride = sizeof(Format))
         {
-            // This is essential for uniform buffer allocations to maintain alignment requirements.
+            UInt32 Alignment = Stride;
+            UInt32 Window    = Stride;
+
+            // This is essential for uniform buffer allocations to maintain alignment requirements, the whole
+            // allocation is bound as a single window so its stride spans every block of it.
             if (Type == Usage::Uniform)
             {
-                Stride = k_Alignment;
-                Length = Align(Length, k_Alignment) / k_Alignment;
+                // The window is stored in a 16-bit stride, which can't describe a full 64 KiB constant buffer.
+                SDL_assert(Length <= k_UniformLimit);
+
+                Alignment = k_Alignment;
+                Stride    = Align(Length, k_Alignment);
+                Window    = Min(Stride, k_UniformLimit);
+                Length    = 1;
             }
 
             Ref<TransientBuffer> Buffer = mHeap[CastEnum(Type)];
 
             Ref<Writer> Writer = Buffer.Writer;
-            UInt32 Offset      = Align(Writer.GetOffset(), Stride);
+            UInt32 Offset      = Align(Writer.GetOffset(), Alignment);
 
             if (const UInt32 Skip = Offset - Writer.GetOffset(); Skip > 0)
             {
                 Writer.Reserve<UInt8>(Skip);
             }
-            return Allocation<Format>(Writer.Reserve<Format>(Length * Stride), Binding(Buffer.ID, Stride, Offset));
+            return Allocation<Format>(Writer.Reserve<Format>(Length * Stride), Binding(Buffer.ID, Window, Offset));
+        }
+
+        // -=(Undocumented)=-
+        template<typename Format>
+        Packet<Format> Pack()
+        {
+            static_assert(sizeof(Format) % 16 == 0, "Packed constants must be made of whole 16-byte registers");
+
+            // Small per-draw constants share a block of the uniform heap instead of taking an aligned block each,
+            // the shader declares them as an array and picks its own element through a per-instance index read
+            // from the sequence buffer, which is bound at an offset that equals the element.
+            constexpr UInt32 Stride   = sizeof(Format);
+            constexpr UInt32 Capacity = k_PackedBlock / Stride;
+
+            Ref<TransientBuffer> Buffer = mHeap[CastEnum(Usage::Uniform)];
+            Ref<Writer>          Writer = Buffer.Writer;
+
+            // The whole block is reserved up front, so every packet in it shares the same uniform binding and
+            // consecutive draws only differ by their index. Each stride keeps its own open block, so that
+            // interleaving draws of different formats doesn't abandon a mostly empty block on every switch.
+            Ref<Packed> Block = mPacked[Stride];
+
+            if (Block.Stride != Stride || Block.Count == Capacity)
+            {
+                const UInt32 Offset = Align(Writer.GetOffset(), k_Alignment);
+
+                if (const UInt32 Skip = Offset - Writer.GetOffset(); Skip > 0)
+                {
+                    Writer.Reserve<UInt8>(Skip);
+                }
+                Writer.Reserve<UInt8>(k_PackedBlock);
+
+                Block = Packed { Offset, Stride, 0 };
+            }
+
+            const UInt32 Element = Block.Count++;
+            const auto   Pointer = Writer.GetData().data() + Block.Offset + Element * Stride;
+
+            return Packet<Format>(
+                reinterpret_cast<Ptr<Format>>(Pointer),
+                Binding(Buffer.ID, k_PackedBlock, Block.Offset),
+                Binding(mSequence, sizeof(UInt32), Element * sizeof(UInt32)));
         }
 
         // -=(Undocumented)=-
@@ -101,6 +175,19 @@ namespace Graphic
             Writer Writer;
         };
 
+        // -=(Undocumented)=-
+        struct Packed
+        {
+            // -=(Undocumented)=-
+            UInt32 Offset = 0;
+
+            // -=(Undocumented)=-
+            UInt32 Stride = 0;
+
+            // -=(Undocumented)=-
+            UInt32 Count  = 0;
+        };
+
         // -=(Undocumented)=-
         using Heap = Array<TransientBuffer, CountEnum<Usage>()>;
 
@@ -115,7 +202,9 @@ namespace Graphic
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Encoder mEncoder;
-        Heap    mHeap;
+        Encoder               mEncoder;
+        Heap                  mHeap;
+        Table<UInt32, Packed> mPacked;
+        Object                mSequence;
     };
 }
\ No newline at end of file
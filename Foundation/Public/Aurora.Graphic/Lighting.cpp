@@ -0,0 +1,416 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Lighting.hpp"
+#include "Aurora.Math/SIMD.hpp"
+#include <bit>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt8 GetTile(Real32 Coordinate, UInt32 Tiles)
+    {
+        const Real32 Tile = (Coordinate * 0.5f + 0.5f) * static_cast<Real32>(Tiles);
+        return static_cast<UInt8>(std::clamp(static_cast<SInt32>(Tile), 0, static_cast<SInt32>(Tiles - 1)));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Lighting::Lighting(Ref<Context> Context)
+        : AbstractSubsystem(Context),
+          mVolumes    { NewUniquePtr<Volumes>() },
+          mScaleX     { 0.0f },
+          mScaleY     { 0.0f },
+          mNear       { 0.0f },
+          mFar        { 0.0f },
+          mCounts     { }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Lighting::Initialize(UInt32 Threads)
+    {
+        if (mScheduler.GetThreads() == 0)
+        {
+            mScheduler.Initialize(Threads);
+            Log::Info("Lighting - Initialized with {} threads", Threads);
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Lighting::Submit(ConstRef<Light> Light)
+    {
+        if (mLights.size() < k_MaxLights)
+        {
+            mLights.push_back(Light);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Lighting::Clusters Lighting::Compute(ConstRef<Camera> Camera)
+    {
+        const SPtr<Service> Graphics = GetSubsystem<Service>();
+
+        if (!Graphics)
+        {
+            mLights.clear();
+            return Clusters();
+        }
+
+        // Clustering relies on a perspective projection, where the clip W is the view depth, an orthographic
+        // camera keeps its bindings but sees no light at all.
+        ConstRef<Matrix4f> Projection  = Camera.GetProjection();
+        const Bool         Perspective = (Projection.GetComponent(11) != 0.0f);
+
+        mCandidates.clear();
+
+        if (Perspective)
+        {
+            const Real32 ScaleX = Projection.GetComponent(0);
+            const Real32 ScaleY = Projection.GetComponent(5);
+            const Real32 Near   = -Projection.GetComponent(14) / Projection.GetComponent(10);
+            const Real32 Far    =  Projection.GetComponent(14) / (1.0f - Projection.GetComponent(10));
+
+            if (ScaleX != mScaleX || ScaleY != mScaleY || Near != mNear || Far != mFar)
+            {
+                mScaleX = ScaleX;
+                mScaleY = ScaleY;
+                mNear   = Near;
+                mFar    = Far;
+                Rebuild();
+            }
+        }
+
+        const Real32 SliceScale = (Perspective ? static_cast<Real32>(k_Slices) / std::log(mFar / mNear) : 0.0f);
+        const Real32 SliceBias  = (Perspective ? -std::log(mNear) * SliceScale : 0.0f);
+
+        const auto GetSlice = [&](Real32 Depth)
+        {
+            const Real32 Slice = std::log(Max(Depth, mNear)) * SliceScale + SliceBias;
+            return static_cast<UInt8>(std::clamp(static_cast<SInt32>(Slice), 0, static_cast<SInt32>(k_Slices - 1)));
+        };
+
+        // Move every light into view space and bound it in tiles and slices, the workers only have to refine
+        // the clusters inside of that box.
+        ConstRef<Matrix4f> View = Camera.GetScene();
+
+        for (UInt32 Index = 0; Perspective && Index < mLights.size(); ++Index)
+        {
+            ConstRef<Light> Light = mLights[Index];
+
+            const Vector3f Center = View * Light.Position;
+            const Real32   Radius = Light.Range;
+
+            const Real32 Closest  = Center.GetZ() - Radius;
+            const Real32 Furthest = Center.GetZ() + Radius;
+
+            if (Furthest < mNear || Closest > mFar)
+            {
+                continue;
+            }
+
+            // The box of the sphere projects to its widest at the nearest depth and to its narrowest at the
+            // furthest one, the extremes of both bound the whole sphere on screen.
+            const Real32 Front = Max(Closest, mNear);
+            const Real32 Back  = Max(Furthest, mNear);
+
+            const Real32 Left   = Min((Center.GetX() - Radius) / Front, (Center.GetX() - Radius) / Back) * mScaleX;
+            const Real32 Right  = Max((Center.GetX() + Radius) / Front, (Center.GetX() + Radius) / Back) * mScaleX;
+            const Real32 Bottom = Min((Center.GetY() - Radius) / Front, (Center.GetY() - Radius) / Back) * mScaleY;
+            const Real32 Top    = Max((Center.GetY() + Radius) / Front, (Center.GetY() + Radius) / Back) * mScaleY;
+
+            if (Left > 1.0f || Right < -1.0f || Bottom > 1.0f || Top < -1.0f)
+            {
+                continue;
+            }
+
+            Candidate Candidate;
+            Candidate.Source   = Index;
+            Candidate.Center   = Center;
+            Candidate.Radius   = Radius;
+            Candidate.Cone     = (Light.Type == Shape::Spot);
+            Candidate.MinimumX = GetTile(Left, k_TilesX);
+            Candidate.MaximumX = GetTile(Right, k_TilesX);
+            Candidate.MinimumY = GetTile(Bottom, k_TilesY);
+            Candidate.MaximumY = GetTile(Top, k_TilesY);
+            Candidate.MinimumZ = GetSlice(Closest);
+            Candidate.MaximumZ = GetSlice(Furthest);
+
+            if (Candidate.Cone)
+            {
+                ConstRef<Vector3f> Axis      = Light.Direction;
+                const Vector4f     Direction = View * Vector4f(Axis.GetX(), Axis.GetY(), Axis.GetZ(), 0.0f);
+
+                Candidate.Direction = Vector3f::Normalize(
+                    Vector3f(Direction.GetX(), Direction.GetY(), Direction.GetZ()));
+                Candidate.Cosine    = Cosine(Light.Outer);
+                Candidate.Sine      = Sine(Light.Outer);
+            }
+            mCandidates.push_back(Candidate);
+        }
+
+        // Every slice is owned by a single thread, so the clusters can be filled without any synchronization.
+        mCounts.fill(0);
+
+        if (!mCandidates.empty())
+        {
+            mScheduler.Dispatch(k_Slices, [this](UInt32 Slice)
+            {
+                Assign(Slice);
+            });
+        }
+
+        // The light block starts with the slice parameters and the number of lights, followed by three registers
+        // per light: view position and range, color and inner cosine, view direction and outer cosine. A point
+        // light gets cosines that every direction passes.
+        const UInt32 LightBytes = (4 + mCandidates.size() * 12) * sizeof(Real32);
+
+        const Frame::Allocation<Real32> Lights = Graphics->Allocate<Real32>(Usage::Uniform, LightBytes);
+        Ptr<Real32> Block = Lights.Pointer;
+
+        (* Block++) = SliceScale;
+        (* Block++) = SliceBias;
+        (* Block++) = std::bit_cast<Real32>(static_cast<UInt32>(mCandidates.size()));
+        (* Block++) = 0.0f;
+
+        for (ConstRef<Candidate> Candidate : mCandidates)
+        {
+            ConstRef<Light> Light = mLights[Candidate.Source];
+
+            const Vector3f Color = Light.Color * Light.Intensity;
+            const Bool     Spot  = Candidate.Cone;
+
+            (* Block++) = Candidate.Center.GetX();
+            (* Block++) = Candidate.Center.GetY();
+            (* Block++) = Candidate.Center.GetZ();
+            (* Block++) = Candidate.Radius;
+            (* Block++) = Color.GetX();
+            (* Block++) = Color.GetY();
+            (* Block++) = Color.GetZ();
+            (* Block++) = (Spot ? Cosine(Light.Inner) : -1.0f);
+            (* Block++) = (Spot ? Candidate.Direction.GetX() : 0.0f);
+            (* Block++) = (Spot ? Candidate.Direction.GetY() : 0.0f);
+            (* Block++) = (Spot ? Candidate.Direction.GetZ() : 1.0f);
+            (* Block++) = (Spot ? Candidate.Cosine : -2.0f);
+        }
+
+        // The list block starts with one word per cluster (offset in the low half, count in the high half)
+        // followed by the light indices of every cluster packed two per word.
+        const Frame::Allocation<UInt32> Lists = Graphics->Allocate<UInt32>(Usage::Uniform, k_ListBytes);
+        const Ptr<UInt16>               Indices = reinterpret_cast<Ptr<UInt16>>(Lists.Pointer + k_Clusters);
+
+        UInt32 Offset = 0;
+
+        for (UInt32 Cluster = 0; Cluster < k_Clusters; ++Cluster)
+        {
+            const UInt32 Count = Min<UInt32>(mCounts[Cluster], k_MaxIndices - Offset);
+
+            std::copy_n(mAffected.data() + Cluster * k_MaxAffected, Count, Indices + Offset);
+
+            Lists.Pointer[Cluster] = Offset | Count << 16;
+            Offset += Count;
+        }
+
+        mLights.clear();
+        return Clusters(Lights.Binding, Lists.Binding);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Lighting::Rebuild()
+    {
+        Ref<Volumes> Volumes = (* mVolumes);
+
+        // Tiles split the screen evenly while slices grow exponentially with depth, a tile edge in normalized
+        // device coordinates spreads linearly with depth in view space.
+        for (UInt32 Slice = 0; Slice < k_Slices; ++Slice)
+        {
+            const Real32 Ratio = mFar / mNear;
+            const Real32 Front = mNear * std::pow(Ratio, static_cast<Real32>(Slice)     / k_Slices);
+            const Real32 Back  = mNear * std::pow(Ratio, static_cast<Real32>(Slice + 1) / k_Slices);
+
+            for (UInt32 Y = 0; Y < k_TilesY; ++Y)
+            {
+                const Real32 Bottom = (2.0f * Y / k_TilesY - 1.0f) / mScaleY;
+                const Real32 Top    = (2.0f * (Y + 1) / k_TilesY - 1.0f) / mScaleY;
+
+                for (UInt32 X = 0; X < k_TilesX; ++X)
+                {
+                    const Real32 Left  = (2.0f * X / k_TilesX - 1.0f) / mScaleX;
+                    const Real32 Right = (2.0f * (X + 1) / k_TilesX - 1.0f) / mScaleX;
+
+                    const UInt32 Cluster = (Slice * k_TilesY + Y) * k_TilesX + X;
+
+                    const Vector3f Minimum(Min(Left * Front, Left * Back), Min(Bottom * Front, Bottom * Back), Front);
+                    const Vector3f Maximum(Max(Right * Front, Right * Back), Max(Top * Front, Top * Back), Back);
+                    const Vector3f Center = (Minimum + Maximum) * 0.5f;
+
+                    Volumes.MinimumX[Cluster] = Minimum.GetX();
+                    Volumes.MinimumY[Cluster] = Minimum.GetY();
+                    Volumes.MinimumZ[Cluster] = Minimum.GetZ();
+                    Volumes.MaximumX[Cluster] = Maximum.GetX();
+                    Volumes.MaximumY[Cluster] = Maximum.GetY();
+                    Volumes.MaximumZ[Cluster] = Maximum.GetZ();
+                    Volumes.CenterX[Cluster]  = Center.GetX();
+                    Volumes.CenterY[Cluster]  = Center.GetY();
+                    Volumes.CenterZ[Cluster]  = Center.GetZ();
+                    Volumes.Radius[Cluster]   = (Maximum - Center).GetLength();
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Lighting::Assign(UInt32 Slice)
+    {
+        ConstRef<Volumes> Volumes = (* mVolumes);
+
+        const auto Append = [this](UInt32 Cluster, UInt32 Light)
+        {
+            if (Ref<UInt8> Count = mCounts[Cluster]; Count < k_MaxAffected)
+            {
+                mAffected[Cluster * k_MaxAffected + Count++] = Light;
+            }
+        };
+
+        for (UInt32 Index = 0; Index < mCandidates.size(); ++Index)
+        {
+            ConstRef<Candidate> Candidate = mCandidates[Index];
+
+            if (Slice < Candidate.MinimumZ || Slice > Candidate.MaximumZ)
+            {
+                continue;
+            }
+
+            for (UInt32 Y = Candidate.MinimumY; Y <= Candidate.MaximumY; ++Y)
+            {
+                const UInt32 Row = (Slice * k_TilesY + Y) * k_TilesX;
+
+#ifdef    AURORA_SIMD
+                // Four neighbouring clusters of the row are tested at once, lanes outside of the bounding
+                // tiles are masked away afterwards.
+                const SIMD::Register Zero    = SIMD::Splat(0.0f);
+                const SIMD::Register CenterX = SIMD::Splat(Candidate.Center.GetX());
+                const SIMD::Register CenterY = SIMD::Splat(Candidate.Center.GetY());
+                const SIMD::Register CenterZ = SIMD::Splat(Candidate.Center.GetZ());
+                const SIMD::Register Range   = SIMD::Splat(Candidate.Radius);
+                const SIMD::Register Square  = SIMD::Splat(Candidate.Radius * Candidate.Radius);
+
+                for (UInt32 X = Candidate.MinimumX & ~3u; X <= Candidate.MaximumX; X += 4)
+                {
+                    const UInt32 Cluster = Row + X;
+
+                    const SIMD::Register DistanceX = SIMD::Max(SIMD::Max(
+                        SIMD::Sub(SIMD::Load(Volumes.MinimumX.data() + Cluster), CenterX),
+                        SIMD::Sub(CenterX, SIMD::Load(Volumes.MaximumX.data() + Cluster))), Zero);
+                    const SIMD::Register DistanceY = SIMD::Max(SIMD::Max(
+                        SIMD::Sub(SIMD::Load(Volumes.MinimumY.data() + Cluster), CenterY),
+                        SIMD::Sub(CenterY, SIMD::Load(Volumes.MaximumY.data() + Cluster))), Zero);
+                    const SIMD::Register DistanceZ = SIMD::Max(SIMD::Max(
+                        SIMD::Sub(SIMD::Load(Volumes.MinimumZ.data() + Cluster), CenterZ),
+                        SIMD::Sub(CenterZ, SIMD::Load(Volumes.MaximumZ.data() + Cluster))), Zero);
+
+                    const SIMD::Register Distance = SIMD::Add(SIMD::Mul(DistanceX, DistanceX),
+                        SIMD::Add(SIMD::Mul(DistanceY, DistanceY), SIMD::Mul(DistanceZ, DistanceZ)));
+
+                    SIMD::Register Mask = SIMD::GreaterEqual(Square, Distance);
+
+                    if (Candidate.Cone && SIMD::Any(Mask))
+                    {
+                        // Test the bounding sphere of every cluster against the cone, by its distance to the
+                        // closest point on the cone surface along the axis.
+                        const SIMD::Register Radius  = SIMD::Load(Volumes.Radius.data() + Cluster);
+                        const SIMD::Register VectorX = SIMD::Sub(SIMD::Load(Volumes.CenterX.data() + Cluster), CenterX);
+                        const SIMD::Register VectorY = SIMD::Sub(SIMD::Load(Volumes.CenterY.data() + Cluster), CenterY);
+                        const SIMD::Register VectorZ = SIMD::Sub(SIMD::Load(Volumes.CenterZ.data() + Cluster), CenterZ);
+
+                        const SIMD::Register Length  = SIMD::Add(SIMD::Mul(VectorX, VectorX),
+                            SIMD::Add(SIMD::Mul(VectorY, VectorY), SIMD::Mul(VectorZ, VectorZ)));
+                        const SIMD::Register Along   = SIMD::Add(
+                            SIMD::Mul(VectorX, SIMD::Splat(Candidate.Direction.GetX())), SIMD::Add(
+                            SIMD::Mul(VectorY, SIMD::Splat(Candidate.Direction.GetY())),
+                            SIMD::Mul(VectorZ, SIMD::Splat(Candidate.Direction.GetZ()))));
+                        const SIMD::Register Across  = SIMD::Sqrt(
+                            SIMD::Max(SIMD::Sub(Length, SIMD::Mul(Along, Along)), Zero));
+                        const SIMD::Register Closest = SIMD::Sub(
+                            SIMD::Mul(Across, SIMD::Splat(Candidate.Cosine)),
+                            SIMD::Mul(Along,  SIMD::Splat(Candidate.Sine)));
+
+                        Mask = SIMD::And(Mask, SIMD::GreaterEqual(Radius, Closest));
+                        Mask = SIMD::And(Mask, SIMD::GreaterEqual(SIMD::Add(Radius, Range), Along));
+                        Mask = SIMD::And(Mask, SIMD::GreaterEqual(SIMD::Add(Along, Radius), Zero));
+                    }
+
+                    const UInt32 First = (X < Candidate.MinimumX ? Candidate.MinimumX - X : 0);
+                    const UInt32 Last  = Min(Candidate.MaximumX - X, 3u);
+
+                    for (UInt32 Lanes = SIMD::GetMask(Mask) & ((2u << Last) - (1u << First)); Lanes; Lanes &= Lanes - 1)
+                    {
+                        Append(Cluster + std::countr_zero(Lanes), Index);
+                    }
+                }
+#else
+                for (UInt32 X = Candidate.MinimumX; X <= Candidate.MaximumX; ++X)
+                {
+                    const UInt32 Cluster = Row + X;
+
+                    const Vector3f Minimum(
+                        Volumes.MinimumX[Cluster], Volumes.MinimumY[Cluster], Volumes.MinimumZ[Cluster]);
+                    const Vector3f Maximum(
+                        Volumes.MaximumX[Cluster], Volumes.MaximumY[Cluster], Volumes.MaximumZ[Cluster]);
+                    const Vector3f Closest = Vector3f::Min(Vector3f::Max(Candidate.Center, Minimum), Maximum);
+
+                    if ((Closest - Candidate.Center).GetLengthSquared() > Candidate.Radius * Candidate.Radius)
+                    {
+                        continue;
+                    }
+
+                    if (Candidate.Cone)
+                    {
+                        const Real32   Radius = Volumes.Radius[Cluster];
+                        const Vector3f Center(
+                            Volumes.CenterX[Cluster], Volumes.CenterY[Cluster], Volumes.CenterZ[Cluster]);
+                        const Vector3f Vector = Center - Candidate.Center;
+
+                        const Real32 Along    = Vector.Dot(Candidate.Direction);
+                        const Real32 Across   = Sqrt(Max(Vector.GetLengthSquared() - Along * Along, 0.0f));
+                        const Real32 Distance = Across * Candidate.Cosine - Along * Candidate.Sine;
+
+                        if (Distance > Radius || Along > Radius + Candidate.Radius || Along < -Radius)
+                        {
+                            continue;
+                        }
+                    }
+                    Append(Cluster, Index);
+                }
+#endif // AURORA_SIMD
+            }
+        }
+    }
+}
\ No newline at end of file
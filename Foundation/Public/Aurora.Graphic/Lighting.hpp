@@ -0,0 +1,217 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Camera.hpp"
+#include "Service.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    class Lighting final : public AbstractSubsystem<Lighting>
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_TilesX      = 16;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_TilesY      = 9;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Slices      = 24;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Clusters    = k_TilesX * k_TilesY * k_Slices;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxLights   = 1024;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxAffected = 64;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_ListBytes   = 0xFF00;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxIndices  = (k_ListBytes - k_Clusters * sizeof(UInt32)) / sizeof(UInt16);
+
+        // -=(Undocumented)=-
+        enum class Shape : UInt8
+        {
+            Point,
+            Spot,
+        };
+
+        // -=(Undocumented)=-
+        struct Light
+        {
+            // -=(Undocumented)=-
+            Shape    Type      = Shape::Point;
+
+            // -=(Undocumented)=-
+            Vector3f Position;
+
+            // -=(Undocumented)=-
+            Real32   Range     = 1.0f;
+
+            // -=(Undocumented)=-
+            Vector3f Color     = Vector3f(1.0f, 1.0f, 1.0f);
+
+            // -=(Undocumented)=-
+            Real32   Intensity = 1.0f;
+
+            // -=(Undocumented)=-
+            Vector3f Direction = Vector3f(0.0f, 0.0f, 1.0f);
+
+            // -=(Undocumented)=-
+            Real32   Inner     = 0.0f;
+
+            // -=(Undocumented)=-
+            Real32   Outer     = 0.0f;
+        };
+
+        // -=(Undocumented)=-
+        struct Clusters
+        {
+            // -=(Undocumented)=-
+            Binding Lights;
+
+            // -=(Undocumented)=-
+            Binding Lists;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        explicit Lighting(Ref<Context> Context);
+
+        // -=(Undocumented)=-
+        Bool Initialize(UInt32 Threads);
+
+        // -=(Undocumented)=-
+        void Submit(ConstRef<Light> Light);
+
+        // -=(Undocumented)=-
+        Clusters Compute(ConstRef<Camera> Camera);
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Volumes
+        {
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> MinimumX;
+
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> MinimumY;
+
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> MinimumZ;
+
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> MaximumX;
+
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> MaximumY;
+
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> MaximumZ;
+
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> CenterX;
+
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> CenterY;
+
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> CenterZ;
+
+            // -=(Undocumented)=-
+            Array<Real32, k_Clusters> Radius;
+        };
+
+        // -=(Undocumented)=-
+        struct Candidate
+        {
+            // -=(Undocumented)=-
+            UInt32   Source;
+
+            // -=(Undocumented)=-
+            Vector3f Center;
+
+            // -=(Undocumented)=-
+            Real32   Radius;
+
+            // -=(Undocumented)=-
+            Vector3f Direction;
+
+            // -=(Undocumented)=-
+            Real32   Cosine;
+
+            // -=(Undocumented)=-
+            Real32   Sine;
+
+            // -=(Undocumented)=-
+            Bool     Cone;
+
+            // -=(Undocumented)=-
+            UInt8    MinimumX;
+
+            // -=(Undocumented)=-
+            UInt8    MaximumX;
+
+            // -=(Undocumented)=-
+            UInt8    MinimumY;
+
+            // -=(Undocumented)=-
+            UInt8    MaximumY;
+
+            // -=(Undocumented)=-
+            UInt8    MinimumZ;
+
+            // -=(Undocumented)=-
+            UInt8    MaximumZ;
+        };
+
+        // -=(Undocumented)=-
+        void Rebuild();
+
+        // -=(Undocumented)=-
+        void Assign(UInt32 Slice);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Light>                             mLights;
+        Vector<Candidate>                         mCandidates;
+        UPtr<Volumes>                             mVolumes;
+        Real32                                    mScaleX;
+        Real32                                    mScaleY;
+        Real32                                    mNear;
+        Real32                                    mFar;
+        Array<UInt8, k_Clusters>                  mCounts;
+        Array<UInt16, k_Clusters * k_MaxAffected> mAffected;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Scheduler                                 mScheduler;
+    };
+}
\ No newline at end of file
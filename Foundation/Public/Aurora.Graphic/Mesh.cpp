@@ -11,6 +11,7 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Mesh.hpp"
+#include "Encoder.hpp"
 #include "Service.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -23,7 +24,8 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     Mesh::Mesh(Any<Content::Uri> Key)
-        : AbstractResource(Move(Key))
+        : AbstractResource(Move(Key)),
+          mReadable { false }
     {
     }
 
@@ -46,17 +48,84 @@ namespace Graphic
             SetMemory(GetMemory() + Bytes.GetSize());
         }
 
-        ConstSPtr<Service> Graphics = Context.GetSubsystem<Service>();
+        mGraphics = Context.GetSubsystem<Service>();
 
-        if (mBytes[0].HasData())
+        for (UInt32 Buffer = 0; Buffer < k_MaxBuffers; ++Buffer)
         {
-            mBuffers[0] = Graphics->CreateBuffer(Usage::Vertex, Move(mBytes[0]));
+            if (mBytes[Buffer].HasData())
+            {
+                // Readable meshes keep a copy of their bytes around, so that tools like the static batcher
+                // can still reach the vertices once the original has been handed over to the device.
+                Data Bytes;
+
+                if (mReadable)
+                {
+                    Bytes = Data(mBytes[Buffer].GetSize());
+                    Bytes.Copy(mBytes[Buffer].GetData<UInt8>(), mBytes[Buffer].GetSize());
+                }
+                else
+                {
+                    Bytes = Move(mBytes[Buffer]);
+                }
+                mRanges[Buffer] = mGraphics->AllocateGeometry(static_cast<Usage>(Buffer), Move(Bytes));
+            }
         }
-        if (mBytes[1].HasData())
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Mesh::Bind(Ref<Encoder> Encoder, UInt8 Primitive) const
+    {
+        ConstRef<Mesh::Primitive> Data     = mPrimitives[Primitive];
+        ConstRef<Range>           Vertices = mRanges[CastEnum(Usage::Vertex)];
+
+        // Every mesh lives in the same geometry heap, so the streams only differ in their offsets. Slots are
+        // assigned in the same order as the input layout produced by Primitive::GetInputLayout.
+        for (UInt32 Semantic = 0, Slot = 0; Semantic < k_MaxAttributes; ++Semantic)
         {
-            mBuffers[1] = Graphics->CreateBuffer(Usage::Index, Move(mBytes[1]));
+            if (ConstRef<Attribute> Stream = Data.Attributes[Semantic]; Stream.Length > 0)
+            {
+                Encoder.SetVertices(Slot++, Binding(Vertices.Buffer, Stream.Stride, Vertices.GetOffset() + Stream.Offset));
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Mesh::Submit(Ref<Encoder> Encoder, UInt8 Primitive, UInt8 Level, UInt32 Instances) const
+    {
+        ConstRef<Mesh::Primitive> Data     = mPrimitives[Primitive];
+        ConstRef<Range>           Indices  = mRanges[CastEnum(Usage::Index)];
+        ConstRef<Attribute>       Position = Data.GetAttribute(VertexSemantic::Position);
+
+        ConstRef<Attribute> Elements = (Data.Details[Level].Indices.Length > 0 ? Data.Details[Level].Indices : Data.Indices);
+
+        // Geometry that didn't fit in the heaps lives in a dedicated buffer, which may still be in the upload
+        // queue. The draw is dropped along with the state bound for it until the buffer reaches the device.
+        const Bool Pending = mGraphics->IsBufferPending(mRanges[CastEnum(Usage::Vertex)].Buffer)
+                          || mGraphics->IsBufferPending(Indices.Buffer);
+
+        if (Pending)
+        {
+            Encoder.SetInFlight(Submission());
+        }
+        else if (Elements.Length > 0)
+        {
+            // Keep the index buffer bound at the start of the heap and express the primitive as an offset
+            // into it, which lets consecutive draws of different meshes share the same index binding.
+            Encoder.SetIndices(Binding(Indices.Buffer, Elements.Stride, 0));
+            SDL_assert((Indices.GetOffset() + Elements.Offset) % Elements.Stride == 0);
+
+            const UInt32 Offset = (Indices.GetOffset() + Elements.Offset) / Elements.Stride;
+            Encoder.Draw(Elements.Length / Elements.Stride, 0, Offset, Instances);
+        }
+        else if (Position.Length > 0)
+        {
+            Encoder.Draw(Position.Length / Position.Stride, 0, 0, Instances);
         }
-        return true;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -65,7 +134,11 @@ namespace Graphic
     void Mesh::OnDelete(Ref<Subsystem::Context> Context)
     {
         ConstSPtr<Service> Graphics = Context.GetSubsystem<Service>();
-        Graphics->DeleteBuffer(mBuffers[0]);
-        Graphics->DeleteBuffer(mBuffers[1]);
+
+        for (UInt32 Buffer = 0; Buffer < k_MaxBuffers; ++Buffer)
+        {
+            Graphics->FreeGeometry(static_cast<Usage>(Buffer), mRanges[Buffer]);
+        }
+        mGraphics = nullptr;
     }
 }
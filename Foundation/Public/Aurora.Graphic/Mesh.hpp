@@ -31,6 +31,9 @@ namespace Graphic
         // -=(Undocumented)=-
         static constexpr UInt k_MaxBuffers    = 2;
 
+        // -=(Undocumented)=-
+        static constexpr UInt k_MaxDetails    = 4;
+
         // -=(Undocumented)=-
         static constexpr UInt k_MaxPrimitives = 16;
 
@@ -38,13 +41,26 @@ namespace Graphic
         struct Attribute
         {
             // -=(Undocumented)=-
-            UInt32 Length = 0;
+            UInt32       Length = 0;
 
             // -=(Undocumented)=-
-            UInt32 Offset = 0;
+            UInt32       Offset = 0;
 
             // -=(Undocumented)=-
-            UInt32 Stride = 0;
+            UInt32       Stride = 0;
+
+            // -=(Undocumented)=-
+            VertexFormat Format = VertexFormat::Float32x4;
+        };
+
+        // -=(Undocumented)=-
+        struct Detail
+        {
+            // -=(Undocumented)=-
+            Attribute Indices;
+
+            // -=(Undocumented)=-
+            Real32    Error = 0.0f;
         };
 
         // -=(Undocumented)=-
@@ -59,11 +75,85 @@ namespace Graphic
             // -=(Undocumented)=-
             Array<Attribute, k_MaxAttributes> Attributes;
 
+            // -=(Undocumented)=-
+            Vector3f                          Minimum;
+
+            // -=(Undocumented)=-
+            Vector3f                          Maximum;
+
+            // -=(Undocumented)=-
+            Array<Detail, k_MaxDetails>       Details;
+
             // -=(Undocumented)=-
             ConstRef<Attribute> GetAttribute(VertexSemantic Semantic) const
             {
                 return Attributes[CastEnum(Semantic)];
             }
+
+            // -=(Undocumented)=-
+            Vector3f GetCenter() const
+            {
+                return (Minimum + Maximum) * 0.5f;
+            }
+
+            // -=(Undocumented)=-
+            Real32 GetRadius() const
+            {
+                return (Maximum - Minimum).GetLength() * 0.5f;
+            }
+
+            // -=(Undocumented)=-
+            ConstRef<Detail> GetDetail(UInt8 Level) const
+            {
+                return Details[Level];
+            }
+
+            // -=(Undocumented)=-
+            UInt8 SelectDetail(Real32 Coverage, Real32 Tolerance) const
+            {
+                // Pick the coarsest level whose error, once projected, stays under the tolerance. Both the
+                // coverage and the tolerance are fractions of the viewport height, while the error of each
+                // level is relative to the radius of the primitive.
+                UInt8 Level = 0;
+
+                while (Level + 1 < k_MaxDetails && Details[Level + 1].Indices.Length > 0)
+                {
+                    if (Details[Level + 1].Error * Coverage > Tolerance)
+                    {
+                        break;
+                    }
+                    ++Level;
+                }
+                return Level;
+            }
+
+            // -=(Undocumented)=-
+            UInt32 GetSlot(VertexSemantic Semantic) const
+            {
+                UInt32 Slot = 0;
+
+                for (UInt32 Index = 0; Index < CastEnum(Semantic); ++Index)
+                {
+                    Slot += (Attributes[Index].Length > 0 ? 1 : 0);
+                }
+                return Slot;
+            }
+
+            // -=(Undocumented)=-
+            void GetInputLayout(Ref<Descriptor> Properties) const
+            {
+                for (UInt32 Semantic = 0, Slot = 0; Semantic < k_MaxAttributes; ++Semantic)
+                {
+                    if (Attributes[Semantic].Length > 0)
+                    {
+                        Properties.InputLayout[Slot].ID     = static_cast<VertexSemantic>(Semantic);
+                        Properties.InputLayout[Slot].Format = Attributes[Semantic].Format;
+                        Properties.InputLayout[Slot].Slot   = Slot;
+                        Properties.InputLayout[Slot].Offset = 0;
+                        ++Slot;
+                    }
+                }
+            }
         };
 
     public:
@@ -74,10 +164,34 @@ namespace Graphic
         // -=(Undocumented)=-
         void Load(Any<Data> Vertices, Any<Data> Indices);
 
+        // -=(Undocumented)=-
+        void SetReadable(Bool Readable)
+        {
+            mReadable = Readable;
+        }
+
+        // -=(Undocumented)=-
+        Bool IsReadable() const
+        {
+            return mReadable;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Data> GetBytes(Usage Usage) const
+        {
+            return mBytes[CastEnum(Usage)];
+        }
+
         // -=(Undocumented)=-
         Object GetBuffer(Usage Usage) const
         {
-            return mBuffers[CastEnum(Usage)];
+            return mRanges[CastEnum(Usage)].Buffer;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetOffset(Usage Usage) const
+        {
+            return mRanges[CastEnum(Usage)].GetOffset();
         }
 
         // -=(Undocumented)=-
@@ -103,6 +217,19 @@ namespace Graphic
             return mPrimitives.GetData();
         }
 
+        // -=(Undocumented)=-
+        void Bind(Ref<class Encoder> Encoder, UInt8 Primitive) const;
+
+        // -=(Undocumented)=-
+        void Submit(Ref<class Encoder> Encoder, UInt8 Primitive, UInt8 Level = 0, UInt32 Instances = 0) const;
+
+        // -=(Undocumented)=-
+        void Draw(Ref<class Encoder> Encoder, UInt8 Primitive, UInt8 Level = 0, UInt32 Instances = 0) const
+        {
+            Bind(Encoder, Primitive);
+            Submit(Encoder, Primitive, Level, Instances);
+        }
+
     private:
 
         // \see Resource::OnCreate(Ref<Subsystem::Context>)
@@ -116,8 +243,10 @@ namespace Graphic
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+        SPtr<class Service>               mGraphics;
         Array<Data, k_MaxBuffers>         mBytes;
-        Array<Object, k_MaxBuffers>       mBuffers;
+        Array<Range, k_MaxBuffers>        mRanges;
         Stack<Primitive, k_MaxPrimitives> mPrimitives;
+        Bool                              mReadable;
     };
 }
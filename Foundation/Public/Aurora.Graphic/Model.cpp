@@ -22,7 +22,8 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     Model::Model(Any<Content::Uri> Key)
-        : AbstractResource(Move(Key))
+        : AbstractResource(Move(Key)),
+          mReadable { false }
     {
     }
 
@@ -41,6 +42,7 @@ namespace Graphic
     Bool Model::OnCreate(Ref<Subsystem::Context> Context)
     {
         // Create mesh.
+        mMesh->SetReadable(mReadable);
         mMesh->Create(Context);
 
         // Create each material.
@@ -14,6 +14,7 @@
 
 #include "Material.hpp"
 #include "Mesh.hpp"
+#include "Skin.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -34,6 +35,18 @@ namespace Graphic
         // -=(Undocumented)=-
         void Load(ConstSPtr<Mesh> Mesh, Any<Array<SPtr<Material>, Mesh::k_MaxPrimitives>> Materials);
 
+        // -=(Undocumented)=-
+        void SetReadable(Bool Readable)
+        {
+            mReadable = Readable;
+        }
+
+        // -=(Undocumented)=-
+        Bool IsReadable() const
+        {
+            return mReadable;
+        }
+
         // -=(Undocumented)=-
         ConstSPtr<Mesh> GetMesh() const
         {
@@ -46,6 +59,38 @@ namespace Graphic
             return mMaterials[Slot];
         }
 
+        // -=(Undocumented)=-
+        void SetSkin(ConstSPtr<Skin> Skin, Any<Vector<SPtr<Animation>>> Animations)
+        {
+            mSkin       = Skin;
+            mAnimations = Move(Animations);
+        }
+
+        // -=(Undocumented)=-
+        ConstSPtr<Skin> GetSkin() const
+        {
+            return mSkin;
+        }
+
+        // -=(Undocumented)=-
+        CPtr<const SPtr<Animation>> GetAnimations() const
+        {
+            return mAnimations;
+        }
+
+        // -=(Undocumented)=-
+        SPtr<Animation> GetAnimation(ConstRef<SStr> Name) const
+        {
+            for (ConstSPtr<Animation> Animation : mAnimations)
+            {
+                if (Animation->GetName() == Name)
+                {
+                    return Animation;
+                }
+            }
+            return nullptr;
+        }
+
     private:
 
         // \see Resource::OnCreate(Ref<Subsystem::Context>)
@@ -61,5 +106,8 @@ namespace Graphic
 
         SPtr<Mesh>                                   mMesh;
         Array<SPtr<Material>, Mesh::k_MaxPrimitives> mMaterials;
+        SPtr<Skin>                                   mSkin;
+        Vector<SPtr<Animation>>                      mAnimations;
+        Bool                                         mReadable;
     };
 }
@@ -11,7 +11,10 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Service.hpp"
+#include "Capture.hpp"
+#include <Aurora.Content/Resource.hpp>
 #include <Aurora.Graphic/GLES3/GLES3Driver.hpp>
+#include <bit>
 
 #ifdef    SDL_PLATFORM_WINDOWS
     #include <Aurora.Graphic/D3D11/D3D11Driver.hpp>
@@ -27,7 +30,17 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     Service::Service(Ref<Context> Context)
-        : AbstractSubsystem(Context)
+        : AbstractSubsystem(Context),
+          mCapture          { nullptr },
+          mUploadPending    { 0 },
+          mUploadBudget     { 0 },
+          mUploadDeadline   { 0.0 },
+          mUploadCost       { 0.0 },
+          mUploadEncoded    { 0 },
+          mUploadInFlight   { 0 },
+          mUploadTime       { 0 },
+          mMemoryByCategory { },
+          mMemoryByUsage    { }
     {
         // Initialize the worker thread allowing the service to handle
         // GPU commands concurrently with other tasks.
@@ -39,6 +52,17 @@ namespace Graphic
 
     Service::~Service()
     {
+        // The geometry heaps belong to the service. Subsystems are destroyed in reverse order, so every one that
+        // owns GPU objects is already gone and anything still alive at this point was never released.
+        for (ConstRef<Geometry> Heap : mGeometry)
+        {
+            if (Heap.Buffer)
+            {
+                DeleteBuffer(Heap.Buffer);
+            }
+        }
+        ReportLeaks();
+
         // Gracefully signals the thread to finish its current tasks and terminate.
         // Ensures an orderly shutdown of the worker thread, preventing abrupt
         // terminations that could lead to resource leaks or inconsistent states.
@@ -69,6 +93,14 @@ namespace Graphic
                     break;
             }
 
+            // Wrap the driver before anything is encoded when a capture was requested ahead of time, this way
+            // the capture contains the initialization and every resource, which makes it self-contained.
+            if (mDriver && !mCaptureFilename.empty())
+            {
+                CreateCapture(mCaptureFilename);
+                mCaptureFilename.clear();
+            }
+
             if (mDriver)
             {
                 // Perform a double flush to ensure synchronization between the CPU and GPU.
@@ -120,16 +152,20 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    Object Service::CreateBuffer(Usage Type, Any<Data> Data)
+    Object Service::CreateBuffer(Usage Type, Any<Data> Data, Priority Urgency)
     {
         const Object ID = mBuffers.Allocate();
 
         if (ID)
         {
-            mEncoder.WriteEnum(Command::CreateBuffer);
-            mEncoder.WriteUInt16(ID);
-            mEncoder.WriteEnum(Type);
-            mEncoder.WriteObject(Data);
+            Track(GetFootprintKey(Category::Buffer, ID), Type, Data.GetSize(), GetOwner());
+
+            Upload Entry;
+            Entry.Type    = Command::CreateBuffer;
+            Entry.Urgency = Urgency;
+            Entry.ID      = ID;
+            Entry.Kind    = Type;
+            Enqueue(Move(Entry), Move(Data));
         }
         return ID;
     }
@@ -150,13 +186,15 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Service::UpdateBuffer(Object ID, Bool Discard, UInt32 Offset, Any<Data> Data)
+    void Service::UpdateBuffer(Object ID, Bool Discard, UInt32 Offset, Any<Data> Data, Priority Urgency)
     {
-        mEncoder.WriteEnum(Command::UpdateBuffer);
-        mEncoder.WriteUInt16(ID);
-        mEncoder.WriteBool(Discard);
-        mEncoder.WriteUInt32(Offset);
-        mEncoder.WriteObject(Data);
+        Upload Entry;
+        Entry.Type     = Command::UpdateBuffer;
+        Entry.Urgency  = Urgency;
+        Entry.ID       = ID;
+        Entry.Discard  = Discard;
+        Entry.Position = Offset;
+        Enqueue(Move(Entry), Move(Data));
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -164,8 +202,90 @@ namespace Graphic
 
     void Service::DeleteBuffer(Object ID)
     {
-        mEncoder.WriteEnum(Command::DeleteBuffer);
-        mEncoder.WriteUInt16(mBuffers.Free(ID));
+        const Bool Unsent = Cancel(Command::CreateBuffer, ID);
+        Untrack(GetFootprintKey(Category::Buffer, ID));
+
+        // A buffer whose creation was still queued never reached the device, there is nothing to delete there.
+        const Object Handle = mBuffers.Free(ID);
+
+        if (!Unsent)
+        {
+            mEncoder.WriteEnum(Command::DeleteBuffer);
+            mEncoder.WriteUInt16(Handle);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Range Service::AllocateGeometry(Usage Type, Any<Data> Data)
+    {
+        Ref<Geometry> Heap = mGeometry[CastEnum(Type)];
+
+        // The heap is created on first use, so that applications that never load a mesh don't pay for it.
+        if (!Heap.Buffer)
+        {
+            const UInt32 Capacity = (Type == Usage::Vertex ? k_DefaultVertices : k_DefaultIndices);
+
+            if ((Heap.Buffer = CreateBuffer(Type, Capacity)))
+            {
+                Heap.Allocator.Reset(Capacity);
+
+                // The heap is shared by every mesh, only the ranges carved out of it are attributed to an asset.
+                const UInt64 Key = GetFootprintKey(Category::Buffer, Heap.Buffer);
+                Untrack(Key);
+                Track(Key, Type, Capacity, CStr());
+            }
+        }
+
+        Range Result;
+        Result.Allocation = Heap.Allocator.Allocate(Data.GetSize(), k_GeometryAlignment);
+
+        if (Result.Allocation.IsValid())
+        {
+            const UInt64 Key = GetFootprintKey(Category::Geometry, Result.Allocation.Node, CastEnum(Type));
+            Track(Key, Category::Geometry, Result.Allocation.Size, GetOwner());
+
+            Result.Buffer = Heap.Buffer;
+
+            // Writes into the heap are never queued, the range is drawn from as soon as it's handed out and
+            // every mesh shares the heap's upload key, which would serialise all of them behind each other.
+            Upload Entry;
+            Entry.Type     = Command::UpdateBuffer;
+            Entry.Urgency  = Priority::Normal;
+            Entry.ID       = Result.Buffer;
+            Entry.Position = Result.Allocation.Offset;
+
+            mUploadEncoded += Data.GetSize();
+            Encode(Entry, Move(Data));
+        }
+        else
+        {
+            // Out of room in the shared heap, fall back to a dedicated buffer for this geometry.
+            Log::Warn("Graphics: Geometry heap is full, creating a dedicated buffer of {} bytes", Data.GetSize());
+
+            Result.Buffer = CreateBuffer(Type, Move(Data));
+        }
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::FreeGeometry(Usage Type, ConstRef<Range> Range)
+    {
+        if (Range.Allocation.IsValid())
+        {
+            Untrack(GetFootprintKey(Category::Geometry, Range.Allocation.Node, CastEnum(Type)));
+
+            // The range may still be referenced by frames in flight, so it's only handed back to the
+            // allocator once those frames are retired (see Flush).
+            mGeometry[CastEnum(Type)].Garbage[k_CpuFrame].emplace_back(Range.Allocation);
+        }
+        else if (Range.Buffer)
+        {
+            DeleteBuffer(Range.Buffer);
+        }
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -193,7 +313,11 @@ namespace Graphic
 
         if (ID)
         {
+            // Passes only hold views of their attachments, the textures behind them are accounted separately.
+            Track(GetFootprintKey(Category::Pass, ID), Category::Pass, 0, GetOwner());
+
             mEncoder.WriteEnum(Command::CreatePass);
+            mEncoder.WriteUInt16(ID);
             mEncoder.WriteBlock(Colors);
             mEncoder.WriteBlock(Resolves);
             mEncoder.Write(Auxiliary);
@@ -206,6 +330,8 @@ namespace Graphic
 
     void Service::DeletePass(Object ID)
     {
+        Untrack(GetFootprintKey(Category::Pass, ID));
+
         mEncoder.WriteEnum(Command::DeletePass);
         mEncoder.WriteUInt16(mPasses.Free(ID));
     }
@@ -219,6 +345,9 @@ namespace Graphic
 
         if (ID)
         {
+            const UInt64 Bytes = Vertex.GetSize() + Fragment.GetSize() + Geometry.GetSize();
+            Track(GetFootprintKey(Category::Pipeline, ID), Category::Pipeline, Bytes, GetOwner());
+
             mEncoder.WriteEnum(Command::CreatePipeline);
             mEncoder.WriteUInt16(ID);
             mEncoder.WriteObject(Vertex);
@@ -234,6 +363,8 @@ namespace Graphic
 
     void Service::DeletePipeline(Object ID)
     {
+        Untrack(GetFootprintKey(Category::Pipeline, ID));
+
         mEncoder.WriteEnum(Command::DeletePipeline);
         mEncoder.WriteUInt16(mPipelines.Free(ID));
     }
@@ -241,21 +372,27 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    Object Service::CreateTexture(TextureFormat Format, TextureLayout Layout, UInt16 Width ,UInt16 Height, UInt8 Level, UInt8 Samples, Any<Data> Data)
+    Object Service::CreateTexture(TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt16 Layers, UInt8 Level, UInt8 Samples, Any<Data> Data, Priority Urgency)
     {
         const Object ID = mTextures.Allocate();
 
         if (ID)
         {
-            mEncoder.WriteEnum(Command::CreateTexture);
-            mEncoder.WriteUInt16(ID);
-            mEncoder.WriteEnum(Format);
-            mEncoder.WriteEnum(Layout);
-            mEncoder.WriteUInt16(Width);
-            mEncoder.WriteUInt16(Height);
-            mEncoder.WriteUInt8(Level);
-            mEncoder.WriteUInt8(Samples);
-            mEncoder.WriteObject(Data);
+            const UInt64 Bytes = GetTextureSize(Format, Width, Height, Layers, Level, Samples);
+            Track(GetFootprintKey(Category::Texture, ID), Category::Texture, Bytes, GetOwner());
+
+            Upload Entry;
+            Entry.Type    = Command::CreateTexture;
+            Entry.Urgency = Urgency;
+            Entry.ID      = ID;
+            Entry.Format  = Format;
+            Entry.Layout  = Layout;
+            Entry.Width   = Width;
+            Entry.Height  = Height;
+            Entry.Layers  = Layers;
+            Entry.Level   = Level;
+            Entry.Samples = Samples;
+            Enqueue(Move(Entry), Move(Data));
         }
         return ID;
     }
@@ -277,14 +414,17 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Service::UpdateTexture(Object ID, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, Any<Data> Data)
+    void Service::UpdateTexture(Object ID, UInt16 Layer, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, Any<Data> Data, Priority Urgency)
     {
-        mEncoder.WriteEnum(Command::UpdateTexture);
-        mEncoder.WriteUInt16(ID);
-        mEncoder.WriteUInt8(Level);
-        mEncoder.WriteObject(Offset);
-        mEncoder.WriteUInt32(Pitch);
-        mEncoder.WriteObject(Data);
+        Upload Entry;
+        Entry.Type    = Command::UpdateTexture;
+        Entry.Urgency = Urgency;
+        Entry.ID      = ID;
+        Entry.Layer   = Layer;
+        Entry.Level   = Level;
+        Entry.Offset  = Offset;
+        Entry.Pitch   = Pitch;
+        Enqueue(Move(Entry), Move(Data));
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -300,8 +440,17 @@ namespace Graphic
 
     void Service::DeleteTexture(Object ID)
     {
-        mEncoder.WriteEnum(Command::DeleteTexture);
-        mEncoder.WriteUInt16(mTextures.Free(ID));
+        const Bool Unsent = Cancel(Command::CreateTexture, ID);
+        Untrack(GetFootprintKey(Category::Texture, ID));
+
+        // A texture whose creation was still queued never reached the device, there is nothing to delete there.
+        const Object Handle = mTextures.Free(ID);
+
+        if (!Unsent)
+        {
+            mEncoder.WriteEnum(Command::DeleteTexture);
+            mEncoder.WriteUInt16(Handle);
+        }
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -362,11 +511,41 @@ namespace Graphic
         // This ensures that the buffer swap occurs only when the GPU is idle.
         mBusy.wait(true);
 
+        // Refine the estimated upload cost with the time the GPU thread spent on the uploads of the previous frame,
+        // small batches are skipped as their timing is dominated by the per command overhead.
+        if (mUploadInFlight >= k_UploadThreshold)
+        {
+            const Real64 Cost = static_cast<Real64>(mUploadTime) / static_cast<Real64>(mUploadInFlight);
+            mUploadCost = (mUploadCost > 0.0 ? mUploadCost * 0.75 + Cost * 0.25 : Cost);
+        }
+
+        // The chunks that referenced these payloads have been consumed by the GPU thread.
+        mUploadRetired.clear();
+
+        // Move as much of the upload queue as the budget allows into this frame.
+        Drain();
+
+        mUploadInFlight = mUploadEncoded;
+        mUploadEncoded  = 0;
+        mUploadTime     = 0;
+
         // Exchange the buffers so that the CPU can write new commands into the
         // encoder buffer while the GPU processes the commands in the decoder buffer.
         Swap(mEncoder, mDecoder);
         Swap(mFrames[0], mFrames[1]);
 
+        // Release the geometry ranges freed before the frame that just retired.
+        for (Ref<Geometry> Heap : mGeometry)
+        {
+            for (ConstRef<TLSF::Allocation> Allocation : Heap.Garbage[k_GpuFrame])
+            {
+                Heap.Allocator.Free(Allocation);
+            }
+            Heap.Garbage[k_GpuFrame].clear();
+
+            Swap(Heap.Garbage[k_CpuFrame], Heap.Garbage[k_GpuFrame]);
+        }
+
         // Clear the encoder buffer to prepare it for new data.
         // This is necessary to avoid processing stale or incorrect data in subsequent operations.
         mEncoder.Clear();
@@ -380,6 +559,477 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void Service::SetUploadBudget(UInt32 Bytes, Real64 Milliseconds)
+    {
+        mUploadBudget   = Bytes;
+        mUploadDeadline = Milliseconds;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::ReportMemoryUsage(UInt32 Limit) const
+    {
+        Log::Info("Graphics: Memory usage of {} live resource(s)", mFootprints.size());
+
+        for (const Category Kind : magic_enum::enum_values<Category>())
+        {
+            Log::Info("Graphics:     {:<10} {:>12} bytes", magic_enum::enum_name(Kind), GetMemoryUsage(Kind));
+        }
+
+        for (const Usage Type : magic_enum::enum_values<Usage>())
+        {
+            Log::Info("Graphics:     {:<10} {:>12} bytes (buffers)", magic_enum::enum_name(Type), GetMemoryUsage(Type));
+        }
+
+        // Sort the assets from the most to the least expensive, those are the ones worth looking at first.
+        Vector<Ptr<const StringTable<UInt64>::value_type>> Owners;
+        Owners.reserve(mMemoryByOwner.size());
+
+        for (ConstRef<StringTable<UInt64>::value_type> Owner : mMemoryByOwner)
+        {
+            Owners.emplace_back(AddressOf(Owner));
+        }
+        Sort(Owners, [](auto Left, auto Right) { return Left->second > Right->second; });
+
+        for (UInt32 Index = 0; Index < Min<UInt32>(Limit, Owners.size()); ++Index)
+        {
+            Log::Info("Graphics:     {:>12} bytes '{}'", Owners[Index]->second, Owners[Index]->first);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Service::StartCapture(CStr Filename)
+    {
+        // Wait until the GPU has finished processing any current tasks,
+        // the driver is only accessed by the worker thread while it's busy.
+        mBusy.wait(true);
+
+        if (mCapture)
+        {
+            return false;
+        }
+
+        if (!mDriver)
+        {
+            // Defer the capture until the driver has been created.
+            mCaptureFilename = Filename;
+            return true;
+        }
+
+        Log::Warn("Graphics: Capture started after initialization, resources created before it will be missing");
+        return CreateCapture(Filename);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::StopCapture()
+    {
+        // Wait until the GPU has finished processing any current tasks,
+        // the driver is only accessed by the worker thread while it's busy.
+        mBusy.wait(true);
+
+        if (mCapture)
+        {
+            mDriver  = mCapture->Release();
+            mCapture  = nullptr;
+        }
+        mCaptureFilename.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt64 Service::GetTextureSize(
+        TextureFormat Format, UInt16 Width, UInt16 Height, UInt16 Layers, UInt8 Level, UInt8 Samples)
+    {
+        UInt32 Block = 1;
+        UInt32 Bytes = 4;
+
+        switch (Format)
+        {
+            case TextureFormat::BC1UIntNorm:
+            case TextureFormat::BC1UIntNorm_sRGB:
+            case TextureFormat::BC4UIntNorm:
+                Block = 4;
+                Bytes = 8;
+                break;
+            case TextureFormat::BC2UIntNorm:
+            case TextureFormat::BC2UIntNorm_sRGB:
+            case TextureFormat::BC3UIntNorm:
+            case TextureFormat::BC3UIntNorm_sRGB:
+            case TextureFormat::BC5UIntNorm:
+                Block = 4;
+                Bytes = 16;
+                break;
+            case TextureFormat::R8SInt:
+            case TextureFormat::R8SIntNorm:
+            case TextureFormat::R8UInt:
+            case TextureFormat::R8UIntNorm:
+                Bytes = 1;
+                break;
+            case TextureFormat::R16SInt:
+            case TextureFormat::R16SIntNorm:
+            case TextureFormat::R16UInt:
+            case TextureFormat::R16UIntNorm:
+            case TextureFormat::R16Float:
+            case TextureFormat::RG8SInt:
+            case TextureFormat::RG8SIntNorm:
+            case TextureFormat::RG8UInt:
+            case TextureFormat::RG8UIntNorm:
+            case TextureFormat::D16X0UIntNorm:
+                Bytes = 2;
+                break;
+            case TextureFormat::RG32SInt:
+            case TextureFormat::RG32UInt:
+            case TextureFormat::RG32Float:
+            case TextureFormat::RGBA16SInt:
+            case TextureFormat::RGBA16SIntNorm:
+            case TextureFormat::RGBA16UInt:
+            case TextureFormat::RGBA16UIntNorm:
+            case TextureFormat::RGBA16Float:
+            case TextureFormat::D32S8UIntNorm:
+                Bytes = 8;
+                break;
+            case TextureFormat::RGB32SInt:
+            case TextureFormat::RGB32UInt:
+            case TextureFormat::RGB32Float:
+                Bytes = 12;
+                break;
+            case TextureFormat::RGBA32SInt:
+            case TextureFormat::RGBA32UInt:
+            case TextureFormat::RGBA32Float:
+                Bytes = 16;
+                break;
+            default:
+                break;
+        }
+
+        // A level of zero asks the driver for the full mip chain, down to the 1x1 level.
+        const UInt32 Levels = (Level > 0 ? Level : std::bit_width(Max<UInt32>(Width, Height)));
+        UInt64       Total  = 0;
+
+        for (UInt32 Mip = 0; Mip < Levels; ++Mip)
+        {
+            const UInt32 Columns = (Max<UInt32>(Width  >> Mip, 1) + Block - 1) / Block;
+            const UInt32 Rows    = (Max<UInt32>(Height >> Mip, 1) + Block - 1) / Block;
+            Total += static_cast<UInt64>(Columns) * Rows * Bytes;
+        }
+        return Total * Max<UInt16>(Layers, 1) * Max<UInt8>(Samples, 1);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    CStr Service::GetOwner()
+    {
+        const ConstPtr<Content::Uri> Active = Content::Resource::GetActive();
+        return (Active ? Active->GetUrl() : CStr());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Track(UInt64 Key, Category Kind, UInt64 Bytes, CStr Owner)
+    {
+        Footprint Entry { };
+        Entry.Kind  = Kind;
+        Entry.Bytes = Bytes;
+        Entry.Owner = Owner;
+
+        mMemoryByCategory[CastEnum(Kind)] += Bytes;
+
+        if (!Owner.empty())
+        {
+            mMemoryByOwner[Entry.Owner] += Bytes;
+        }
+        mFootprints.insert_or_assign(Key, Move(Entry));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Track(UInt64 Key, Usage Type, UInt64 Bytes, CStr Owner)
+    {
+        Track(Key, Category::Buffer, Bytes, Owner);
+
+        // Geometry ranges live inside buffers that are already counted, so only the buffers add to the usage.
+        mFootprints.find(Key)->second.Type = Type;
+        mMemoryByUsage[CastEnum(Type)] += Bytes;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Untrack(UInt64 Key)
+    {
+        const auto Iterator = mFootprints.find(Key);
+
+        if (Iterator == mFootprints.end())
+        {
+            return;
+        }
+
+        ConstRef<Footprint> Entry = Iterator->second;
+
+        mMemoryByCategory[CastEnum(Entry.Kind)] -= Entry.Bytes;
+
+        if (Entry.Kind == Category::Buffer)
+        {
+            mMemoryByUsage[CastEnum(Entry.Type)] -= Entry.Bytes;
+        }
+
+        if (const auto Owner = mMemoryByOwner.find(Entry.Owner); Owner != mMemoryByOwner.end())
+        {
+            if ((Owner->second -= Entry.Bytes) == 0)
+            {
+                mMemoryByOwner.erase(Owner);
+            }
+        }
+        mFootprints.erase(Iterator);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::ReportLeaks() const
+    {
+        if (mFootprints.empty())
+        {
+            return;
+        }
+
+        UInt64 Total = 0;
+
+        Vector<Ptr<const Table<UInt64, Footprint>::value_type>> Leaks;
+        Leaks.reserve(mFootprints.size());
+
+        for (ConstRef<Table<UInt64, Footprint>::value_type> Leak : mFootprints)
+        {
+            Leaks.emplace_back(AddressOf(Leak));
+            Total += Leak.second.Bytes;
+        }
+        Sort(Leaks, [](auto Left, auto Right) { return Left->first < Right->first; });
+
+        Log::Warn("Graphics: {} resource(s) were not released before shutdown ({} bytes)", Leaks.size(), Total);
+
+        for (const auto Leak : Leaks)
+        {
+            ConstRef<Footprint> Entry = Leak->second;
+
+            Log::Warn("Graphics:     {} #{} ({} bytes) created by '{}'",
+                magic_enum::enum_name(Entry.Kind),
+                static_cast<UInt32>(Leak->first),
+                Entry.Bytes,
+                Entry.Owner.empty() ? "<unknown>" : Entry.Owner);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Enqueue(Any<Upload> Entry, Any<Data> Bytes)
+    {
+        const UInt32 Key = GetUploadKey(Entry.Type, Entry.ID);
+        const auto   Iterator = mUploadOwners.find(Key);
+
+        // Commands on an object that still has queued uploads are queued behind them, otherwise a small
+        // update could overtake the creation or the previous update of the same object.
+        const Bool Budgeted = (mUploadBudget > 0 || mUploadDeadline > 0.0);
+
+        Entry.Bytes = Move(Bytes);
+
+        // Only payloads are worth spreading over frames, an object created without contents (such as the
+        // geometry heaps) costs nothing to send and must exist before anything is written into it.
+        const Bool Deferrable = Budgeted && Entry.Bytes.GetData() && Entry.GetRemaining() >= k_UploadThreshold;
+
+        if (Iterator == mUploadOwners.end() && !Deferrable)
+        {
+            mUploadEncoded += Entry.GetRemaining();
+            Encode(Entry, Move(Entry.Bytes));
+            return;
+        }
+
+        if (Iterator != mUploadOwners.end())
+        {
+            // Never schedule ahead of an earlier upload of the same object.
+            Entry.Urgency = Min(Entry.Urgency, Iterator->second.Urgency);
+            Iterator->second.Urgency = Entry.Urgency;
+            ++Iterator->second.Count;
+        }
+        else
+        {
+            mUploadOwners.try_emplace(Key, Pending { 1, Entry.Urgency });
+        }
+
+        mUploadPending += Entry.GetRemaining();
+
+        // Keep the queue ordered by urgency, entries of the same urgency are kept in submission order.
+        const auto Position = std::upper_bound(mUploads.begin(), mUploads.end(), Entry.Urgency,
+            [](Priority Urgency, ConstRef<Upload> Other)
+            {
+                return Urgency > Other.Urgency;
+            });
+        mUploads.insert(Position, Move(Entry));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Service::Cancel(Command Type, Object ID)
+    {
+        const UInt32 Key = GetUploadKey(Type, ID);
+
+        if (mUploadOwners.erase(Key) == 0)
+        {
+            return false;
+        }
+
+        const auto Predicate = [Key](ConstRef<Upload> Entry)
+        {
+            return GetUploadKey(Entry.Type, Entry.ID) == Key;
+        };
+
+        Bool Unsent = false;
+
+        for (Ref<Upload> Entry : mUploads)
+        {
+            if (Predicate(Entry))
+            {
+                mUploadPending -= Entry.GetRemaining();
+
+                // Creations are sent whole, one that is still queued means the device never saw the object.
+                Unsent |= (Entry.Type == Command::CreateBuffer || Entry.Type == Command::CreateTexture);
+
+                // A partially sent update still has chunks in flight that point into its payload.
+                if (Entry.Cursor > 0)
+                {
+                    mUploadRetired.emplace_back(Move(Entry.Bytes));
+                }
+            }
+        }
+        mUploads.erase(std::remove_if(mUploads.begin(), mUploads.end(), Predicate), mUploads.end());
+        return Unsent;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Encode(ConstRef<Upload> Entry, Any<Data> Bytes)
+    {
+        switch (Entry.Type)
+        {
+        case Command::CreateBuffer:
+            mEncoder.WriteEnum(Command::CreateBuffer);
+            mEncoder.WriteUInt16(Entry.ID);
+            mEncoder.WriteEnum(Entry.Kind);
+            mEncoder.WriteObject(Bytes);
+            break;
+        case Command::UpdateBuffer:
+            mEncoder.WriteEnum(Command::UpdateBuffer);
+            mEncoder.WriteUInt16(Entry.ID);
+            mEncoder.WriteBool(Entry.Discard && Entry.Cursor == 0);
+            mEncoder.WriteUInt32(Entry.Position + Entry.Cursor);
+            mEncoder.WriteObject(Bytes);
+            break;
+        case Command::CreateTexture:
+            mEncoder.WriteEnum(Command::CreateTexture);
+            mEncoder.WriteUInt16(Entry.ID);
+            mEncoder.WriteEnum(Entry.Format);
+            mEncoder.WriteEnum(Entry.Layout);
+            mEncoder.WriteUInt16(Entry.Width);
+            mEncoder.WriteUInt16(Entry.Height);
+            mEncoder.WriteUInt16(Entry.Layers);
+            mEncoder.WriteUInt8(Entry.Level);
+            mEncoder.WriteUInt8(Entry.Samples);
+            mEncoder.WriteObject(Bytes);
+            break;
+        case Command::UpdateTexture:
+            mEncoder.WriteEnum(Command::UpdateTexture);
+            mEncoder.WriteUInt16(Entry.ID);
+            mEncoder.WriteUInt16(Entry.Layer);
+            mEncoder.WriteUInt8(Entry.Level);
+            mEncoder.WriteObject(Entry.Offset);
+            mEncoder.WriteUInt32(Entry.Pitch);
+            mEncoder.WriteObject(Bytes);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Drain()
+    {
+        UInt64 Allowance = (mUploadBudget > 0 ? mUploadBudget : UINT64_MAX);
+
+        // Convert the time budget into bytes once the cost of an upload has been measured.
+        if (mUploadDeadline > 0.0 && mUploadCost > 0.0)
+        {
+            const UInt64 Bytes = static_cast<UInt64>(mUploadDeadline * 1'000'000.0 / mUploadCost);
+            Allowance = Min(Allowance, Max(Bytes, static_cast<UInt64>(1)));
+        }
+
+        UInt64 Sent     = 0;
+        auto   Iterator = mUploads.begin();
+
+        for (; Iterator != mUploads.end() && Sent < Allowance; ++Iterator)
+        {
+            Ref<Upload>  Entry     = (* Iterator);
+            const UInt64 Remaining = Entry.GetRemaining();
+
+            if (Entry.Type == Command::UpdateBuffer)
+            {
+                // Buffer updates can be split at any byte, send as much as fits and resume on the next frame.
+                // The chunks are views into the payload, which is kept alive until the GPU thread consumed them.
+                const UInt32 Size  = static_cast<UInt32>(Min(Remaining, Allowance - Sent));
+                Ptr<UInt8>   Chunk = Entry.Bytes.GetData<UInt8>() + Entry.Cursor;
+
+                Encode(Entry, Data(Chunk, Size, Data::EMPTY_DELETER));
+
+                Entry.Cursor += Size;
+                Sent         += Size;
+
+                if (Entry.GetRemaining() > 0)
+                {
+                    break;
+                }
+                mUploadRetired.emplace_back(Move(Entry.Bytes));
+            }
+            else
+            {
+                // Everything else is sent whole, an upload larger than the whole budget is let through
+                // on its own so that it can't stall the queue forever.
+                if (Sent > 0 && Remaining > Allowance - Sent)
+                {
+                    break;
+                }
+                Encode(Entry, Move(Entry.Bytes));
+
+                Sent += Remaining;
+            }
+
+            const auto Owner = mUploadOwners.find(GetUploadKey(Entry.Type, Entry.ID));
+
+            if (--Owner->second.Count == 0)
+            {
+                mUploadOwners.erase(Owner);
+            }
+        }
+
+        mUploads.erase(mUploads.begin(), Iterator);
+        mUploadPending -= Sent;
+        mUploadEncoded += Sent;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     void Service::OnConsume(std::stop_token Token)
     {
         while (not Token.stop_requested())
@@ -405,7 +1055,19 @@ namespace Graphic
             Reader Decoder(mDecoder.GetData());
             while (Decoder.GetAvailable() > 0)
             {
-                OnExecute(Decoder.ReadEnum<Command>(), Decoder);
+                const Command Type = Decoder.ReadEnum<Command>();
+
+                if (Type == Command::CreateBuffer  || Type == Command::UpdateBuffer ||
+                    Type == Command::CreateTexture || Type == Command::UpdateTexture)
+                {
+                    const UInt64 Start = SDL_GetTicksNS();
+                    OnExecute(Type, Decoder);
+                    mUploadTime += SDL_GetTicksNS() - Start;
+                }
+                else
+                {
+                    OnExecute(Type, Decoder);
+                }
             }
 
             // Completes the current GPU frame's command submission by performing necessary post-submission operations.
@@ -413,6 +1075,13 @@ namespace Graphic
             // execution cycle, maintaining efficient memory management and seamless data processing.
             mFrames[k_GpuFrame].OnPostSubmission(* mDriver);
 
+            // Write every command executed in this cycle (including the transient buffer uploads)
+            // as a single frame of the capture, if there is one in progress.
+            if (mCapture)
+            {
+                mCapture->Flush();
+            }
+
             // Clear the busy flag to signal that the GPU has completed its current tasks.
             // This action informs the main thread that the system is no longer busy, ensuring
             // that the main thread can proceed with issuing new commands.
@@ -444,17 +1113,31 @@ namespace Graphic
                     return ID;
                 };
 
+                // The sequence buffer holds the element of every packed constant, shared by every frame.
+                Array<UInt32, Frame::k_PackedLimit> Sequence;
+
+                for (UInt32 Element = 0; Element < Sequence.size(); ++Element)
+                {
+                    Sequence[Element] = Element;
+                }
+
+                const Object           SequenceID = mBuffers.Allocate();
+                const Ptr<const UInt8> SequenceData = reinterpret_cast<Ptr<const UInt8>>(Sequence.data());
+                mDriver->CreateBuffer(SequenceID, Usage::Vertex, true, SequenceData, sizeof(Sequence));
+
                 for (Ref<Frame> InFlightFrame : mFrames)
                 {
                     InFlightFrame.Initialize(
                         CreateTransientBuffer(Usage::Vertex, Frame::k_DefaultVertices),
                         CreateTransientBuffer(Usage::Index, Frame::k_DefaultIndices),
-                        CreateTransientBuffer(Usage::Uniform, Frame::k_DefaultUniforms));
+                        CreateTransientBuffer(Usage::Uniform, Frame::k_DefaultUniforms),
+                        SequenceID);
                 }
             }
             else
             {
-                mDriver = nullptr;
+                mDriver  = nullptr;
+                mCapture = nullptr;
             }
             break;
         }
@@ -540,11 +1223,12 @@ namespace Graphic
             const auto Layout  = Reader.ReadEnum<TextureLayout>();
             const auto Width   = Reader.ReadUInt16();
             const auto Height  = Reader.ReadUInt16();
+            const auto Layers  = Reader.ReadUInt16();
             const auto Level   = Reader.ReadUInt8();
             const auto Samples = Reader.ReadUInt8();
             const auto Bytes   = Reader.ReadObject<Data>();
 
-            mDriver->CreateTexture(ID, Format, Layout, Width, Height, Level, Samples, Bytes);
+            mDriver->CreateTexture(ID, Format, Layout, Width, Height, Layers, Level, Samples, Bytes);
             break;
         }
         case Command::CopyTexture:
@@ -562,12 +1246,13 @@ namespace Graphic
         case Command::UpdateTexture:
         {
             const auto ID     = Reader.ReadUInt16();
+            const auto Layer  = Reader.ReadUInt16();
             const auto Level  = Reader.ReadUInt8();
             const auto Offset = Reader.ReadObject<Recti>();
             const auto Pitch  = Reader.ReadUInt32();
             const auto Bytes  = Reader.ReadObject<Data>();
 
-            mDriver->UpdateTexture(ID, Level, Offset, Pitch, Bytes);
+            mDriver->UpdateTexture(ID, Layer, Level, Offset, Pitch, Bytes);
             break;
         }
         case Command::DeleteTexture:
@@ -604,4 +1289,25 @@ namespace Graphic
         }
         }
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Service::CreateCapture(CStr Filename)
+    {
+        UPtr<Capture> Recorder = NewUniquePtr<Capture>(Move(mDriver));
+
+        if (Recorder->Open(Filename))
+        {
+            Log::Info("Graphics: Capturing commands into '{}'", Filename);
+
+            mCapture = Recorder.get();
+            mDriver  = Move(Recorder);
+        }
+        else
+        {
+            mDriver  = Recorder->Release();
+        }
+        return mCapture != nullptr;
+    }
 }
\ No newline at end of file
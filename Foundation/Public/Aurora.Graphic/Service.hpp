@@ -26,7 +26,29 @@ namespace Graphic
     public:
 
         // -=(Undocumented)=-
-        static constexpr UInt32 k_InFlightFrames = 2;
+        static constexpr UInt32 k_InFlightFrames    = 2;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_DefaultVertices   = 64 * 1024 * 1024;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_DefaultIndices    = 16 * 1024 * 1024;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_GeometryAlignment = 16;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_UploadThreshold   = 64 * 1024;
+
+        // -=(Undocumented)=-
+        enum class Category : UInt8
+        {
+            Buffer,
+            Geometry,
+            Pass,
+            Pipeline,
+            Texture,
+        };
 
     public:
 
@@ -70,6 +92,15 @@ namespace Graphic
             return Allocation.Binding;
         }
 
+        // -=(Undocumented)=-
+        template<typename Format>
+        Frame::Packet<Format> Pack(ConstRef<Format> Value)
+        {
+            const Frame::Packet<Format> Packet = mFrames[k_CpuFrame].Pack<Format>();
+            std::memcpy(Packet.Pointer, AddressOf(Value), sizeof(Format));
+            return Packet;
+        }
+
         // -=(Undocumented)=-
         Object CreateBuffer(Usage Type, UInt32 Capacity)
         {
@@ -77,17 +108,29 @@ namespace Graphic
         }
 
         // -=(Undocumented)=-
-        Object CreateBuffer(Usage Type, Any<Data> Data);
+        Object CreateBuffer(Usage Type, Any<Data> Data, Priority Urgency = Priority::Normal);
 
         // -=(Undocumented)=-
         void CopyBuffer(Object DstBuffer, UInt32 DstOffset, Object SrcBuffer, UInt32 SrcOffset, UInt32 Size);
 
         // -=(Undocumented)=-
-        void UpdateBuffer(Object ID, Bool Discard, UInt32 Offset, Any<Data> Data);
+        void UpdateBuffer(Object ID, Bool Discard, UInt32 Offset, Any<Data> Data, Priority Urgency = Priority::Normal);
 
         // -=(Undocumented)=-
         void DeleteBuffer(Object ID);
 
+        // -=(Undocumented)=-
+        Bool IsBufferPending(Object ID) const
+        {
+            return mUploadOwners.contains(GetUploadKey(Command::CreateBuffer, ID));
+        }
+
+        // -=(Undocumented)=-
+        Range AllocateGeometry(Usage Type, Any<Data> Data);
+
+        // -=(Undocumented)=-
+        void FreeGeometry(Usage Type, ConstRef<Range> Range);
+
         // -=(Undocumented)=-
         Object CreateMaterial();
 
@@ -107,13 +150,25 @@ namespace Graphic
         void DeletePipeline(Object ID);
 
         // -=(Undocumented)=-
-        Object CreateTexture(TextureFormat Format, TextureLayout Layout, UInt16 Width ,UInt16 Height, UInt8 Level, UInt8 Samples, Any<Data> Data);
+        Object CreateTexture(TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt8 Level, UInt8 Samples, Any<Data> Data, Priority Urgency = Priority::Normal)
+        {
+            return CreateTexture(Format, Layout, Width, Height, 0, Level, Samples, Move(Data), Urgency);
+        }
+
+        // -=(Undocumented)=-
+        Object CreateTexture(TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt16 Layers, UInt8 Level, UInt8 Samples, Any<Data> Data, Priority Urgency = Priority::Normal);
 
         // -=(Undocumented)=-
         void CopyTexture(Object DstTexture, UInt8 DstLevel, ConstRef<Vector2i> DstOffset, Object SrcTexture, UInt8 SrcLevel, ConstRef<Recti> SrcOffset);
 
         // -=(Undocumented)=-
-        void UpdateTexture(Object ID, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, Any<Data> Data);
+        void UpdateTexture(Object ID, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, Any<Data> Data, Priority Urgency = Priority::Normal)
+        {
+            UpdateTexture(ID, 0, Level, Offset, Pitch, Move(Data), Urgency);
+        }
+
+        // -=(Undocumented)=-
+        void UpdateTexture(Object ID, UInt16 Layer, UInt8 Level, ConstRef<Recti> Offset, UInt32 Pitch, Any<Data> Data, Priority Urgency = Priority::Normal);
 
         // -=(Undocumented)=-
         Data ReadTexture(Object ID, UInt8 Level, ConstRef<Recti> Offset);
@@ -121,6 +176,12 @@ namespace Graphic
         // -=(Undocumented)=-
         void DeleteTexture(Object ID);
 
+        // -=(Undocumented)=-
+        Bool IsTexturePending(Object ID) const
+        {
+            return mUploadOwners.contains(GetUploadKey(Command::CreateTexture, ID));
+        }
+
         // -=(Undocumented)=-
         void Prepare(Object ID, ConstRef<Rectf> Viewport, Clear Target, Color Tint, Real32 Depth, UInt8 Stencil);
 
@@ -133,6 +194,43 @@ namespace Graphic
         // -=(Undocumented)=-
         void Flush();
 
+        // -=(Undocumented)=-
+        void SetUploadBudget(UInt32 Bytes, Real64 Milliseconds);
+
+        // -=(Undocumented)=-
+        UInt64 GetPendingUploadBytes() const
+        {
+            return mUploadPending;
+        }
+
+        // -=(Undocumented)=-
+        UInt64 GetMemoryUsage(Category Kind) const
+        {
+            return mMemoryByCategory[CastEnum(Kind)];
+        }
+
+        // -=(Undocumented)=-
+        UInt64 GetMemoryUsage(Usage Type) const
+        {
+            return mMemoryByUsage[CastEnum(Type)];
+        }
+
+        // -=(Undocumented)=-
+        UInt64 GetMemoryUsage(CStr Owner) const
+        {
+            const auto Iterator = mMemoryByOwner.find(Owner);
+            return (Iterator != mMemoryByOwner.end() ? Iterator->second : 0);
+        }
+
+        // -=(Undocumented)=-
+        void ReportMemoryUsage(UInt32 Limit = 16) const;
+
+        // -=(Undocumented)=-
+        Bool StartCapture(CStr Filename);
+
+        // -=(Undocumented)=-
+        void StopCapture();
+
     private:
 
         // -=(Undocumented)=-
@@ -163,12 +261,163 @@ namespace Graphic
             Commit,
         };
 
+        // -=(Undocumented)=-
+        struct Geometry
+        {
+            // -=(Undocumented)=-
+            Object Buffer = 0;
+
+            // -=(Undocumented)=-
+            TLSF   Allocator;
+
+            // -=(Undocumented)=-
+            Array<Vector<TLSF::Allocation>, k_InFlightFrames> Garbage;
+        };
+
+        // -=(Undocumented)=-
+        struct Upload
+        {
+            // -=(Undocumented)=-
+            Command       Type;
+
+            // -=(Undocumented)=-
+            Priority      Urgency;
+
+            // -=(Undocumented)=-
+            Object        ID;
+
+            // -=(Undocumented)=-
+            Usage         Kind     = Usage::Vertex;
+
+            // -=(Undocumented)=-
+            Bool          Discard  = false;
+
+            // -=(Undocumented)=-
+            UInt32        Position = 0;
+
+            // -=(Undocumented)=-
+            TextureFormat Format   = TextureFormat::RGBA8UIntNorm;
+
+            // -=(Undocumented)=-
+            TextureLayout Layout   = TextureLayout::Source;
+
+            // -=(Undocumented)=-
+            UInt16        Width    = 0;
+
+            // -=(Undocumented)=-
+            UInt16        Height   = 0;
+
+            // -=(Undocumented)=-
+            UInt16        Layers   = 0;
+
+            // -=(Undocumented)=-
+            UInt16        Layer    = 0;
+
+            // -=(Undocumented)=-
+            UInt8         Level    = 0;
+
+            // -=(Undocumented)=-
+            UInt8         Samples  = 0;
+
+            // -=(Undocumented)=-
+            Recti         Offset;
+
+            // -=(Undocumented)=-
+            UInt32        Pitch    = 0;
+
+            // -=(Undocumented)=-
+            Data          Bytes;
+
+            // -=(Undocumented)=-
+            UInt32        Cursor   = 0;
+
+            // -=(Undocumented)=-
+            UInt GetRemaining() const
+            {
+                // Dynamic buffers are created from a size without contents, there is nothing to upload for them.
+                return (Bytes.GetData() != nullptr ? Bytes.GetSize() - Cursor : 0);
+            }
+        };
+
+        // -=(Undocumented)=-
+        struct Pending
+        {
+            // -=(Undocumented)=-
+            UInt32   Count;
+
+            // -=(Undocumented)=-
+            Priority Urgency;
+        };
+
+        // -=(Undocumented)=-
+        struct Footprint
+        {
+            // -=(Undocumented)=-
+            Category Kind;
+
+            // -=(Undocumented)=-
+            Usage    Type;  // Only meaningful for buffers
+
+            // -=(Undocumented)=-
+            UInt64   Bytes;
+
+            // -=(Undocumented)=-
+            SStr     Owner;
+        };
+
+        // -=(Undocumented)=-
+        static UInt32 GetUploadKey(Command Type, Object ID)
+        {
+            const Bool Texture = (Type == Command::CreateTexture || Type == Command::UpdateTexture);
+            return (Texture ? 0x10000u : 0u) | ID;
+        }
+
+        // -=(Undocumented)=-
+        static UInt64 GetFootprintKey(Category Kind, UInt32 ID, UInt32 Extra = 0)
+        {
+            return (static_cast<UInt64>(CastEnum(Kind)) << 56) | (static_cast<UInt64>(Extra) << 32) | ID;
+        }
+
+        // -=(Undocumented)=-
+        static UInt64 GetTextureSize(
+            TextureFormat Format, UInt16 Width, UInt16 Height, UInt16 Layers, UInt8 Level, UInt8 Samples);
+
+        // -=(Undocumented)=-
+        static CStr GetOwner();
+
+        // -=(Undocumented)=-
+        void Track(UInt64 Key, Category Kind, UInt64 Bytes, CStr Owner);
+
+        // -=(Undocumented)=-
+        void Track(UInt64 Key, Usage Type, UInt64 Bytes, CStr Owner);
+
+        // -=(Undocumented)=-
+        void Untrack(UInt64 Key);
+
+        // -=(Undocumented)=-
+        void ReportLeaks() const;
+
+        // -=(Undocumented)=-
+        void Enqueue(Any<Upload> Entry, Any<Data> Bytes);
+
+        // -=(Undocumented)=-
+        Bool Cancel(Command Type, Object ID);
+
+        // -=(Undocumented)=-
+        void Encode(ConstRef<Upload> Entry, Any<Data> Bytes);
+
+        // -=(Undocumented)=-
+        void Drain();
+
         // -=(Undocumented)=-
         void OnConsume(std::stop_token Token);
 
         // -=(Undocumented)=-
         void OnExecute(Command Type, Ref<Reader> Reader);
 
+        // -=(Undocumented)=-
+        Bool CreateCapture(CStr Filename);
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -180,6 +429,23 @@ namespace Graphic
         Writer                         mDecoder;
         Atomic_Flag                    mBusy;
         Array<Frame, k_InFlightFrames> mFrames;
+        Ptr<class Capture>             mCapture;
+        SStr                           mCaptureFilename;
+        Array<Geometry, 2>             mGeometry;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Upload>                 mUploads;
+        Table<UInt32, Pending>         mUploadOwners;
+        Vector<Data>                   mUploadRetired;
+        UInt64                         mUploadPending;
+        UInt32                         mUploadBudget;
+        Real64                         mUploadDeadline;
+        Real64                         mUploadCost;
+        UInt64                         mUploadEncoded;
+        UInt64                         mUploadInFlight;
+        UInt64                         mUploadTime;
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -189,5 +455,13 @@ namespace Graphic
         Handle<k_MaxPasses>            mPasses;
         Handle<k_MaxPipelines>         mPipelines;
         Handle<k_MaxTextures>          mTextures;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Table<UInt64, Footprint>             mFootprints;
+        StringTable<UInt64>                  mMemoryByOwner;
+        Array<UInt64, CountEnum<Category>()> mMemoryByCategory;
+        Array<UInt64, CountEnum<Usage>()>    mMemoryByUsage;
     };
 }
\ No newline at end of file
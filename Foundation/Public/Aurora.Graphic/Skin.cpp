@@ -0,0 +1,223 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Skin.hpp"
+#include "Service.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Skin::Skin(ConstRef<Matrix4f> Root, Any<Vector<Joint>> Joints, Any<Vector<Stream>> Streams)
+        : mRoot    { Root },
+          mJoints  { Move(Joints) },
+          mStreams { Move(Streams) }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Ptr<const Skin::Stream> Skin::GetStream(UInt8 Primitive) const
+    {
+        for (ConstRef<Stream> Stream : mStreams)
+        {
+            if (Stream.Primitive == Primitive)
+            {
+                return AddressOf(Stream);
+            }
+        }
+        return nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Pose Skin::GetRestPose() const
+    {
+        Pose Result(mJoints.size());
+
+        for (UInt32 Joint = 0; Joint < mJoints.size(); ++Joint)
+        {
+            Result[Joint] = mJoints[Joint].Rest;
+        }
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Skin::Compute(ConstRef<Pose> Pose, CPtr<Matrix4f> Palette) const
+    {
+        // Joints are sorted so that parents always precede their children, which lets a single pass build
+        // the model space transforms in place before folding in the inverse bind matrices.
+        const UInt32 Count = Min(Min(mJoints.size(), Pose.size()), Palette.size());
+
+        for (UInt32 Joint = 0; Joint < Count; ++Joint)
+        {
+            const SInt32 Parent = mJoints[Joint].Parent;
+
+            Palette[Joint] = (Parent < 0 ? mRoot : Palette[Parent]) * Pose[Joint].Compute();
+        }
+
+        for (UInt32 Joint = 0; Joint < Count; ++Joint)
+        {
+            Palette[Joint] = Palette[Joint] * mJoints[Joint].Inverse;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Skin::Deform(
+        ConstRef<Stream> Stream, CPtr<const Matrix4f> Palette, CPtr<Vector3f> Positions, CPtr<Vector3f> Normals)
+    {
+        const UInt32 Count   = Min(Stream.Positions.size(), Positions.size());
+        const Bool   Shading = !Normals.empty() && Stream.Normals.size() == Stream.Positions.size();
+
+        for (UInt32 Vertex = 0; Vertex < Count; ++Vertex)
+        {
+            ConstRef<Array<UInt16, k_MaxInfluences>> Joints  = Stream.Joints[Vertex];
+            ConstRef<Array<Real32, k_MaxInfluences>> Weights = Stream.Weights[Vertex];
+            ConstRef<Vector3f>                       Point   = Stream.Positions[Vertex];
+
+            // Blend the joint matrices first and transform once, four columns at a time when SSE is around.
+#if defined(SDL_SSE_INTRINSICS)
+            __m128 C0 = _mm_setzero_ps();
+            __m128 C1 = _mm_setzero_ps();
+            __m128 C2 = _mm_setzero_ps();
+            __m128 C3 = _mm_setzero_ps();
+
+            for (UInt32 Influence = 0; Influence < k_MaxInfluences; ++Influence)
+            {
+                if (Weights[Influence] > 0.0f)
+                {
+                    const __m128            Weight = _mm_set1_ps(Weights[Influence]);
+                    const Ptr<const Real32> Matrix =
+                        reinterpret_cast<Ptr<const Real32>>(AddressOf(Palette[Joints[Influence]]));
+
+                    C0 = _mm_add_ps(C0, _mm_mul_ps(_mm_loadu_ps(Matrix + 0),  Weight));
+                    C1 = _mm_add_ps(C1, _mm_mul_ps(_mm_loadu_ps(Matrix + 4),  Weight));
+                    C2 = _mm_add_ps(C2, _mm_mul_ps(_mm_loadu_ps(Matrix + 8),  Weight));
+                    C3 = _mm_add_ps(C3, _mm_mul_ps(_mm_loadu_ps(Matrix + 12), Weight));
+                }
+            }
+
+            alignas(16) Real32 Lanes[4];
+
+            __m128 Output = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(C0, _mm_set1_ps(Point.GetX())), _mm_mul_ps(C1, _mm_set1_ps(Point.GetY()))),
+                _mm_add_ps(_mm_mul_ps(C2, _mm_set1_ps(Point.GetZ())), C3));
+            _mm_store_ps(Lanes, Output);
+
+            Positions[Vertex] = Vector3f(Lanes[0], Lanes[1], Lanes[2]);
+
+            if (Shading)
+            {
+                ConstRef<Vector3f> Normal = Stream.Normals[Vertex];
+
+                Output = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(C0, _mm_set1_ps(Normal.GetX())), _mm_mul_ps(C1, _mm_set1_ps(Normal.GetY()))),
+                    _mm_mul_ps(C2, _mm_set1_ps(Normal.GetZ())));
+                _mm_store_ps(Lanes, Output);
+
+                Normals[Vertex] = Vector3f::Normalize(Vector3f(Lanes[0], Lanes[1], Lanes[2]));
+            }
+#else
+            Vector4f C0(0, 0, 0, 0);
+            Vector4f C1(0, 0, 0, 0);
+            Vector4f C2(0, 0, 0, 0);
+            Vector4f C3(0, 0, 0, 0);
+
+            for (UInt32 Influence = 0; Influence < k_MaxInfluences; ++Influence)
+            {
+                if (Weights[Influence] > 0.0f)
+                {
+                    ConstRef<Matrix4f> Matrix = Palette[Joints[Influence]];
+                    const Real32       Weight = Weights[Influence];
+
+                    C0 += Matrix.GetColumn(0) * Weight;
+                    C1 += Matrix.GetColumn(1) * Weight;
+                    C2 += Matrix.GetColumn(2) * Weight;
+                    C3 += Matrix.GetColumn(3) * Weight;
+                }
+            }
+
+            const Vector4f Output = C0 * Point.GetX() + C1 * Point.GetY() + C2 * Point.GetZ() + C3;
+            Positions[Vertex] = Vector3f(Output.GetX(), Output.GetY(), Output.GetZ());
+
+            if (Shading)
+            {
+                ConstRef<Vector3f> Normal = Stream.Normals[Vertex];
+
+                const Vector4f Direction = C0 * Normal.GetX() + C1 * Normal.GetY() + C2 * Normal.GetZ();
+                Normals[Vertex] = Vector3f::Normalize(Vector3f(Direction.GetX(), Direction.GetY(), Direction.GetZ()));
+            }
+#endif
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Skin::Draw(
+        Ref<Service> Graphics,
+        ConstRef<Mesh> Mesh,
+        UInt8 Primitive,
+        CPtr<const Matrix4f> Palette,
+        UInt8 Level,
+        UInt32 Instances) const
+    {
+        Ref<Encoder>            Encoder = Graphics.GetEncoder();
+        const Ptr<const Stream> Source  = GetStream(Primitive);
+
+        if (Source == nullptr)
+        {
+            Mesh.Draw(Encoder, Primitive, Level, Instances);
+            return;
+        }
+
+        // Deform straight into this frame's transient vertex memory and bind it over the static position
+        // and normal streams of the primitive, the rest of the attributes are still fetched from the heap.
+        ConstRef<Mesh::Primitive> Data    = Mesh.GetPrimitive(Primitive);
+        ConstRef<Mesh::Attribute> Normal  = Data.GetAttribute(VertexSemantic::Normal);
+        const UInt32              Count   = Source->Positions.size();
+        const Bool                Shading = Normal.Length > 0 && Source->Normals.size() == Count;
+
+        const Frame::Allocation<Vector3f> Positions = Graphics.Allocate<Vector3f>(Usage::Vertex, Count);
+        Frame::Allocation<Vector3f>       Normals { };
+
+        if (Shading)
+        {
+            Normals = Graphics.Allocate<Vector3f>(Usage::Vertex, Count);
+        }
+
+        Deform(* Source, Palette,
+            CPtr<Vector3f>(Positions.Pointer, Count), CPtr<Vector3f>(Normals.Pointer, Shading ? Count : 0));
+
+        Mesh.Bind(Encoder, Primitive);
+
+        Encoder.SetVertices(Data.GetSlot(VertexSemantic::Position), Positions.Binding);
+
+        if (Shading)
+        {
+            Encoder.SetVertices(Data.GetSlot(VertexSemantic::Normal), Normals.Binding);
+        }
+
+        Mesh.Submit(Encoder, Primitive, Level, Instances);
+    }
+}
\ No newline at end of file
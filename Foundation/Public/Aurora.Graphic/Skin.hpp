@@ -0,0 +1,109 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Animation.hpp"
+#include "Mesh.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    class Skin final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxInfluences = 4;
+
+        // -=(Undocumented)=-
+        struct Joint
+        {
+            // -=(Undocumented)=-
+            SStr       Name;
+
+            // -=(Undocumented)=-
+            SInt32     Parent = -1;
+
+            // -=(Undocumented)=-
+            Matrix4f   Inverse;
+
+            // -=(Undocumented)=-
+            Transformf Rest;
+        };
+
+        // -=(Undocumented)=-
+        struct Stream
+        {
+            // -=(Undocumented)=-
+            UInt8                                    Primitive = 0;
+
+            // -=(Undocumented)=-
+            Vector<Vector3f>                         Positions;
+
+            // -=(Undocumented)=-
+            Vector<Vector3f>                         Normals;
+
+            // -=(Undocumented)=-
+            Vector<Array<UInt16, k_MaxInfluences>>   Joints;
+
+            // -=(Undocumented)=-
+            Vector<Array<Real32, k_MaxInfluences>>   Weights;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        Skin(ConstRef<Matrix4f> Root, Any<Vector<Joint>> Joints, Any<Vector<Stream>> Streams);
+
+        // -=(Undocumented)=-
+        CPtr<const Joint> GetJoints() const
+        {
+            return mJoints;
+        }
+
+        // -=(Undocumented)=-
+        Ptr<const Stream> GetStream(UInt8 Primitive) const;
+
+        // -=(Undocumented)=-
+        Pose GetRestPose() const;
+
+        // -=(Undocumented)=-
+        void Compute(ConstRef<Pose> Pose, CPtr<Matrix4f> Palette) const;
+
+        // -=(Undocumented)=-
+        static void Deform(
+            ConstRef<Stream> Stream, CPtr<const Matrix4f> Palette, CPtr<Vector3f> Positions, CPtr<Vector3f> Normals);
+
+        // -=(Undocumented)=-
+        void Draw(
+            Ref<class Service> Graphics,
+            ConstRef<Mesh> Mesh,
+            UInt8 Primitive,
+            CPtr<const Matrix4f> Palette,
+            UInt8 Level = 0,
+            UInt32 Instances = 0) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Matrix4f       mRoot;
+        Vector<Joint>  mJoints;
+        Vector<Stream> mStreams;
+    };
+}
\ No newline at end of file
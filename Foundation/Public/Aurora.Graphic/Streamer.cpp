@@ -0,0 +1,400 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Streamer.hpp"
+#include <bit>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Streamer::Streamer(Ref<Context> Context)
+        : AbstractSubsystem(Context),
+          mBudget   { 0 },
+          mResident { 0 },
+          mFrame    { 0 }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Streamer::OnTick(Real64 Time, Real64 Delta)
+    {
+        const SPtr<Service> Graphics = GetSubsystem<Service>();
+
+        if (!Graphics || mEntries.empty())
+        {
+            ++mFrame;
+            return;
+        }
+
+        UInt64 Total = 0;
+
+        for (Ref<Entry> Entry : mEntries)
+        {
+            // Swap in the replacements whose upload has already been sent to the device, the previous
+            // texture stays bound until then so that a texture never goes blank while it streams.
+            if (Entry.Pending && !Graphics->IsTexturePending(Entry.Pending))
+            {
+                Graphics->DeleteTexture(Entry.Owner->mID);
+                mResident -= GetSize(Entry, Entry.Resident);
+
+                Entry.Owner->mID = Entry.Pending;
+                Entry.Resident   = Entry.Incoming;
+                Entry.Pending    = 0;
+            }
+
+            // Settle the usage reported while rendering the last frame.
+            if (Entry.Usage == mFrame)
+            {
+                Entry.Demand = Entry.Wanted;
+                Entry.Extent = Entry.Coverage;
+            }
+            Entry.Wanted   = Entry.Tail;
+            Entry.Coverage = 0.0f;
+
+            // Textures that haven't been seen in a while fall back to their tail, while the ones no draw path
+            // has reported yet want their whole chain and are only held back by the budget.
+            if (Entry.Reported)
+            {
+                Entry.Target = (mFrame - Entry.Usage <= k_Grace ? Entry.Demand : Entry.Tail);
+            }
+            else
+            {
+                Entry.Target = 0;
+            }
+
+            Total += GetSize(Entry, Entry.Target);
+        }
+
+        // Order the textures from the least to the most important, stale textures first and then the ones
+        // that cover the least amount of the screen.
+        mOrder.resize(mEntries.size());
+
+        for (UInt32 Index = 0; Index < mOrder.size(); ++Index)
+        {
+            mOrder[Index] = Index;
+        }
+        std::sort(mOrder.begin(), mOrder.end(), [this](UInt32 First, UInt32 Second)
+        {
+            ConstRef<Entry> Left  = mEntries[First];
+            ConstRef<Entry> Right = mEntries[Second];
+            return Left.Usage != Right.Usage ? Left.Usage < Right.Usage : Left.Extent < Right.Extent;
+        });
+
+        // Give up detail on the least important textures until the wanted set fits in the budget.
+        for (UInt32 Index = 0; Index < mOrder.size() && mBudget > 0 && Total > mBudget; ++Index)
+        {
+            Ref<Entry> Entry = mEntries[mOrder[Index]];
+
+            while (Entry.Target < Entry.Tail && Total > mBudget)
+            {
+                Total -= GetSize(Entry, Entry.Target) - GetSize(Entry, Entry.Target + 1);
+                ++Entry.Target;
+            }
+        }
+
+        // Start the transitions, evictions are sent ahead of any other upload as they are small and release
+        // memory, while only a few textures at a time are allowed to stream in (most important first).
+        UInt32 Streams = 0;
+
+        for (auto Iterator = mOrder.rbegin(); Iterator != mOrder.rend(); ++Iterator)
+        {
+            Ref<Entry> Entry = mEntries[* Iterator];
+
+            if (Entry.Pending || Entry.Target == Entry.Resident)
+            {
+                continue;
+            }
+
+            if (Entry.Target > Entry.Resident)
+            {
+                Entry.Pending = Create(Entry, Entry.Target, Priority::High);
+            }
+            else if (Streams < k_MaxStreams)
+            {
+                Entry.Pending = Create(Entry, Entry.Target, Priority::Low);
+                ++Streams;
+            }
+
+            if (Entry.Pending)
+            {
+                Entry.Incoming = Entry.Target;
+                mResident     += GetSize(Entry, Entry.Target);
+            }
+        }
+
+        ++mFrame;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Streamer::Request(ConstRef<Texture> Texture, Real32 Extent)
+    {
+        if (const auto Iterator = mIndices.find(AddressOf(Texture)); Iterator != mIndices.end())
+        {
+            Ref<Entry> Entry = mEntries[Iterator->second];
+
+            // The level whose size matches the extent (in pixels) the texture covers on screen.
+            const Real32 Ratio = Max(Texture.GetWidth(), Texture.GetHeight()) / Max(Extent, 1.0f);
+            const UInt32 Level = (Ratio > 1.0f ? static_cast<UInt32>(std::floor(std::log2(Ratio))) : 0);
+
+            Entry.Wanted   = Min<UInt32>(Entry.Wanted, Min<UInt32>(Level, Entry.Tail));
+            Entry.Coverage = Max(Entry.Coverage, Extent);
+            Entry.Usage    = mFrame;
+            Entry.Reported = true;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Streamer::Request(ConstRef<Material> Material, Real32 Extent)
+    {
+        for (UInt32 Slot = 0; Slot < k_MaxSources; ++Slot)
+        {
+            if (ConstSPtr<Texture> Texture = Material.GetTexture(static_cast<TextureSlot>(Slot)))
+            {
+                Request(* Texture, Extent);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Streamer::Attach(Ref<Texture> Texture)
+    {
+        if (mBudget == 0 || Texture.GetLayout() != TextureLayout::Source || Texture.GetSamples() > 1)
+        {
+            return false;
+        }
+
+        // Sources without a chain of levels get one built on the CPU, there is nothing to stream otherwise.
+        if (!Texture.GetData().HasData() || (Texture.GetLevel() == 1 && !Generate(Texture)) || Texture.GetLevel() < 2)
+        {
+            return false;
+        }
+
+        // The chain is laid out layer after layer, each with every level one after the other, which lets the stride
+        // be recovered from the size of the data. Block compressed formats don't divide evenly and aren't streamed.
+        const UInt64 Pixels = GetOffset(Texture, 1, Texture.GetLevel()) * Max<UInt64>(Texture.GetLayers(), 1);
+        const UInt64 Stride = Texture.GetData().GetSize() / Pixels;
+
+        if (Stride == 0 || Stride * Pixels != Texture.GetData().GetSize())
+        {
+            return false;
+        }
+
+        Entry Entry { };
+        Entry.Owner  = AddressOf(Texture);
+        Entry.Stride = static_cast<UInt32>(Stride);
+        Entry.Usage  = mFrame;
+
+        // Find the first level small enough to be kept resident at all times.
+        while (Entry.Tail + 1 < Texture.GetLevel() &&
+               static_cast<UInt32>(Max(Texture.GetWidth(), Texture.GetHeight()) >> Entry.Tail) > k_TailSize)
+        {
+            ++Entry.Tail;
+        }
+        Entry.Resident = Entry.Tail;
+        Entry.Target   = Entry.Tail;
+        Entry.Demand   = Entry.Tail;
+        Entry.Wanted   = Entry.Tail;
+
+        // Only the tail is created up front, the rest of the chain streams in once it's requested.
+        Texture.mID = Create(Entry, Entry.Tail, Priority::High);
+
+        if (Texture.mID)
+        {
+            mIndices.try_emplace(AddressOf(Texture), mEntries.size());
+            mEntries.push_back(Entry);
+
+            mResident += GetSize(Entry, Entry.Tail);
+        }
+        return Texture.mID > 0;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Streamer::Detach(Ref<Texture> Texture)
+    {
+        const auto Iterator = mIndices.find(AddressOf(Texture));
+
+        if (Iterator == mIndices.end())
+        {
+            return;
+        }
+
+        const UInt32 Index = Iterator->second;
+        mIndices.erase(Iterator);
+
+        Ref<Entry> Entry = mEntries[Index];
+        mResident -= GetSize(Entry, Entry.Resident);
+
+        if (Entry.Pending)
+        {
+            GetSubsystem<Service>()->DeleteTexture(Entry.Pending);
+            mResident -= GetSize(Entry, Entry.Incoming);
+        }
+
+        if (Index + 1 < mEntries.size())
+        {
+            Entry = mEntries.back();
+            mIndices[Entry.Owner] = Index;
+        }
+        mEntries.pop_back();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt64 Streamer::GetOffset(ConstRef<Texture> Texture, UInt32 Stride, UInt8 Level)
+    {
+        UInt64 Offset = 0;
+
+        for (UInt32 Index = 0; Index < Level; ++Index)
+        {
+            const UInt64 Width  = Max(Texture.GetWidth() >> Index, 1);
+            const UInt64 Height = Max(Texture.GetHeight() >> Index, 1);
+            Offset += Width * Height * Stride;
+        }
+        return Offset;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt64 Streamer::GetSize(ConstRef<Entry> Entry, UInt8 Level)
+    {
+        ConstRef<Texture> Source = * Entry.Owner;
+
+        const UInt64 Layer = GetOffset(Source, Entry.Stride, Source.GetLevel());
+        const UInt64 First = GetOffset(Source, Entry.Stride, Level);
+        return (Layer - First) * Max<UInt64>(Source.GetLayers(), 1);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Streamer::Generate(Ref<Texture> Texture)
+    {
+        // Only formats that can be filtered by averaging their bytes.
+        switch (Texture.GetFormat())
+        {
+        case TextureFormat::RGBA8UIntNorm:
+        case TextureFormat::RGBA8UIntNorm_sRGB:
+        case TextureFormat::BGRA8UIntNorm:
+        case TextureFormat::BGRA8UIntNorm_sRGB:
+            break;
+        default:
+            return false;
+        }
+
+        constexpr UInt32 k_Stride = 4;
+
+        const UInt32 Levels = std::bit_width(static_cast<UInt32>(Max(Texture.GetWidth(), Texture.GetHeight())));
+        const UInt64 Slices = Max<UInt64>(Texture.GetLayers(), 1);
+        const UInt64 Base   = GetOffset(Texture, k_Stride, 1);
+        const UInt64 Layer  = GetOffset(Texture, k_Stride, Levels);
+
+        if (Levels < 2 || Texture.mData.GetSize() != Base * Slices)
+        {
+            return false;
+        }
+
+        Data Chain(static_cast<UInt32>(Layer * Slices));
+
+        for (UInt64 Slice = 0; Slice < Slices; ++Slice)
+        {
+            Ptr<UInt8> Target = Chain.GetData<UInt8>() + Slice * Layer;
+            std::memcpy(Target, Texture.mData.GetData<UInt8>() + Slice * Base, Base);
+
+            // Box filter every level from the previous one, odd edges repeat their last texel.
+            for (UInt32 Level = 1; Level < Levels; ++Level)
+            {
+                const UInt32 SrcWidth  = Max(Texture.GetWidth()  >> (Level - 1), 1);
+                const UInt32 SrcHeight = Max(Texture.GetHeight() >> (Level - 1), 1);
+                const UInt32 DstWidth  = Max(Texture.GetWidth()  >> Level, 1);
+                const UInt32 DstHeight = Max(Texture.GetHeight() >> Level, 1);
+
+                Ptr<const UInt8> Source      = Target;
+                Ptr<UInt8>       Destination = Target + SrcWidth * SrcHeight * k_Stride;
+
+                for (UInt32 Y = 0; Y < DstHeight; ++Y)
+                {
+                    const UInt32 Y0 = Min(Y * 2, SrcHeight - 1);
+                    const UInt32 Y1 = Min(Y * 2 + 1, SrcHeight - 1);
+
+                    for (UInt32 X = 0; X < DstWidth; ++X)
+                    {
+                        const UInt32 X0 = Min(X * 2, SrcWidth - 1);
+                        const UInt32 X1 = Min(X * 2 + 1, SrcWidth - 1);
+
+                        for (UInt32 Channel = 0; Channel < k_Stride; ++Channel)
+                        {
+                            const UInt32 Sum = Source[(Y0 * SrcWidth + X0) * k_Stride + Channel]
+                                             + Source[(Y0 * SrcWidth + X1) * k_Stride + Channel]
+                                             + Source[(Y1 * SrcWidth + X0) * k_Stride + Channel]
+                                             + Source[(Y1 * SrcWidth + X1) * k_Stride + Channel];
+                            Destination[(Y * DstWidth + X) * k_Stride + Channel] = static_cast<UInt8>((Sum + 2) / 4);
+                        }
+                    }
+                }
+                Target = Destination;
+            }
+        }
+
+        Texture.mData  = Move(Chain);
+        Texture.mLevel = static_cast<UInt8>(Levels);
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Object Streamer::Create(ConstRef<Entry> Entry, UInt8 Level, Priority Urgency)
+    {
+        ConstRef<Texture> Source = * Entry.Owner;
+
+        // Gather the levels from the first one requested onwards out of every layer, the copy is owned by the
+        // upload so the texture is free to go away while it's still queued.
+        const UInt64 Slices = Max<UInt64>(Source.GetLayers(), 1);
+        const UInt64 Layer  = GetOffset(Source, Entry.Stride, Source.GetLevel());
+        const UInt64 First  = GetOffset(Source, Entry.Stride, Level);
+        const UInt64 Size   = Layer - First;
+
+        Data Bytes(static_cast<UInt32>(Size * Slices));
+
+        for (UInt64 Slice = 0; Slice < Slices; ++Slice)
+        {
+            Ptr<const UInt8> Chain = Source.GetData().GetData<UInt8>() + Slice * Layer;
+            std::memcpy(Bytes.GetData<UInt8>() + Slice * Size, Chain + First, Size);
+        }
+
+        const UInt16 Width  = Max(Source.GetWidth()  >> Level, 1);
+        const UInt16 Height = Max(Source.GetHeight() >> Level, 1);
+
+        const UInt8  Levels = Source.GetLevel() - Level;
+
+        return GetSubsystem<Service>()->CreateTexture(
+            Source.GetFormat(), Source.GetLayout(), Width, Height, Source.GetLayers(), Levels, 1, Move(Bytes), Urgency);
+    }
+}
\ No newline at end of file
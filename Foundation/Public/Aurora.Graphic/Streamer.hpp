@@ -0,0 +1,146 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Material.hpp"
+#include "Service.hpp"
+#include "Texture.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    class Streamer final : public AbstractSubsystem<Streamer>, public Tickable
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_TailSize   = 64;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Grace      = 60;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxStreams = 4;
+
+    public:
+
+        // -=(Undocumented)=-
+        explicit Streamer(Ref<Context> Context);
+
+        // \see Tickable::OnTick(Real64, Real64)
+        void OnTick(Real64 Time, Real64 Delta) override;
+
+        // -=(Undocumented)=-
+        void SetBudget(UInt64 Bytes)
+        {
+            mBudget = Bytes;
+        }
+
+        // -=(Undocumented)=-
+        UInt64 GetBudget() const
+        {
+            return mBudget;
+        }
+
+        // -=(Undocumented)=-
+        UInt64 GetResident() const
+        {
+            return mResident;
+        }
+
+        // -=(Undocumented)=-
+        void Request(ConstRef<Texture> Texture, Real32 Extent);
+
+        // -=(Undocumented)=-
+        void Request(ConstRef<Material> Material, Real32 Extent);
+
+        // -=(Undocumented)=-
+        Bool Attach(Ref<Texture> Texture);
+
+        // -=(Undocumented)=-
+        void Detach(Ref<Texture> Texture);
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Entry
+        {
+            // -=(Undocumented)=-
+            Ptr<Texture> Owner;
+
+            // -=(Undocumented)=-
+            UInt32       Stride;
+
+            // -=(Undocumented)=-
+            UInt8        Tail;
+
+            // -=(Undocumented)=-
+            UInt8        Resident;
+
+            // -=(Undocumented)=-
+            UInt8        Target;
+
+            // -=(Undocumented)=-
+            UInt8        Demand;
+
+            // -=(Undocumented)=-
+            UInt8        Wanted;
+
+            // -=(Undocumented)=-
+            Real32       Coverage;
+
+            // -=(Undocumented)=-
+            Object       Pending;
+
+            // -=(Undocumented)=-
+            UInt8        Incoming;
+
+            // -=(Undocumented)=-
+            UInt64       Usage;
+
+            // -=(Undocumented)=-
+            Real32       Extent;
+
+            // -=(Undocumented)=-
+            Bool         Reported;
+        };
+
+        // -=(Undocumented)=-
+        static UInt64 GetOffset(ConstRef<Texture> Texture, UInt32 Stride, UInt8 Level);
+
+        // -=(Undocumented)=-
+        static UInt64 GetSize(ConstRef<Entry> Entry, UInt8 Level);
+
+        // -=(Undocumented)=-
+        static Bool Generate(Ref<Texture> Texture);
+
+        // -=(Undocumented)=-
+        Object Create(ConstRef<Entry> Entry, UInt8 Level, Priority Urgency);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Table<Ptr<const Texture>, UInt32> mIndices;
+        Vector<Entry>                      mEntries;
+        Vector<UInt32>                     mOrder;
+        UInt64                             mBudget;
+        UInt64                             mResident;
+        UInt64                             mFrame;
+    };
+}
\ No newline at end of file
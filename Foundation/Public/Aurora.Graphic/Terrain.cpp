@@ -0,0 +1,490 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Terrain.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    struct Landscape
+    {
+        // -=(Undocumented)=-
+        Matrix4f Camera;
+
+        // -=(Undocumented)=-
+        Vector4f Eye;
+
+        // -=(Undocumented)=-
+        Vector4f Layout;
+
+        // -=(Undocumented)=-
+        Vector4f Sun;
+    };
+
+    // -=(Undocumented)=-
+    static constexpr UInt32 k_Quadrant = Terrain::k_Grid * Terrain::k_Grid / 4 * 6;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool IsInRange(
+        ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum, ConstRef<Vector3f> Eye, Real32 Range)
+    {
+        const Vector3f Closest(
+            Clamp(Eye.GetX(), Minimum.GetX(), Maximum.GetX()),
+            Clamp(Eye.GetY(), Minimum.GetY(), Maximum.GetY()),
+            Clamp(Eye.GetZ(), Minimum.GetZ(), Maximum.GetZ()));
+        return (Closest - Eye).GetLengthSquared() <= Range * Range;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Terrain::Terrain(ConstSPtr<Service> Graphics, ConstSPtr<Content::Service> Content, ConstRef<Properties> Properties)
+        : mGraphics   { Graphics },
+          mContent    { Content },
+          mProperties { Properties },
+          mExtent     { Properties.Spacing * k_TileQuads },
+          mRanges     { },
+          mVertices   { 0 },
+          mIndices    { 0 },
+          mHeightmap  { 0 },
+          mCapacity   { 0 },
+          mFrame      { 0 }
+    {
+        // Every range doubles the previous one, the finest has to hold a couple of nodes of its own level or
+        // neighbouring nodes end up more than one level apart and the morph can no longer close the seams.
+        mProperties.Distance = Max(mProperties.Distance, mExtent * 2.0f);
+
+        for (UInt32 Level = 0; Level < k_Levels; ++Level)
+        {
+            mRanges[Level] = mProperties.Distance / static_cast<Real32>(1u << (k_Levels - 1 - Level));
+        }
+
+        mTiles.resize(mProperties.Columns * mProperties.Rows);
+        mPipeline = mContent->Load<Pipeline>("Engine://Pipeline/Terrain.effect");
+
+        // Every node of every level draws the same grid, scaled and placed by its instance data.
+        constexpr UInt32 k_Side = k_Grid + 1;
+
+        Data Vertices(k_Side * k_Side * sizeof(Vector2f));
+
+        const Ptr<Vector2f> Points = Vertices.GetData<Vector2f>();
+
+        for (UInt32 Y = 0; Y < k_Side; ++Y)
+        {
+            for (UInt32 X = 0; X < k_Side; ++X)
+            {
+                Points[Y * k_Side + X] = Vector2f(X, Y);
+            }
+        }
+        mVertices = mGraphics->CreateBuffer(Usage::Vertex, Move(Vertices));
+
+        // Indices are laid out one quadrant after another, so the whole grid or any of its quadrants is a
+        // contiguous range. A node that is only partially replaced by its children draws the rest that way.
+        Data Indices(k_Quadrant * 4 * sizeof(UInt16));
+
+        Ptr<UInt16> Elements = Indices.GetData<UInt16>();
+
+        for (UInt32 Quadrant = 0; Quadrant < 4; ++Quadrant)
+        {
+            const UInt32 StartX = (Quadrant & 1) * (k_Grid / 2);
+            const UInt32 StartY = (Quadrant >> 1) * (k_Grid / 2);
+
+            for (UInt32 Y = StartY; Y < StartY + k_Grid / 2; ++Y)
+            {
+                for (UInt32 X = StartX; X < StartX + k_Grid / 2; ++X)
+                {
+                    const UInt16 Base = Y * k_Side + X;
+
+                    (* Elements++) = Base;
+                    (* Elements++) = Base + 1;
+                    (* Elements++) = Base + k_Side + 1;
+                    (* Elements++) = Base;
+                    (* Elements++) = Base + k_Side + 1;
+                    (* Elements++) = Base + k_Side;
+                }
+            }
+        }
+        mIndices = mGraphics->CreateBuffer(Usage::Index, Move(Indices));
+
+        // Heightmaps live in the layers of a single array so that every node is drawn by a handful of instanced
+        // calls. It holds enough layers for every tile within the view distance and no more.
+        const UInt32 Span = static_cast<UInt32>(std::ceil(2.0f * mProperties.Distance / mExtent)) + 1;
+
+        mCapacity  = Min(Span * Span, Min(static_cast<UInt32>(mTiles.size()), k_MaxLayers));
+        mHeightmap = mGraphics->CreateTexture(
+            TextureFormat::R16UIntNorm, TextureLayout::Source, k_TileSamples, k_TileSamples, mCapacity, 1, 1, Data());
+
+        for (UInt32 Layer = mCapacity; Layer > 0; --Layer)
+        {
+            mLayers.push_back(Layer - 1);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Terrain::~Terrain()
+    {
+        mGraphics->DeleteTexture(mHeightmap);
+        mGraphics->DeleteBuffer(mIndices);
+        mGraphics->DeleteBuffer(mVertices);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Terrain::Draw(Ref<Encoder> Encoder, ConstRef<Camera> Camera)
+    {
+        ++mFrame;
+
+        if (!mPipeline || !mPipeline->HasLoaded())
+        {
+            return;
+        }
+
+        for (Ref<Vector<Patch>> Bucket : mPatches)
+        {
+            Bucket.clear();
+        }
+        mRequests.clear();
+
+        const Vector3f Eye = Camera.GetScene().Inverse() * Vector3f(0.0f, 0.0f, 0.0f);
+
+        const auto GetTile = [this](Real32 Coordinate, UInt32 Tiles)
+        {
+            const Real32 Tile = std::floor(Coordinate / mExtent);
+            return static_cast<UInt32>(std::clamp(Tile, 0.0f, static_cast<Real32>(Tiles - 1)));
+        };
+
+        const Real32 Distance = mProperties.Distance;
+        const UInt32 MinimumX = GetTile(Eye.GetX() - Distance, mProperties.Columns);
+        const UInt32 MaximumX = GetTile(Eye.GetX() + Distance, mProperties.Columns);
+        const UInt32 MinimumY = GetTile(Eye.GetZ() - Distance, mProperties.Rows);
+        const UInt32 MaximumY = GetTile(Eye.GetZ() + Distance, mProperties.Rows);
+
+        // Every tile is the root of its own quadtree. Tiles within the view distance that are not resident yet
+        // are requested and simply skipped until their heights arrive.
+        for (UInt32 Row = MinimumY; Row <= MaximumY; ++Row)
+        {
+            for (UInt32 Column = MinimumX; Column <= MaximumX; ++Column)
+            {
+                const UInt32 Index = Row * mProperties.Columns + Column;
+                Ref<Tile>    Tile  = mTiles[Index];
+
+                if (Tile.Layer == k_Absent)
+                {
+                    const Vector3f Minimum(Column * mExtent, 0.0f, Row * mExtent);
+                    const Vector3f Maximum(Minimum.GetX() + mExtent, mProperties.Elevation, Minimum.GetZ() + mExtent);
+
+                    if (!Tile.Missing && IsInRange(Minimum, Maximum, Eye, Distance))
+                    {
+                        const Vector3f Center = (Minimum + Maximum) * 0.5f;
+                        mRequests.push_back(Request { Index, (Center - Eye).GetLengthSquared() });
+                    }
+                    continue;
+                }
+
+                if (Select(Index, k_Levels - 1, 0, 0, Eye, Camera))
+                {
+                    Tile.Seen = mFrame;
+                }
+            }
+        }
+
+        // Bring in the closest tiles first, a few per frame so that teleporting never stalls the frame for long.
+        Sort(mRequests, [](ConstRef<Request> First, ConstRef<Request> Second)
+        {
+            return First.Distance < Second.Distance;
+        });
+
+        for (UInt32 Element = 0; Element < Min<UInt32>(mRequests.size(), k_MaxLoads); ++Element)
+        {
+            Stream(mRequests[Element].Index);
+        }
+
+        UInt32 Total = 0;
+
+        for (ConstRef<Vector<Patch>> Bucket : mPatches)
+        {
+            Total += Bucket.size();
+        }
+
+        // The grid and its indices may still be in the upload queue.
+        if (Total == 0 || mGraphics->IsBufferPending(mVertices) || mGraphics->IsBufferPending(mIndices))
+        {
+            return;
+        }
+
+        const Vector3f Sun = Vector3f::Normalize(mProperties.Sun);
+
+        const Landscape Parameters {
+            Camera.GetWorld(),
+            Vector4f(Eye.GetX(), Eye.GetY(), Eye.GetZ(), 0.0f),
+            Vector4f(mProperties.Spacing, mProperties.Elevation, 1.0f / k_TileSamples, static_cast<Real32>(k_Grid)),
+            Vector4f(Sun.GetX(), Sun.GetY(), Sun.GetZ(), 0.0f)
+        };
+
+        const Frame::Allocation<Patch> Allocation = mGraphics->Allocate<Patch>(Usage::Vertex, Total);
+        const Binding                  Scene      = mGraphics->Allocate<Landscape>(
+            Usage::Uniform, CastSpan(Parameters));
+
+        // One instanced call per bucket: whole nodes first, then every quadrant on its own.
+        UInt32 Written = 0;
+
+        for (UInt32 Bucket = 0; Bucket < k_Buckets; ++Bucket)
+        {
+            const UInt32 Count = mPatches[Bucket].size();
+
+            if (Count == 0)
+            {
+                continue;
+            }
+
+            std::memcpy(Allocation.Pointer + Written, mPatches[Bucket].data(), Count * sizeof(Patch));
+
+            const UInt32 Offset = Allocation.Binding.Offset + Written * sizeof(Patch);
+
+            Encoder.SetVertices(0, Binding(mVertices, sizeof(Vector2f), 0));
+            Encoder.SetVertices(1, Binding(Allocation.Binding.Buffer, sizeof(Patch), Offset));
+            Encoder.SetIndices(Binding(mIndices, sizeof(UInt16), 0));
+            Encoder.SetUniforms(0, Scene);
+            Encoder.SetPipeline(* mPipeline);
+            Encoder.SetTexture(0, mHeightmap);
+            Encoder.SetSampler(0, Sampler { TextureEdge::Clamp, TextureEdge::Clamp, TextureFilter::Bilinear });
+
+            if (Bucket == 0)
+            {
+                Encoder.Draw(k_Quadrant * 4, 0, 0, Count);
+            }
+            else
+            {
+                Encoder.Draw(k_Quadrant, 0, (Bucket - 1) * k_Quadrant, Count);
+            }
+            Written += Count;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Terrain::GetPyramid(UInt32 Level)
+    {
+        UInt32 Offset = 0;
+
+        for (UInt32 Previous = 0; Previous < Level; ++Previous)
+        {
+            Offset += GetNodes(Previous) * GetNodes(Previous);
+        }
+        return Offset;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Terrain::GetBounds(
+        UInt32 Index, UInt32 Level, UInt32 X, UInt32 Y, Ref<Vector3f> Minimum, Ref<Vector3f> Maximum) const
+    {
+        const Real32 Size   = k_Grid * mProperties.Spacing * static_cast<Real32>(1u << Level);
+        const Real32 Left   = (Index % mProperties.Columns) * mExtent + X * Size;
+        const Real32 Bottom = (Index / mProperties.Columns) * mExtent + Y * Size;
+
+        ConstRef<Vector2f> Heights = mTiles[Index].Bounds[GetPyramid(Level) + Y * GetNodes(Level) + X];
+
+        Minimum = Vector3f(Left,        Heights.GetX() * mProperties.Elevation, Bottom);
+        Maximum = Vector3f(Left + Size, Heights.GetY() * mProperties.Elevation, Bottom + Size);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Terrain::Select(
+        UInt32 Index, UInt32 Level, UInt32 X, UInt32 Y, ConstRef<Vector3f> Eye, ConstRef<Camera> Camera)
+    {
+        Vector3f Minimum;
+        Vector3f Maximum;
+        GetBounds(Index, Level, X, Y, Minimum, Maximum);
+
+        // A node out of its own range belongs to its parent, which draws that area with its coarser grid.
+        if (!IsInRange(Minimum, Maximum, Eye, mRanges[Level]))
+        {
+            return false;
+        }
+
+        if (!Camera.IsVisible(Minimum, Maximum))
+        {
+            return true;
+        }
+
+        if (Level == 0 || !IsInRange(Minimum, Maximum, Eye, mRanges[Level - 1]))
+        {
+            Emit(0, Index, Level, X, Y);
+            return true;
+        }
+
+        // Only the children within the next range are refined, the quadrants left over are still drawn here.
+        for (UInt32 Quadrant = 0; Quadrant < 4; ++Quadrant)
+        {
+            const UInt32 ChildX = X * 2 + (Quadrant & 1);
+            const UInt32 ChildY = Y * 2 + (Quadrant >> 1);
+
+            if (!Select(Index, Level - 1, ChildX, ChildY, Eye, Camera))
+            {
+                Vector3f ChildMinimum;
+                Vector3f ChildMaximum;
+                GetBounds(Index, Level - 1, ChildX, ChildY, ChildMinimum, ChildMaximum);
+
+                if (Camera.IsVisible(ChildMinimum, ChildMaximum))
+                {
+                    Emit(1 + Quadrant, Index, Level, X, Y);
+                }
+            }
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Terrain::Emit(UInt32 Bucket, UInt32 Index, UInt32 Level, UInt32 X, UInt32 Y)
+    {
+        const Real32 Size     = k_Grid * mProperties.Spacing * static_cast<Real32>(1u << Level);
+        const Real32 Previous = (Level > 0 ? mRanges[Level - 1] : 0.0f);
+        const Real32 Start    = Previous + (mRanges[Level] - Previous) * k_Morph;
+        const UInt32 Samples  = k_Grid << Level;
+
+        // Vertices morph into the grid of the next level over the last part of the range, by the time a node is
+        // replaced by its parent it already looks exactly like it.
+        const Patch Patch {
+            Vector4f(
+                (Index % mProperties.Columns) * mExtent + X * Size,
+                (Index / mProperties.Columns) * mExtent + Y * Size,
+                Size,
+                mTiles[Index].Layer),
+            Vector4f(Start, mRanges[Level], X * Samples, Y * Samples)
+        };
+        mPatches[Bucket].push_back(Patch);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Terrain::Stream(UInt32 Index)
+    {
+        const UInt32 Column = Index % mProperties.Columns;
+        const UInt32 Row    = Index / mProperties.Columns;
+
+        Ref<Tile> Tile = mTiles[Index];
+
+        // Tiles are raw 16-bit heights, row by row. Neighbouring tiles repeat their shared row and column so
+        // that the edges of both match exactly at every level.
+        constexpr UInt32 k_Size = k_TileSamples * k_TileSamples * sizeof(UInt16);
+
+        const Content::Uri Key(Format("{}/{}_{}.height", mProperties.Source, Column, Row));
+
+        Data Bytes = mContent->Find(Key);
+
+        if (Bytes.GetSize() != k_Size)
+        {
+            Log::Warn("Terrain: Tile '{}' is missing or malformed", Key.GetUrl());
+
+            Tile.Missing = true;
+            return;
+        }
+
+        // Reuse the layer of the tile that has gone unseen for the longest, unless all of them are on screen.
+        if (mLayers.empty())
+        {
+            const auto Compare = [this](UInt32 First, UInt32 Second)
+            {
+                return mTiles[First].Seen < mTiles[Second].Seen;
+            };
+            const auto Oldest = std::min_element(mResident.begin(), mResident.end(), Compare);
+
+            if (Oldest == mResident.end() || mTiles[* Oldest].Seen == mFrame)
+            {
+                return;
+            }
+
+            Ref<Terrain::Tile> Victim = mTiles[* Oldest];
+            mLayers.push_back(Victim.Layer);
+
+            Victim.Layer = k_Absent;
+            Victim.Bounds.clear();
+
+            (* Oldest) = mResident.back();
+            mResident.pop_back();
+        }
+
+        // The bounds of the finest nodes come from their samples, including the ones shared with the next node,
+        // coarser nodes merge the bounds of their four children.
+        const Ptr<const UInt16> Heights = Bytes.GetData<UInt16>();
+
+        Tile.Bounds.resize(GetPyramid(k_Levels));
+
+        for (UInt32 Y = 0; Y < GetNodes(0); ++Y)
+        {
+            for (UInt32 X = 0; X < GetNodes(0); ++X)
+            {
+                UInt16 Lowest  = UINT16_MAX;
+                UInt16 Highest = 0;
+
+                for (UInt32 SampleY = Y * k_Grid; SampleY <= (Y + 1) * k_Grid; ++SampleY)
+                {
+                    for (UInt32 SampleX = X * k_Grid; SampleX <= (X + 1) * k_Grid; ++SampleX)
+                    {
+                        const UInt16 Value = Heights[SampleY * k_TileSamples + SampleX];
+
+                        Lowest  = Min(Lowest, Value);
+                        Highest = Max(Highest, Value);
+                    }
+                }
+                Tile.Bounds[Y * GetNodes(0) + X] = Vector2f(Lowest / 65535.0f, Highest / 65535.0f);
+            }
+        }
+
+        for (UInt32 Level = 1; Level < k_Levels; ++Level)
+        {
+            for (UInt32 Y = 0; Y < GetNodes(Level); ++Y)
+            {
+                for (UInt32 X = 0; X < GetNodes(Level); ++X)
+                {
+                    Vector2f Merged(1.0f, 0.0f);
+
+                    for (UInt32 Quadrant = 0; Quadrant < 4; ++Quadrant)
+                    {
+                        const UInt32 ChildX = X * 2 + (Quadrant & 1);
+                        const UInt32 ChildY = Y * 2 + (Quadrant >> 1);
+
+                        ConstRef<Vector2f> Child
+                            = Tile.Bounds[GetPyramid(Level - 1) + ChildY * GetNodes(Level - 1) + ChildX];
+                        Merged = Vector2f(Min(Merged.GetX(), Child.GetX()), Max(Merged.GetY(), Child.GetY()));
+                    }
+                    Tile.Bounds[GetPyramid(Level) + Y * GetNodes(Level) + X] = Merged;
+                }
+            }
+        }
+
+        Tile.Layer = mLayers.back();
+        Tile.Seen  = mFrame;
+        mLayers.pop_back();
+        mResident.push_back(Index);
+
+        const Recti Region(0, 0, k_TileSamples, k_TileSamples);
+        mGraphics->UpdateTexture(mHeightmap, Tile.Layer, 0, Region, k_TileSamples * sizeof(UInt16), Move(Bytes));
+    }
+}
\ No newline at end of file
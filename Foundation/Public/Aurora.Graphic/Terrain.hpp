@@ -0,0 +1,198 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Camera.hpp"
+#include "Pipeline.hpp"
+#include "Service.hpp"
+#include "Aurora.Content/Service.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    class Terrain final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Grid        = 32;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_TileQuads   = 256;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_TileSamples = k_TileQuads + 1;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Levels      = 4;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxLoads    = 2;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxLayers   = 2048;
+
+        // -=(Undocumented)=-
+        static constexpr Real32 k_Morph       = 0.7f;
+
+        // -=(Undocumented)=-
+        struct Properties
+        {
+            // -=(Undocumented)=-
+            SStr     Source;
+
+            // -=(Undocumented)=-
+            UInt32   Columns   = 1;
+
+            // -=(Undocumented)=-
+            UInt32   Rows      = 1;
+
+            // -=(Undocumented)=-
+            Real32   Spacing   = 1.0f;
+
+            // -=(Undocumented)=-
+            Real32   Elevation = 256.0f;
+
+            // -=(Undocumented)=-
+            Real32   Distance  = 2048.0f;
+
+            // -=(Undocumented)=-
+            Vector3f Sun       = Vector3f(0.3f, 0.8f, 0.2f);
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        Terrain(ConstSPtr<Service> Graphics, ConstSPtr<Content::Service> Content, ConstRef<Properties> Properties);
+
+        // -=(Undocumented)=-
+        ~Terrain();
+
+        // -=(Undocumented)=-
+        Real32 GetExtent() const
+        {
+            return mExtent;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetResident() const
+        {
+            return mResident.size();
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetCapacity() const
+        {
+            return mCapacity;
+        }
+
+        // -=(Undocumented)=-
+        void Draw(Ref<Encoder> Encoder, ConstRef<Camera> Camera);
+
+    private:
+
+        // -=(Undocumented)=-
+        static constexpr UInt16 k_Absent  = UINT16_MAX;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Buckets = 5;
+
+        // -=(Undocumented)=-
+        struct Patch
+        {
+            // -=(Undocumented)=-
+            Vector4f Placement;
+
+            // -=(Undocumented)=-
+            Vector4f Morph;
+        };
+
+        // -=(Undocumented)=-
+        struct Tile
+        {
+            // -=(Undocumented)=-
+            Vector<Vector2f> Bounds;
+
+            // -=(Undocumented)=-
+            UInt16           Layer   = k_Absent;
+
+            // -=(Undocumented)=-
+            Bool             Missing = false;
+
+            // -=(Undocumented)=-
+            UInt64           Seen    = 0;
+        };
+
+        // -=(Undocumented)=-
+        struct Request
+        {
+            // -=(Undocumented)=-
+            UInt32 Index;
+
+            // -=(Undocumented)=-
+            Real32 Distance;
+        };
+
+        // -=(Undocumented)=-
+        static UInt32 GetNodes(UInt32 Level)
+        {
+            return (k_TileQuads / k_Grid) >> Level;
+        }
+
+        // -=(Undocumented)=-
+        static UInt32 GetPyramid(UInt32 Level);
+
+        // -=(Undocumented)=-
+        void GetBounds(
+            UInt32 Index, UInt32 Level, UInt32 X, UInt32 Y, Ref<Vector3f> Minimum, Ref<Vector3f> Maximum) const;
+
+        // -=(Undocumented)=-
+        Bool Select(UInt32 Index, UInt32 Level, UInt32 X, UInt32 Y, ConstRef<Vector3f> Eye, ConstRef<Camera> Camera);
+
+        // -=(Undocumented)=-
+        void Emit(UInt32 Bucket, UInt32 Index, UInt32 Level, UInt32 X, UInt32 Y);
+
+        // -=(Undocumented)=-
+        void Stream(UInt32 Index);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        SPtr<Service>                      mGraphics;
+        SPtr<Content::Service>             mContent;
+        Properties                         mProperties;
+        Real32                             mExtent;
+        Array<Real32, k_Levels>            mRanges;
+        SPtr<Pipeline>                     mPipeline;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Object                             mVertices;
+        Object                             mIndices;
+        Object                             mHeightmap;
+        UInt32                             mCapacity;
+        Vector<Tile>                       mTiles;
+        Vector<UInt32>                     mResident;
+        Vector<UInt16>                     mLayers;
+        Vector<Request>                    mRequests;
+        Array<Vector<Patch>, k_Buckets>    mPatches;
+        UInt64                             mFrame;
+    };
+}
\ No newline at end of file
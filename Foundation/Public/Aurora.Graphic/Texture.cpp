@@ -12,6 +12,7 @@
 
 #include "Texture.hpp"
 #include "Service.hpp"
+#include "Streamer.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -24,25 +25,28 @@ namespace Graphic
 
     Texture::Texture(Any<Content::Uri> Key)
         : AbstractResource(Move(Key)),
-          mID      { 0 },
-          mFormat  { TextureFormat::RGBA8UInt },
-          mLayout  { TextureLayout::Dual },
-          mWidth   { 0 },
-          mHeight  { 0 },
-          mLevel   { 0 },
-          mSamples { 1 }
+          mID       { 0 },
+          mFormat   { TextureFormat::RGBA8UInt },
+          mLayout   { TextureLayout::Dual },
+          mWidth    { 0 },
+          mHeight   { 0 },
+          mLayers   { 0 },
+          mLevel    { 0 },
+          mSamples  { 1 },
+          mReadable { false }
     {
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Texture::Load(TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt8 Level, UInt8 Samples, Any<Data> Data)
+    void Texture::Load(TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt16 Layers, UInt8 Level, UInt8 Samples, Any<Data> Data)
     {
         mFormat  = Format;
         mLayout  = Layout;
         mWidth   = Width;
         mHeight  = Height;
+        mLayers  = Layers;
         mLevel   = Level;
         mSamples = Samples;
         mData    = Move(Data);
@@ -53,9 +57,31 @@ namespace Graphic
 
     Bool Texture::OnCreate(Ref<Subsystem::Context> Context)
     {
+        // Streamed textures keep their chain of levels around and start with only the smallest ones on the device.
+        if (const SPtr<Streamer> Streaming = Context.GetSubsystem<Streamer>(); Streaming && Streaming->Attach(* this))
+        {
+            SetMemory(mData.GetSize());
+            return true;
+        }
+
         SetMemory(mData.GetSize());
 
-        mID = Context.GetSubsystem<Service>()->CreateTexture(mFormat, mLayout, mWidth, mHeight, mLevel, mSamples, Move(mData));
+        // Readable textures keep a copy of their texels around, so that tools like the texture batcher can
+        // still reach them once the original has been handed over to the device.
+        Data Bytes;
+
+        if (mReadable)
+        {
+            Bytes = Data(mData.GetSize());
+            Bytes.Copy(mData.GetData<UInt8>(), mData.GetSize());
+        }
+        else
+        {
+            Bytes = Move(mData);
+        }
+
+        mID = Context.GetSubsystem<Service>()->CreateTexture(
+            mFormat, mLayout, mWidth, mHeight, mLayers, mLevel, mSamples, Move(Bytes));
 
         return mID > 0;
     }
@@ -65,6 +91,11 @@ namespace Graphic
 
     void Texture::OnDelete(Ref<Subsystem::Context> Context)
     {
+        if (const SPtr<Streamer> Streaming = Context.GetSubsystem<Streamer>())
+        {
+            Streaming->Detach(* this);
+        }
+
         Context.GetSubsystem<Service>()->DeleteTexture(mID);
 
         mID = 0;
@@ -25,6 +25,7 @@ namespace Graphic
     class Texture final : public Content::AbstractResource<Texture>
     {
         friend class AbstractResource;
+        friend class Streamer;
 
     public:
 
@@ -32,7 +33,31 @@ namespace Graphic
         explicit Texture(Any<Content::Uri> Key);
 
         // -=(Undocumented)=-
-        void Load(TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt8 Level, UInt8 Samples, Any<Data> Data);
+        void Load(TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt8 Level, UInt8 Samples, Any<Data> Data)
+        {
+            Load(Format, Layout, Width, Height, 0, Level, Samples, Move(Data));
+        }
+
+        // -=(Undocumented)=-
+        void Load(TextureFormat Format, TextureLayout Layout, UInt16 Width, UInt16 Height, UInt16 Layers, UInt8 Level, UInt8 Samples, Any<Data> Data);
+
+        // -=(Undocumented)=-
+        void SetReadable(Bool Readable)
+        {
+            mReadable = Readable;
+        }
+
+        // -=(Undocumented)=-
+        Bool IsReadable() const
+        {
+            return mReadable;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Data> GetData() const
+        {
+            return mData;
+        }
 
         // -=(Undocumented)=-
         Object GetID() const
@@ -64,6 +89,18 @@ namespace Graphic
             return mHeight;
         }
 
+        // -=(Undocumented)=-
+        UInt16 GetLayers() const
+        {
+            return mLayers;
+        }
+
+        // -=(Undocumented)=-
+        Bool IsArray() const
+        {
+            return mLayers > 0;
+        }
+
         // -=(Undocumented)=-
         UInt8 GetLevel() const
         {
@@ -94,8 +131,10 @@ namespace Graphic
         TextureLayout mLayout;
         UInt16        mWidth;
         UInt16        mHeight;
+        UInt16        mLayers;
         UInt8         mLevel;
         UInt8         mSamples;
         Data          mData;
+        Bool          mReadable;
     };
 }
\ No newline at end of file
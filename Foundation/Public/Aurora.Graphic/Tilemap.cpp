@@ -0,0 +1,338 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Tilemap.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Tilemap::Tilemap(ConstSPtr<Service> Graphics, UInt32 Width, UInt32 Height, Real32 Size)
+        : mGraphics { Graphics },
+          mWidth    { Width },
+          mHeight   { Height },
+          mSize     { Size },
+          mColumns  { 1 },
+          mRows     { 1 },
+          mChunksX  { (Width  + k_ChunkSize - 1) / k_ChunkSize },
+          mChunksY  { (Height + k_ChunkSize - 1) / k_ChunkSize },
+          mIndices  { 0 },
+          mFrame    { 0 }
+    {
+        mTiles.resize(mWidth * mHeight, k_Empty);
+        mChunks.resize(mChunksX * mChunksY);
+
+        // Every chunk draws the same kind of quads, so a single static index buffer serves all of them.
+        constexpr UInt32 k_Quads = k_ChunkSize * k_ChunkSize;
+
+        Data Indices(k_Quads * 6 * sizeof(UInt16));
+
+        const Ptr<UInt16> Elements = Indices.GetData<UInt16>();
+
+        for (UInt32 Quad = 0; Quad < k_Quads; ++Quad)
+        {
+            const UInt16 Base = Quad * 4;
+
+            Elements[Quad * 6 + 0] = Base + 0;
+            Elements[Quad * 6 + 1] = Base + 1;
+            Elements[Quad * 6 + 2] = Base + 2;
+            Elements[Quad * 6 + 3] = Base + 0;
+            Elements[Quad * 6 + 4] = Base + 2;
+            Elements[Quad * 6 + 5] = Base + 3;
+        }
+        mIndices = mGraphics->CreateBuffer(Usage::Index, Move(Indices));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Tilemap::~Tilemap()
+    {
+        for (const UInt32 Index : mResident)
+        {
+            mGraphics->FreeGeometry(Usage::Vertex, mChunks[Index].Geometry);
+        }
+        mGraphics->DeleteBuffer(mIndices);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tilemap::SetTileset(UInt32 Columns, UInt32 Rows)
+    {
+        mColumns = Max(Columns, 1u);
+        mRows    = Max(Rows, 1u);
+
+        // Texture coordinates are baked into every chunk, so all of them have to be built again.
+        Invalidate(0, 0, mWidth, mHeight);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tilemap::SetTile(UInt32 X, UInt32 Y, UInt16 Tile)
+    {
+        if (Ref<UInt16> Previous = mTiles[Y * mWidth + X]; Previous != Tile)
+        {
+            Previous = Tile;
+            mChunks[(Y / k_ChunkSize) * mChunksX + (X / k_ChunkSize)].Dirty = true;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tilemap::SetTiles(UInt32 X, UInt32 Y, UInt32 Width, UInt32 Height, CPtr<const UInt16> Tiles)
+    {
+        for (UInt32 Row = 0; Row < Height; ++Row)
+        {
+            std::copy_n(Tiles.data() + Row * Width, Width, mTiles.data() + (Y + Row) * mWidth + X);
+        }
+        Invalidate(X, Y, Width, Height);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tilemap::Draw(Ref<Encoder> Encoder, ConstRef<Camera> Camera)
+    {
+        const Real32 Extent = mSize * k_ChunkSize;
+
+        ++mFrame;
+
+        // Find where the corners of the screen meet the plane of the map, which bounds the range of chunks
+        // that need to be looked at. A corner that never meets the plane leaves every chunk in range.
+        UInt32 MinimumX = 0;
+        UInt32 MinimumY = 0;
+        UInt32 MaximumX = mChunksX - 1;
+        UInt32 MaximumY = mChunksY - 1;
+
+        const Matrix4f Inverse = Camera.GetWorld().Inverse();
+
+        Real32 Left   = +std::numeric_limits<Real32>::max();
+        Real32 Right  = -std::numeric_limits<Real32>::max();
+        Real32 Bottom = +std::numeric_limits<Real32>::max();
+        Real32 Top    = -std::numeric_limits<Real32>::max();
+        Bool   Bound  = true;
+
+        for (UInt32 Corner = 0; Bound && Corner < 4; ++Corner)
+        {
+            const Real32 X = (Corner & 1 ? +1.0f : -1.0f);
+            const Real32 Y = (Corner & 2 ? +1.0f : -1.0f);
+
+            const Vector4f Near = Inverse * Vector4f(X, Y, 0.0f, 1.0f);
+            const Vector4f Far  = Inverse * Vector4f(X, Y, 1.0f, 1.0f);
+
+            const Vector3f From(Near.GetX() / Near.GetW(), Near.GetY() / Near.GetW(), Near.GetZ() / Near.GetW());
+            const Vector3f To(Far.GetX() / Far.GetW(), Far.GetY() / Far.GetW(), Far.GetZ() / Far.GetW());
+
+            const Real32 Span     = To.GetZ() - From.GetZ();
+            const Real32 Distance = (Span != 0.0f ? -From.GetZ() / Span : -1.0f);
+
+            if ((Bound = (Distance >= 0.0f && Distance <= 1.0f)))
+            {
+                const Vector3f Point = From + (To - From) * Distance;
+
+                Left   = Min(Left,   Point.GetX());
+                Right  = Max(Right,  Point.GetX());
+                Bottom = Min(Bottom, Point.GetY());
+                Top    = Max(Top,    Point.GetY());
+            }
+        }
+
+        const auto GetChunk = [Extent](Real32 Coordinate, UInt32 Chunks)
+        {
+            const Real32 Chunk = std::floor(Coordinate / Extent);
+            return static_cast<UInt32>(std::clamp(Chunk, 0.0f, static_cast<Real32>(Chunks - 1)));
+        };
+
+        if (Bound)
+        {
+            MinimumX = GetChunk(Left,   mChunksX);
+            MaximumX = GetChunk(Right,  mChunksX);
+            MinimumY = GetChunk(Bottom, mChunksY);
+            MaximumY = GetChunk(Top,    mChunksY);
+        }
+
+        // Every chunk is drawn with the state the caller left in the encoder (pipeline, textures, uniforms).
+        const Submission State = Encoder.GetInFlight();
+
+        // The shared index buffer can still be in the upload queue, chunks keep being built in the meantime.
+        const Bool Waiting = mGraphics->IsBufferPending(mIndices);
+
+        UInt32 Builds = 0;
+
+        for (UInt32 ChunkY = MinimumY; ChunkY <= MaximumY; ++ChunkY)
+        {
+            for (UInt32 ChunkX = MinimumX; ChunkX <= MaximumX; ++ChunkX)
+            {
+                const Vector3f Minimum(ChunkX * Extent, ChunkY * Extent, 0.0f);
+                const Vector3f Maximum(Minimum.GetX() + Extent, Minimum.GetY() + Extent, 0.0f);
+
+                if (!Camera.IsVisible(Minimum, Maximum))
+                {
+                    continue;
+                }
+
+                const UInt32 Index = ChunkY * mChunksX + ChunkX;
+                Ref<Chunk>   Chunk = mChunks[Index];
+                Chunk.Seen = mFrame;
+
+                // Spread the building of chunks over a few frames, a chunk that is already resident keeps
+                // drawing its previous geometry until then.
+                if (Chunk.Dirty && Builds < k_MaxBuilds)
+                {
+                    Build(Index);
+                    ++Builds;
+                }
+
+                // Chunks that spilled out of the geometry heap wait for their dedicated buffer to be uploaded.
+                const Bool Pending = Waiting || mGraphics->IsBufferPending(Chunk.Geometry.Buffer);
+
+                if (Chunk.Quads > 0 && !Pending)
+                {
+                    Encoder.SetInFlight(State);
+                    Encoder.SetVertices(0, Binding(Chunk.Geometry.Buffer, sizeof(Vertex), Chunk.Geometry.GetOffset()));
+                    Encoder.SetIndices(Binding(mIndices, sizeof(UInt16), 0));
+                    Encoder.Draw(Chunk.Quads * 6, 0, 0);
+                }
+            }
+        }
+
+        // Give back the geometry of the chunks that have been off screen for a while.
+        for (UInt32 Element = 0; Element < mResident.size();)
+        {
+            if (const UInt32 Index = mResident[Element]; mFrame - mChunks[Index].Seen > k_Grace)
+            {
+                Evict(Index);
+
+                mResident[Element] = mResident.back();
+                mResident.pop_back();
+            }
+            else
+            {
+                ++Element;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tilemap::Invalidate(UInt32 X, UInt32 Y, UInt32 Width, UInt32 Height)
+    {
+        if (Width == 0 || Height == 0)
+        {
+            return;
+        }
+
+        for (UInt32 ChunkY = Y / k_ChunkSize; ChunkY <= (Y + Height - 1) / k_ChunkSize; ++ChunkY)
+        {
+            for (UInt32 ChunkX = X / k_ChunkSize; ChunkX <= (X + Width - 1) / k_ChunkSize; ++ChunkX)
+            {
+                mChunks[ChunkY * mChunksX + ChunkX].Dirty = true;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tilemap::Build(UInt32 Index)
+    {
+        Ref<Chunk> Chunk = mChunks[Index];
+
+        const UInt32 StartX = (Index % mChunksX) * k_ChunkSize;
+        const UInt32 StartY = (Index / mChunksX) * k_ChunkSize;
+        const UInt32 EndX   = Min(StartX + k_ChunkSize, mWidth);
+        const UInt32 EndY   = Min(StartY + k_ChunkSize, mHeight);
+
+        UInt32 Quads = 0;
+
+        for (UInt32 Y = StartY; Y < EndY; ++Y)
+        {
+            const Ptr<const UInt16> Row = mTiles.data() + Y * mWidth;
+            Quads += (EndX - StartX) - std::count(Row + StartX, Row + EndX, k_Empty);
+        }
+
+        // The previous geometry may still be in use by the frames in flight, the service defers its release.
+        mGraphics->FreeGeometry(Usage::Vertex, Chunk.Geometry);
+
+        Chunk.Geometry = Range();
+        Chunk.Quads    = Quads;
+        Chunk.Dirty    = false;
+
+        if (Quads == 0)
+        {
+            return;
+        }
+
+        Data Bytes(Quads * 4 * sizeof(Vertex));
+
+        Ptr<Vertex>  Vertices = Bytes.GetData<Vertex>();
+        const Real32 Width    = 1.0f / mColumns;
+        const Real32 Height   = 1.0f / mRows;
+
+        for (UInt32 Y = StartY; Y < EndY; ++Y)
+        {
+            for (UInt32 X = StartX; X < EndX; ++X)
+            {
+                const UInt16 Tile = mTiles[Y * mWidth + X];
+
+                if (Tile == k_Empty)
+                {
+                    continue;
+                }
+
+                // Tiles are numbered from one, row by row across the tileset.
+                const Real32 U = ((Tile - 1) % mColumns) * Width;
+                const Real32 V = ((Tile - 1) / mColumns % mRows) * Height;
+
+                const Real32 Left   = X * mSize;
+                const Real32 Bottom = Y * mSize;
+
+                (* Vertices++) = Vertex(Vector2f(Left,         Bottom),         Vector2f(U,         V));
+                (* Vertices++) = Vertex(Vector2f(Left + mSize, Bottom),         Vector2f(U + Width, V));
+                (* Vertices++) = Vertex(Vector2f(Left + mSize, Bottom + mSize), Vector2f(U + Width, V + Height));
+                (* Vertices++) = Vertex(Vector2f(Left,         Bottom + mSize), Vector2f(U,         V + Height));
+            }
+        }
+
+        Chunk.Geometry = mGraphics->AllocateGeometry(Usage::Vertex, Move(Bytes));
+
+        if (!Chunk.Resident)
+        {
+            Chunk.Resident = true;
+            mResident.push_back(Index);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tilemap::Evict(UInt32 Index)
+    {
+        Ref<Chunk> Chunk = mChunks[Index];
+
+        mGraphics->FreeGeometry(Usage::Vertex, Chunk.Geometry);
+
+        Chunk.Geometry = Range();
+        Chunk.Quads    = 0;
+        Chunk.Dirty    = true;
+        Chunk.Resident = false;
+    }
+}
\ No newline at end of file
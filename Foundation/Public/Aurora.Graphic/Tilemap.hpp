@@ -0,0 +1,142 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Camera.hpp"
+#include "Service.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=(Undocumented)=-
+    class Tilemap final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_ChunkSize = 32;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_MaxBuilds = 32;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Grace     = 120;
+
+        // -=(Undocumented)=-
+        static constexpr UInt16 k_Empty     = 0;
+
+        // -=(Undocumented)=-
+        struct Vertex
+        {
+            // -=(Undocumented)=-
+            Vector2f Position;
+
+            // -=(Undocumented)=-
+            Vector2f TexCoord;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        Tilemap(ConstSPtr<Service> Graphics, UInt32 Width, UInt32 Height, Real32 Size);
+
+        // -=(Undocumented)=-
+        ~Tilemap();
+
+        // -=(Undocumented)=-
+        void SetTileset(UInt32 Columns, UInt32 Rows);
+
+        // -=(Undocumented)=-
+        void SetTile(UInt32 X, UInt32 Y, UInt16 Tile);
+
+        // -=(Undocumented)=-
+        void SetTiles(UInt32 X, UInt32 Y, UInt32 Width, UInt32 Height, CPtr<const UInt16> Tiles);
+
+        // -=(Undocumented)=-
+        UInt16 GetTile(UInt32 X, UInt32 Y) const
+        {
+            return mTiles[Y * mWidth + X];
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetWidth() const
+        {
+            return mWidth;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetHeight() const
+        {
+            return mHeight;
+        }
+
+        // -=(Undocumented)=-
+        void Draw(Ref<Encoder> Encoder, ConstRef<Camera> Camera);
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Chunk
+        {
+            // -=(Undocumented)=-
+            Range  Geometry;
+
+            // -=(Undocumented)=-
+            UInt32 Quads    = 0;
+
+            // -=(Undocumented)=-
+            Bool   Dirty    = true;
+
+            // -=(Undocumented)=-
+            Bool   Resident = false;
+
+            // -=(Undocumented)=-
+            UInt64 Seen     = 0;
+        };
+
+        // -=(Undocumented)=-
+        void Invalidate(UInt32 X, UInt32 Y, UInt32 Width, UInt32 Height);
+
+        // -=(Undocumented)=-
+        void Build(UInt32 Index);
+
+        // -=(Undocumented)=-
+        void Evict(UInt32 Index);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        SPtr<Service>  mGraphics;
+        UInt32         mWidth;
+        UInt32         mHeight;
+        Real32         mSize;
+        UInt32         mColumns;
+        UInt32         mRows;
+        Vector<UInt16> mTiles;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UInt32         mChunksX;
+        UInt32         mChunksY;
+        Vector<Chunk>  mChunks;
+        Vector<UInt32> mResident;
+        Object         mIndices;
+        UInt64         mFrame;
+    };
+}
\ No newline at end of file
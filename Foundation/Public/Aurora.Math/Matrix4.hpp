@@ -129,6 +129,52 @@ inline namespace Math
         // -=(Undocumented)=-
         Matrix4<Base> Inverse() const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                // Column based inverse: with a, b, c, d the columns (x, y, z, w their last row), the rows of the
+                // inverse come out of a handful of cross products instead of sixteen 3x3 cofactors.
+                const SIMD::Register A = mColumns[0].Load();
+                const SIMD::Register B = mColumns[1].Load();
+                const SIMD::Register C = mColumns[2].Load();
+                const SIMD::Register D = mColumns[3].Load();
+
+                const SIMD::Register X = SIMD::Splat(mColumns[0].GetW());
+                const SIMD::Register Y = SIMD::Splat(mColumns[1].GetW());
+                const SIMD::Register Z = SIMD::Splat(mColumns[2].GetW());
+                const SIMD::Register W = SIMD::Splat(mColumns[3].GetW());
+
+                const SIMD::Register Axis = SIMD::Set(1.0f, 1.0f, 1.0f, 0.0f);
+
+                SIMD::Register S = SIMD::Cross(A, B);
+                SIMD::Register T = SIMD::Cross(C, D);
+                SIMD::Register U = SIMD::Mul(SIMD::Sub(SIMD::Mul(A, Y), SIMD::Mul(B, X)), Axis);
+                SIMD::Register V = SIMD::Mul(SIMD::Sub(SIMD::Mul(C, W), SIMD::Mul(D, Z)), Axis);
+
+                const Real32 Determinant = SIMD::Dot(S, V) + SIMD::Dot(T, U);
+
+                if (Determinant == 0)
+                {
+                    return Matrix4<Base>();
+                }
+
+                const SIMD::Register Reciprocal = SIMD::Splat(1.0f / Determinant);
+                S = SIMD::Mul(S, Reciprocal);
+                T = SIMD::Mul(T, Reciprocal);
+                U = SIMD::Mul(U, Reciprocal);
+                V = SIMD::Mul(V, Reciprocal);
+
+                SIMD::Register R0 = SIMD::Add(SIMD::Cross(B, V), SIMD::Mul(T, Y));
+                SIMD::Register R1 = SIMD::Sub(SIMD::Cross(V, A), SIMD::Mul(T, X));
+                SIMD::Register R2 = SIMD::Add(SIMD::Cross(D, U), SIMD::Mul(S, W));
+                SIMD::Register R3 = SIMD::Sub(SIMD::Cross(U, C), SIMD::Mul(S, Z));
+                SIMD::Transpose(R0, R1, R2, R3);
+
+                const Column Last(-SIMD::Dot(B, T), SIMD::Dot(A, T), -SIMD::Dot(D, S), SIMD::Dot(C, S));
+                return Matrix4<Base>(Column::Store(R0), Column::Store(R1), Column::Store(R2), Last);
+            }
+#endif // AURORA_SIMD
+
             const Base C0 =
                 GetComponent(5)  * GetComponent(10) * GetComponent(15) -
                 GetComponent(5)  * GetComponent(11) * GetComponent(14) -
@@ -322,6 +368,30 @@ inline namespace Math
         // -=(Undocumented)=-
         Matrix4<Base> operator*(ConstRef<Matrix4<Base>> Matrix) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                const SIMD::Register C0 = mColumns[0].Load();
+                const SIMD::Register C1 = mColumns[1].Load();
+                const SIMD::Register C2 = mColumns[2].Load();
+                const SIMD::Register C3 = mColumns[3].Load();
+
+                Matrix4<Base> Result;
+
+                for (UInt32 Column = 0; Column < 4; ++Column)
+                {
+                    ConstRef<Matrix4<Base>::Column> Vector = Matrix.mColumns[Column];
+
+                    const SIMD::Register XY = SIMD::Add(
+                        SIMD::Mul(C0, SIMD::Splat(Vector.GetX())), SIMD::Mul(C1, SIMD::Splat(Vector.GetY())));
+                    const SIMD::Register ZW = SIMD::Add(
+                        SIMD::Mul(C2, SIMD::Splat(Vector.GetZ())), SIMD::Mul(C3, SIMD::Splat(Vector.GetW())));
+                    Result.mColumns[Column] = Matrix4<Base>::Column::Store(SIMD::Add(XY, ZW));
+                }
+                return Result;
+            }
+#endif // AURORA_SIMD
+
             Matrix4<Base> Result;
 
             const Vector4<Base> R0(GetComponent(0), GetComponent(4), GetComponent(8), GetComponent(12));
@@ -357,6 +427,15 @@ inline namespace Math
         // -=(Undocumented)=-
         Vector3<Base> operator*(ConstRef<Vector3<Base>> Vector) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                const Column Result = (* this) * Column(Vector.GetX(), Vector.GetY(), Vector.GetZ(), 1.0f);
+                const Real32 W      = 1.0f / Result.GetW();
+                return Vector3<Base>(Result.GetX() * W, Result.GetY() * W, Result.GetZ() * W);
+            }
+#endif // AURORA_SIMD
+
             const Base X = Vector.GetX();
             const Base Y = Vector.GetY();
             const Base Z = Vector.GetZ();
@@ -372,6 +451,19 @@ inline namespace Math
         // -=(Undocumented)=-
         Vector4<Base> operator*(ConstRef<Vector4<Base>> Vector) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                const SIMD::Register XY = SIMD::Add(
+                    SIMD::Mul(mColumns[0].Load(), SIMD::Splat(Vector.GetX())),
+                    SIMD::Mul(mColumns[1].Load(), SIMD::Splat(Vector.GetY())));
+                const SIMD::Register ZW = SIMD::Add(
+                    SIMD::Mul(mColumns[2].Load(), SIMD::Splat(Vector.GetZ())),
+                    SIMD::Mul(mColumns[3].Load(), SIMD::Splat(Vector.GetW())));
+                return Vector4<Base>::Store(SIMD::Add(XY, ZW));
+            }
+#endif // AURORA_SIMD
+
             const Base X = Vector.GetX();
             const Base Y = Vector.GetY();
             const Base Z = Vector.GetZ();
@@ -619,6 +711,33 @@ inline namespace Math
                     0.0,             0.0,             0.0,                   1.0);
         }
 
+        // -=(Undocumented)=-
+        static constexpr Matrix4<Base> FromTRS(
+            ConstRef<Vector3<Base>> Translation, ConstRef<Quaternion<Base>> Rotation, ConstRef<Vector3<Base>> Scale)
+        {
+            // Equivalent to FromTranslation(T) * FromRotation(R) * FromScale(S), but built directly from the
+            // quaternion with every rotation column scaled in place instead of paying for two full products.
+            const Base XX = Rotation.GetX() * Rotation.GetX();
+            const Base YY = Rotation.GetY() * Rotation.GetY();
+            const Base ZZ = Rotation.GetZ() * Rotation.GetZ();
+            const Base XZ = Rotation.GetX() * Rotation.GetZ();
+            const Base YZ = Rotation.GetY() * Rotation.GetZ();
+            const Base XY = Rotation.GetX() * Rotation.GetY();
+            const Base WX = Rotation.GetW() * Rotation.GetX();
+            const Base WY = Rotation.GetW() * Rotation.GetY();
+            const Base WZ = Rotation.GetW() * Rotation.GetZ();
+
+            const Base SX = Scale.GetX();
+            const Base SY = Scale.GetY();
+            const Base SZ = Scale.GetZ();
+
+            return Matrix4<Base>(
+                (1 - 2 * (YY + ZZ)) * SX, 2 * (XY + WZ) * SX,       2 * (XZ - WY) * SX,       0,
+                2 * (XY - WZ) * SY,       (1 - 2 * (XX + ZZ)) * SY, 2 * (WX + YZ) * SY,       0,
+                2 * (WY + XZ) * SZ,       2 * (YZ - WX) * SZ,       (1 - 2 * (XX + YY)) * SZ, 0,
+                Translation.GetX(),       Translation.GetY(),       Translation.GetZ(),       1);
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -12,6 +12,7 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "SIMD.hpp"
 #include "Vector3.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -128,6 +129,31 @@ inline namespace Math
         // -=(Undocumented)=-
         Quaternion<Base> operator*(ConstRef<Quaternion<Base>> Other) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                static_assert(sizeof(Quaternion<Real32>) == sizeof(Real32) * 4, "Quaternion must be tightly packed");
+
+                const SIMD::Register Second = SIMD::Load(reinterpret_cast<Ptr<const Real32>>(AddressOf(Other)));
+
+                // Hamilton product as four lane-wise multiplies of the second operand, shuffled and sign flipped.
+                const SIMD::Register Real = SIMD::Mul(SIMD::Splat(mReal), Second);
+                const SIMD::Register X    = SIMD::Mul(
+                    SIMD::Splat(mImaginary.GetX()),
+                    SIMD::Mul(SIMD::Swizzle<3, 2, 1, 0>(Second), SIMD::Set(+1.0f, -1.0f, +1.0f, -1.0f)));
+                const SIMD::Register Y    = SIMD::Mul(
+                    SIMD::Splat(mImaginary.GetY()),
+                    SIMD::Mul(SIMD::Swizzle<2, 3, 0, 1>(Second), SIMD::Set(+1.0f, +1.0f, -1.0f, -1.0f)));
+                const SIMD::Register Z    = SIMD::Mul(
+                    SIMD::Splat(mImaginary.GetZ()),
+                    SIMD::Mul(SIMD::Swizzle<1, 0, 3, 2>(Second), SIMD::Set(-1.0f, +1.0f, +1.0f, -1.0f)));
+
+                alignas(16) Real32 Lanes[4];
+                SIMD::Store(Lanes, SIMD::Add(SIMD::Add(Real, X), SIMD::Add(Y, Z)));
+                return Quaternion<Base>(Lanes[0], Lanes[1], Lanes[2], Lanes[3]);
+            }
+#endif // AURORA_SIMD
+
             const Vector3<Base> Imaginary
                 = Other.mImaginary * mReal + mImaginary * Other.mReal + Vector3<Base>::Cross(mImaginary, Other.mImaginary);
             return Quaternion<Base>(Imaginary, mReal * Other.mReal - mImaginary.Dot(Other.mImaginary));
@@ -152,8 +178,9 @@ inline namespace Math
         // -=(Undocumented)=-
         Ref<Quaternion<Base>> operator*=(ConstRef<Quaternion<Base>> Other)
         {
-            mImaginary = Other.mImaginary * mReal + mImaginary * Other.mReal + Vector3<Base>::Cross(mImaginary, Other.mImaginary);
-            mReal      = Other.mReal * mReal - mImaginary.Dot(Other.mImaginary);
+            const Quaternion<Base> Result = (* this) * Other;
+            mImaginary = Result.mImaginary;
+            mReal      = Result.mReal;
             return (* this);
         }
 
@@ -0,0 +1,314 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Base/Base.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#if   defined(SDL_SSE2_INTRINSICS) || defined(SDL_SSE_INTRINSICS)
+    #define AURORA_SIMD_SSE
+#elif defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+    #define AURORA_SIMD_NEON
+#endif
+
+#if defined(AURORA_SIMD_SSE) || defined(AURORA_SIMD_NEON)
+    #define AURORA_SIMD
+#endif
+
+#ifdef    AURORA_SIMD
+
+inline namespace Math
+{
+    namespace SIMD
+    {
+#if   defined(AURORA_SIMD_SSE)
+
+        // -=(Undocumented)=-
+        using Register = __m128;
+
+        // -=(Undocumented)=-
+        inline Register Load(Ptr<const Real32> Source)
+        {
+            return _mm_loadu_ps(Source);
+        }
+
+        // -=(Undocumented)=-
+        inline void Store(Ptr<Real32> Destination, Register Value)
+        {
+            _mm_storeu_ps(Destination, Value);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Set(Real32 X, Real32 Y, Real32 Z, Real32 W)
+        {
+            return _mm_setr_ps(X, Y, Z, W);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Splat(Real32 Value)
+        {
+            return _mm_set1_ps(Value);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Add(Register First, Register Second)
+        {
+            return _mm_add_ps(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Sub(Register First, Register Second)
+        {
+            return _mm_sub_ps(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Mul(Register First, Register Second)
+        {
+            return _mm_mul_ps(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Div(Register First, Register Second)
+        {
+            return _mm_div_ps(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Sqrt(Register Value)
+        {
+            return _mm_sqrt_ps(Value);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Min(Register First, Register Second)
+        {
+            return _mm_min_ps(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Max(Register First, Register Second)
+        {
+            return _mm_max_ps(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register GreaterEqual(Register First, Register Second)
+        {
+            return _mm_cmpge_ps(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register And(Register First, Register Second)
+        {
+            return _mm_and_ps(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Select(Register Mask, Register True, Register False)
+        {
+            return _mm_or_ps(_mm_and_ps(Mask, True), _mm_andnot_ps(Mask, False));
+        }
+
+        // -=(Undocumented)=-
+        inline Bool Any(Register Mask)
+        {
+            return _mm_movemask_ps(Mask) != 0;
+        }
+
+        // -=(Undocumented)=-
+        inline UInt32 GetMask(Register Mask)
+        {
+            return static_cast<UInt32>(_mm_movemask_ps(Mask));
+        }
+
+        // -=(Undocumented)=-
+        template<UInt32 X, UInt32 Y, UInt32 Z, UInt32 W>
+        inline Register Swizzle(Register Value)
+        {
+            return _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        // -=(Undocumented)=-
+        inline Real32 Sum(Register Value)
+        {
+            const Register Pair = _mm_add_ps(Value, _mm_movehl_ps(Value, Value));
+            return _mm_cvtss_f32(_mm_add_ss(Pair, _mm_shuffle_ps(Pair, Pair, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+
+        // -=(Undocumented)=-
+        inline void Transpose(Ref<Register> R0, Ref<Register> R1, Ref<Register> R2, Ref<Register> R3)
+        {
+            _MM_TRANSPOSE4_PS(R0, R1, R2, R3);
+        }
+
+#elif defined(AURORA_SIMD_NEON)
+
+        // -=(Undocumented)=-
+        using Register = float32x4_t;
+
+        // -=(Undocumented)=-
+        inline Register Load(Ptr<const Real32> Source)
+        {
+            return vld1q_f32(Source);
+        }
+
+        // -=(Undocumented)=-
+        inline void Store(Ptr<Real32> Destination, Register Value)
+        {
+            vst1q_f32(Destination, Value);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Set(Real32 X, Real32 Y, Real32 Z, Real32 W)
+        {
+            const Real32 Lanes[4] = { X, Y, Z, W };
+            return vld1q_f32(Lanes);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Splat(Real32 Value)
+        {
+            return vdupq_n_f32(Value);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Add(Register First, Register Second)
+        {
+            return vaddq_f32(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Sub(Register First, Register Second)
+        {
+            return vsubq_f32(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Mul(Register First, Register Second)
+        {
+            return vmulq_f32(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Div(Register First, Register Second)
+        {
+            return vdivq_f32(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Sqrt(Register Value)
+        {
+            return vsqrtq_f32(Value);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Min(Register First, Register Second)
+        {
+            return vminq_f32(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register Max(Register First, Register Second)
+        {
+            return vmaxq_f32(First, Second);
+        }
+
+        // -=(Undocumented)=-
+        inline Register GreaterEqual(Register First, Register Second)
+        {
+            return vreinterpretq_f32_u32(vcgeq_f32(First, Second));
+        }
+
+        // -=(Undocumented)=-
+        inline Register And(Register First, Register Second)
+        {
+            return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(First), vreinterpretq_u32_f32(Second)));
+        }
+
+        // -=(Undocumented)=-
+        inline Register Select(Register Mask, Register True, Register False)
+        {
+            return vbslq_f32(vreinterpretq_u32_f32(Mask), True, False);
+        }
+
+        // -=(Undocumented)=-
+        inline Bool Any(Register Mask)
+        {
+            return vmaxvq_u32(vreinterpretq_u32_f32(Mask)) != 0;
+        }
+
+        // -=(Undocumented)=-
+        inline UInt32 GetMask(Register Mask)
+        {
+            // Move the sign bit of every lane to the bottom and shift it to its own position, like a movemask.
+            const int32x4_t  Shift = { 0, 1, 2, 3 };
+            const uint32x4_t Bits  = vshrq_n_u32(vreinterpretq_u32_f32(Mask), 31);
+            return vaddvq_u32(vshlq_u32(Bits, Shift));
+        }
+
+        // -=(Undocumented)=-
+        template<UInt32 X, UInt32 Y, UInt32 Z, UInt32 W>
+        inline Register Swizzle(Register Value)
+        {
+#if   defined(__clang__)
+            return __builtin_shufflevector(Value, Value, X, Y, Z, W);
+#elif defined(__GNUC__)
+            return __builtin_shuffle(Value, uint32x4_t { X, Y, Z, W });
+#else
+            return Set(
+                vgetq_lane_f32(Value, X), vgetq_lane_f32(Value, Y), vgetq_lane_f32(Value, Z), vgetq_lane_f32(Value, W));
+#endif
+        }
+
+        // -=(Undocumented)=-
+        inline Real32 Sum(Register Value)
+        {
+            return vaddvq_f32(Value);
+        }
+
+        // -=(Undocumented)=-
+        inline void Transpose(Ref<Register> R0, Ref<Register> R1, Ref<Register> R2, Ref<Register> R3)
+        {
+            const float32x4x2_t T01 = vtrnq_f32(R0, R1);
+            const float32x4x2_t T23 = vtrnq_f32(R2, R3);
+
+            R0 = vcombine_f32(vget_low_f32(T01.val[0]),  vget_low_f32(T23.val[0]));
+            R1 = vcombine_f32(vget_low_f32(T01.val[1]),  vget_low_f32(T23.val[1]));
+            R2 = vcombine_f32(vget_high_f32(T01.val[0]), vget_high_f32(T23.val[0]));
+            R3 = vcombine_f32(vget_high_f32(T01.val[1]), vget_high_f32(T23.val[1]));
+        }
+
+#endif // AURORA_SIMD_SSE
+
+        // -=(Undocumented)=-
+        inline Real32 Dot(Register First, Register Second)
+        {
+            return Sum(Mul(First, Second));
+        }
+
+        // -=(Undocumented)=-
+        inline Register Cross(Register First, Register Second)
+        {
+            // Cross product of the first three lanes, the fourth one always comes out as zero.
+            const Register Left  = Mul(Swizzle<1, 2, 0, 3>(First), Swizzle<2, 0, 1, 3>(Second));
+            const Register Right = Mul(Swizzle<2, 0, 1, 3>(First), Swizzle<1, 2, 0, 3>(Second));
+            return Sub(Left, Right);
+        }
+    }
+}
+
+#endif // AURORA_SIMD
\ No newline at end of file
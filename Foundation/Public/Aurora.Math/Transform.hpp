@@ -61,10 +61,34 @@ inline namespace Math
         // -=(Undocumented)=-
         Matrix4<Base> Compute() const
         {
-            const Matrix4<Base> Scale       = Matrix4<Base>::FromScale(mScale);
-            const Matrix4<Base> Rotation    = Matrix4<Base>::FromRotation(mRotation);
-            const Matrix4<Base> Translation = Matrix4<Base>::FromTranslation(mPosition);
-            return Translation * Rotation * Scale;
+            return Matrix4<Base>::FromTRS(mPosition, mRotation, mScale);
+        }
+
+        // -=(Undocumented)=-
+        static void Compute(CPtr<const Transform> Transforms, CPtr<Matrix4<Base>> Matrices)
+        {
+            const UInt Count = Min(Transforms.size(), Matrices.size());
+
+            for (UInt Index = 0; Index < Count; ++Index)
+            {
+                ConstRef<Transform> Source = Transforms[Index];
+                Matrices[Index] = Matrix4<Base>::FromTRS(Source.mPosition, Source.mRotation, Source.mScale);
+            }
+        }
+
+        // -=(Undocumented)=-
+        static void Compute(
+            CPtr<const Vector3<Base>>    Positions,
+            CPtr<const Quaternion<Base>> Rotations,
+            CPtr<const Vector3<Base>>    Scales,
+            CPtr<Matrix4<Base>>          Matrices)
+        {
+            const UInt Count = Min(Min(Positions.size(), Rotations.size()), Min(Scales.size(), Matrices.size()));
+
+            for (UInt Index = 0; Index < Count; ++Index)
+            {
+                Matrices[Index] = Matrix4<Base>::FromTRS(Positions[Index], Rotations[Index], Scales[Index]);
+            }
         }
 
         // -=(Undocumented)=-
@@ -12,6 +12,7 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "SIMD.hpp"
 #include "Trigonometry.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -148,18 +149,38 @@ inline namespace Math
         // -=(Undocumented)=-
         Real32 GetLengthSquared() const
         {
-            return (mX * mX + mY * mY + mZ * mZ + mW * mW);
+            return Dot(* this);
         }
 
         // -=(Undocumented)=-
         Real32 Dot(ConstRef<Vector4<Base>> Other) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return SIMD::Dot(Load(), Other.Load());
+                }
+            }
+#endif // AURORA_SIMD
+
             return (mX * Other.mX) + (mY * Other.mY) + (mZ * Other.mZ) + (mW * Other.mW);
         }
 
         // -=(Undocumented)=-
         constexpr Vector4<Base> operator+(ConstRef<Vector4<Base>> Vector) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return Store(SIMD::Add(Load(), Vector.Load()));
+                }
+            }
+#endif // AURORA_SIMD
+
             return Vector4<Base>(mX + Vector.mX, mY + Vector.mY, mZ + Vector.mZ, mW + Vector.mW);
         }
 
@@ -178,6 +199,16 @@ inline namespace Math
         // -=(Undocumented)=-
         constexpr Vector4<Base> operator-(ConstRef<Vector4<Base>> Vector) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return Store(SIMD::Sub(Load(), Vector.Load()));
+                }
+            }
+#endif // AURORA_SIMD
+
             return Vector4<Base>(mX - Vector.mX, mY - Vector.mY, mZ - Vector.mZ, mW - Vector.mW);
         }
 
@@ -190,18 +221,48 @@ inline namespace Math
         // -=(Undocumented)=-
         constexpr Vector4<Base> operator*(ConstRef<Vector4<Base>> Vector) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return Store(SIMD::Mul(Load(), Vector.Load()));
+                }
+            }
+#endif // AURORA_SIMD
+
             return Vector4<Base>(mX * Vector.mX, mY * Vector.mY, mZ * Vector.mZ, mW * Vector.mW);
         }
 
         // -=(Undocumented)=-
         constexpr Vector4<Base> operator*(Base Scalar) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return Store(SIMD::Mul(Load(), SIMD::Splat(Scalar)));
+                }
+            }
+#endif // AURORA_SIMD
+
             return Vector4<Base>(mX * Scalar, mY * Scalar, mZ * Scalar, mW * Scalar);
         }
 
         // -=(Undocumented)=-
         constexpr Vector4<Base> operator/(ConstRef<Vector4<Base>> Vector) const
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return Store(SIMD::Div(Load(), Vector.Load()));
+                }
+            }
+#endif // AURORA_SIMD
+
             return Vector4<Base>(mX / Vector.mX, mY / Vector.mY, mZ / Vector.mZ, mW / Vector.mW);
         }
 
@@ -344,6 +405,16 @@ inline namespace Math
         // -=(Undocumented)=-
         static Vector4<Base> Min(ConstRef<Vector4<Base>> P0, ConstRef<Vector4<Base>> P1)
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return Store(SIMD::Min(P0.Load(), P1.Load()));
+                }
+            }
+#endif // AURORA_SIMD
+
             const Base X = P0.GetX() < P1.GetX() ? P0.GetX() : P1.GetX();
             const Base Y = P0.GetY() < P1.GetY() ? P0.GetY() : P1.GetY();
             const Base Z = P0.GetZ() < P1.GetZ() ? P0.GetZ() : P1.GetZ();
@@ -354,6 +425,16 @@ inline namespace Math
         // -=(Undocumented)=-
         static Vector4<Base> Max(ConstRef<Vector4<Base>> P0, ConstRef<Vector4<Base>> P1)
         {
+#ifdef    AURORA_SIMD
+            if constexpr (std::is_same_v<Base, Real32>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return Store(SIMD::Max(P0.Load(), P1.Load()));
+                }
+            }
+#endif // AURORA_SIMD
+
             const Base X = P0.GetX() < P1.GetX() ? P1.GetX() : P0.GetX();
             const Base Y = P0.GetY() < P1.GetY() ? P1.GetY() : P0.GetY();
             const Base Z = P0.GetZ() < P1.GetZ() ? P1.GetZ() : P0.GetZ();
@@ -378,6 +459,26 @@ inline namespace Math
             return Start * Cosine(Theta) + Relative * Sine(Theta);
         }
 
+#ifdef    AURORA_SIMD
+
+    public:
+
+        // -=(Undocumented)=-
+        SIMD::Register Load() const
+        {
+            return SIMD::Load(AddressOf(mX));
+        }
+
+        // -=(Undocumented)=-
+        static Vector4<Base> Store(SIMD::Register Value)
+        {
+            Vector4<Base> Result;
+            SIMD::Store(AddressOf(Result.mX), Value);
+            return Result;
+        }
+
+#endif // AURORA_SIMD
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -0,0 +1,270 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Emitter.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Particle
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 LerpColor(UInt32 Start, UInt32 End, Real32 Percentage)
+    {
+        UInt32 Result = 0;
+
+        // Interpolate every byte on its own, which keeps the packed order of the color untouched.
+        for (UInt32 Shift = 0; Shift < 32; Shift += 8)
+        {
+            const Real32 First  = static_cast<Real32>(Start >> Shift & 0xFF);
+            const Real32 Second = static_cast<Real32>(End   >> Shift & 0xFF);
+
+            Result |= static_cast<UInt32>(First + (Second - First) * Percentage + 0.5f) << Shift;
+        }
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Type, typename Function>
+    static auto Evaluate(ConstRef<Vector<Emitter::Key<Type>>> Keys, Real32 Time, Function Interpolate)
+    {
+        if (Time <= Keys.front().Time)
+        {
+            return Interpolate(Keys.front().Value, Keys.front().Value, 0.0f);
+        }
+
+        for (UInt32 Index = 1; Index < Keys.size(); ++Index)
+        {
+            ConstRef<Emitter::Key<Type>> Previous = Keys[Index - 1];
+            ConstRef<Emitter::Key<Type>> Next     = Keys[Index];
+
+            if (Time <= Next.Time)
+            {
+                const Real32 Span = Next.Time - Previous.Time;
+                return Interpolate(Previous.Value, Next.Value, Span > 0.0f ? (Time - Previous.Time) / Span : 0.0f);
+            }
+        }
+        return Interpolate(Keys.back().Value, Keys.back().Value, 0.0f);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Emitter::Emitter(ConstRef<Properties> Properties, UInt32 Seed)
+        : mProperties  { Properties },
+          mActive      { true },
+          mAccumulator { 0.0f },
+          mBurst       { 0 },
+          mSeed        { Seed != 0 ? Seed : 0x9E3779B9 },
+          mCount       { 0 }
+    {
+        // Pad the streams to a whole number of lanes, so the vectorized loops never need a scalar tail.
+        const UInt32 Capacity = Align(mProperties.Capacity, k_Lanes);
+
+        for (Ptr<Vector<Real32>> Stream : {
+            &mPositionX, &mPositionY, &mPositionZ, &mVelocityX, &mVelocityY, &mVelocityZ, &mAge, &mDecay })
+        {
+            Stream->resize(Capacity, 0.0f);
+        }
+
+        // Bake both curves into small tables indexed by the normalized age of the particle, this way writing the
+        // billboards is a plain lookup no matter how many keys the curves have.
+        for (UInt32 Sample = 0; Sample < k_Samples; ++Sample)
+        {
+            const Real32 Time = static_cast<Real32>(Sample) / static_cast<Real32>(k_Samples - 1);
+
+            mColors[Sample] = mProperties.Colors.empty() ? Color(1.0f, 1.0f, 1.0f, 1.0f).GetValue() :
+                Evaluate(mProperties.Colors, Time, [](ConstRef<Color> Start, ConstRef<Color> End, Real32 Percentage)
+                {
+                    return LerpColor(Start.GetValue(), End.GetValue(), Percentage);
+                });
+
+            mSizes[Sample]  = mProperties.Sizes.empty() ? 1.0f :
+                Evaluate(mProperties.Sizes, Time, [](Real32 Start, Real32 End, Real32 Percentage)
+                {
+                    return Start + (End - Start) * Percentage;
+                });
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Emitter::Simulate(Real32 Delta)
+    {
+        Integrate(Delta);
+        Compact();
+
+        UInt32 Count = mBurst;
+        mBurst = 0;
+
+        if (mActive)
+        {
+            mAccumulator += mProperties.Rate * Delta;
+
+            const Real32 Whole = floorf(mAccumulator);
+            mAccumulator -= Whole;
+            Count        += static_cast<UInt32>(Whole);
+        }
+        Spawn(Count);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Emitter::Write(Ptr<Vertex> Output, ConstRef<Vector3f> Right, ConstRef<Vector3f> Up) const
+    {
+        for (UInt32 Index = 0; Index < mCount; ++Index)
+        {
+            const UInt32 Sample = Min(static_cast<UInt32>(mAge[Index] * (k_Samples - 1)), k_Samples - 1);
+            const UInt32 Tint   = mColors[Sample];
+            const Real32 Extent = mSizes[Sample] * 0.5f;
+
+            const Vector3f Center(mPositionX[Index], mPositionY[Index], mPositionZ[Index]);
+            const Vector3f Width  = Right * Extent;
+            const Vector3f Height = Up * Extent;
+
+            Output[0] = { Center - Width - Height, Vector2f(0.0f, 1.0f), Tint };
+            Output[1] = { Center + Width - Height, Vector2f(1.0f, 1.0f), Tint };
+            Output[2] = { Center + Width + Height, Vector2f(1.0f, 0.0f), Tint };
+            Output[3] = { Center - Width + Height, Vector2f(0.0f, 0.0f), Tint };
+            Output   += 4;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Emitter::Integrate(Real32 Delta)
+    {
+        const Real32   Damping = Max(1.0f - mProperties.Drag * Delta, 0.0f);
+        const Vector3f Impulse = mProperties.Gravity * Delta;
+
+#if defined(SDL_SSE_INTRINSICS)
+        const __m128 Step     = _mm_set1_ps(Delta);
+        const __m128 Decay    = _mm_set1_ps(Damping);
+        const __m128 ImpulseX = _mm_set1_ps(Impulse.GetX());
+        const __m128 ImpulseY = _mm_set1_ps(Impulse.GetY());
+        const __m128 ImpulseZ = _mm_set1_ps(Impulse.GetZ());
+#endif // SDL_SSE_INTRINSICS
+
+        // Streams are padded to whole lanes, so the last batch may touch dead slots, which is harmless.
+        for (UInt32 Index = 0; Index < mCount; Index += k_Lanes)
+        {
+#if defined(SDL_SSE_INTRINSICS)
+            const __m128 VelocityX = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&mVelocityX[Index]), Decay), ImpulseX);
+            const __m128 VelocityY = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&mVelocityY[Index]), Decay), ImpulseY);
+            const __m128 VelocityZ = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&mVelocityZ[Index]), Decay), ImpulseZ);
+
+            const __m128 PositionX = _mm_add_ps(_mm_loadu_ps(&mPositionX[Index]), _mm_mul_ps(VelocityX, Step));
+            const __m128 PositionY = _mm_add_ps(_mm_loadu_ps(&mPositionY[Index]), _mm_mul_ps(VelocityY, Step));
+            const __m128 PositionZ = _mm_add_ps(_mm_loadu_ps(&mPositionZ[Index]), _mm_mul_ps(VelocityZ, Step));
+
+            const __m128 Lifetime  = _mm_mul_ps(_mm_loadu_ps(&mDecay[Index]), Step);
+            const __m128 Age       = _mm_add_ps(_mm_loadu_ps(&mAge[Index]), Lifetime);
+
+            _mm_storeu_ps(&mVelocityX[Index], VelocityX);
+            _mm_storeu_ps(&mVelocityY[Index], VelocityY);
+            _mm_storeu_ps(&mVelocityZ[Index], VelocityZ);
+            _mm_storeu_ps(&mPositionX[Index], PositionX);
+            _mm_storeu_ps(&mPositionY[Index], PositionY);
+            _mm_storeu_ps(&mPositionZ[Index], PositionZ);
+            _mm_storeu_ps(&mAge[Index], Age);
+#else
+            for (UInt32 Lane = Index; Lane < Index + k_Lanes; ++Lane)
+            {
+                mVelocityX[Lane] = mVelocityX[Lane] * Damping + Impulse.GetX();
+                mVelocityY[Lane] = mVelocityY[Lane] * Damping + Impulse.GetY();
+                mVelocityZ[Lane] = mVelocityZ[Lane] * Damping + Impulse.GetZ();
+
+                mPositionX[Lane] += mVelocityX[Lane] * Delta;
+                mPositionY[Lane] += mVelocityY[Lane] * Delta;
+                mPositionZ[Lane] += mVelocityZ[Lane] * Delta;
+
+                mAge[Lane] += mDecay[Lane] * Delta;
+            }
+#endif // SDL_SSE_INTRINSICS
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Emitter::Compact()
+    {
+        // Particles are unordered, so a dead one is replaced by the last alive one to keep the streams dense.
+        for (UInt32 Index = 0; Index < mCount;)
+        {
+            if (mAge[Index] < 1.0f)
+            {
+                ++Index;
+                continue;
+            }
+
+            const UInt32 Last = --mCount;
+
+            mPositionX[Index] = mPositionX[Last];
+            mPositionY[Index] = mPositionY[Last];
+            mPositionZ[Index] = mPositionZ[Last];
+            mVelocityX[Index] = mVelocityX[Last];
+            mVelocityY[Index] = mVelocityY[Last];
+            mVelocityZ[Index] = mVelocityZ[Last];
+            mAge[Index]       = mAge[Last];
+            mDecay[Index]     = mDecay[Last];
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Emitter::Spawn(UInt32 Count)
+    {
+        ConstRef<Vector3f> Minimum = mProperties.MinimumVelocity;
+        ConstRef<Vector3f> Maximum = mProperties.MaximumVelocity;
+
+        Count = Min(Count, mProperties.Capacity - mCount);
+
+        for (UInt32 Index = mCount; Index < mCount + Count; ++Index)
+        {
+            mPositionX[Index] = mPosition.GetX();
+            mPositionY[Index] = mPosition.GetY();
+            mPositionZ[Index] = mPosition.GetZ();
+            mVelocityX[Index] = Random(Minimum.GetX(), Maximum.GetX());
+            mVelocityY[Index] = Random(Minimum.GetY(), Maximum.GetY());
+            mVelocityZ[Index] = Random(Minimum.GetZ(), Maximum.GetZ());
+            mAge[Index]       = 0.0f;
+
+            const Real32 Lifetime = Random(mProperties.MinimumLifetime, mProperties.MaximumLifetime);
+            mDecay[Index]     = 1.0f / Max(Lifetime, 0.001f);
+        }
+        mCount += Count;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Real32 Emitter::Random(Real32 Minimum, Real32 Maximum)
+    {
+        // Xorshift is plenty for visual noise and keeps every emitter independent when simulated on workers.
+        mSeed ^= mSeed << 13;
+        mSeed ^= mSeed >> 17;
+        mSeed ^= mSeed << 5;
+
+        const Real32 Percentage = static_cast<Real32>(mSeed >> 8) * (1.0f / 16777216.0f);
+        return Minimum + (Maximum - Minimum) * Percentage;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Color.hpp"
+#include "Aurora.Math/Vector2.hpp"
+#include "Aurora.Math/Vector3.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Particle
+{
+    // -=(Undocumented)=-
+    class Emitter final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Lanes   = 4;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Samples = 32;
+
+        // -=(Undocumented)=-
+        template<typename Type>
+        struct Key
+        {
+            // -=(Undocumented)=-
+            Real32 Time = 0.0f;
+
+            // -=(Undocumented)=-
+            Type   Value;
+        };
+
+        // -=(Undocumented)=-
+        struct Properties
+        {
+            // -=(Undocumented)=-
+            Real32              Rate            = 0.0f;
+
+            // -=(Undocumented)=-
+            UInt32              Capacity        = 1024;
+
+            // -=(Undocumented)=-
+            Real32              MinimumLifetime = 1.0f;
+
+            // -=(Undocumented)=-
+            Real32              MaximumLifetime = 1.0f;
+
+            // -=(Undocumented)=-
+            Vector3f            MinimumVelocity;
+
+            // -=(Undocumented)=-
+            Vector3f            MaximumVelocity;
+
+            // -=(Undocumented)=-
+            Vector3f            Gravity;
+
+            // -=(Undocumented)=-
+            Real32              Drag            = 0.0f;
+
+            // -=(Undocumented)=-
+            Vector<Key<Color>>  Colors;
+
+            // -=(Undocumented)=-
+            Vector<Key<Real32>> Sizes;
+        };
+
+        // -=(Undocumented)=-
+        struct Vertex
+        {
+            // -=(Undocumented)=-
+            Vector3f Position;
+
+            // -=(Undocumented)=-
+            Vector2f TexCoord;
+
+            // -=(Undocumented)=-
+            UInt32   Color;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        Emitter(ConstRef<Properties> Properties, UInt32 Seed);
+
+        // -=(Undocumented)=-
+        void SetPosition(ConstRef<Vector3f> Position)
+        {
+            mPosition = Position;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector3f> GetPosition() const
+        {
+            return mPosition;
+        }
+
+        // -=(Undocumented)=-
+        void SetActive(Bool Active)
+        {
+            mActive = Active;
+        }
+
+        // -=(Undocumented)=-
+        Bool IsActive() const
+        {
+            return mActive;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetCount() const
+        {
+            return mCount;
+        }
+
+        // -=(Undocumented)=-
+        void Emit(UInt32 Count)
+        {
+            mBurst += Count;
+        }
+
+        // -=(Undocumented)=-
+        void Simulate(Real32 Delta);
+
+        // -=(Undocumented)=-
+        void Write(Ptr<Vertex> Output, ConstRef<Vector3f> Right, ConstRef<Vector3f> Up) const;
+
+    private:
+
+        // -=(Undocumented)=-
+        void Integrate(Real32 Delta);
+
+        // -=(Undocumented)=-
+        void Compact();
+
+        // -=(Undocumented)=-
+        void Spawn(UInt32 Count);
+
+        // -=(Undocumented)=-
+        Real32 Random(Real32 Minimum, Real32 Maximum);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Properties               mProperties;
+        Vector3f                 mPosition;
+        Bool                     mActive;
+        Real32                   mAccumulator;
+        UInt32                   mBurst;
+        UInt32                   mSeed;
+        UInt32                   mCount;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Real32>           mPositionX;
+        Vector<Real32>           mPositionY;
+        Vector<Real32>           mPositionZ;
+        Vector<Real32>           mVelocityX;
+        Vector<Real32>           mVelocityY;
+        Vector<Real32>           mVelocityZ;
+        Vector<Real32>           mAge;
+        Vector<Real32>           mDecay;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Array<UInt32, k_Samples> mColors;
+        Array<Real32, k_Samples> mSizes;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Service.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Particle
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Service::Service(Ref<Context> Context)
+        : AbstractSubsystem(Context),
+          mSeed       { 1 },
+          mIndices    { 0 }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Service::~Service()
+    {
+        if (ConstSPtr<Graphic::Service> Graphics = GetSubsystem<Graphic::Service>(); Graphics && mIndices != 0)
+        {
+            Graphics->DeleteBuffer(mIndices);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::OnTick(Real64 Time, Real64 Delta)
+    {
+        // Drop emitters nobody else holds once they have stopped spawning and every particle has died.
+        std::erase_if(mEmitters, [](ConstSPtr<Emitter> Emitter)
+        {
+            return Emitter.use_count() == 1 && !Emitter->IsActive() && Emitter->GetCount() == 0;
+        });
+
+        const Real32 Step = static_cast<Real32>(Delta);
+
+        mScheduler.Dispatch(mEmitters.size(), [this, Step](UInt32 Index)
+        {
+            mEmitters[Index]->Simulate(Step);
+        });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Service::Initialize(UInt32 Threads)
+    {
+        if (mScheduler.GetThreads() == 0)
+        {
+            mScheduler.Initialize(Threads);
+            Log::Info("Particle - Initialized with {} threads", Threads);
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SPtr<Emitter> Service::Spawn(ConstRef<Emitter::Properties> Properties, ConstRef<Vector3f> Position)
+    {
+        mSeed = mSeed * 1664525 + 1013904223;
+
+        ConstSPtr<Emitter> Instance = NewPtr<Emitter>(Properties, mSeed);
+        Instance->SetPosition(Position);
+        mEmitters.push_back(Instance);
+        return Instance;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Despawn(ConstSPtr<Emitter> Emitter)
+    {
+        std::erase(mEmitters, Emitter);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Draw(ConstRef<Graphic::Camera> Camera)
+    {
+        UInt32 Count = 0;
+
+        for (ConstSPtr<Emitter> Emitter : mEmitters)
+        {
+            Count += Emitter->GetCount();
+        }
+        Count = Min(Count, k_MaxBillboards);
+
+        ConstSPtr<Graphic::Service> Graphics = GetSubsystem<Graphic::Service>();
+
+        if (Count == 0 || !Graphics)
+        {
+            return;
+        }
+
+        // Every billboard uses the same two triangles, so a single static index buffer serves all of them.
+        if (mIndices == 0)
+        {
+            Data Indices(k_MaxBillboards * 6 * sizeof(UInt32));
+
+            const Ptr<UInt32> Elements = Indices.GetData<UInt32>();
+
+            for (UInt32 Quad = 0; Quad < k_MaxBillboards; ++Quad)
+            {
+                const UInt32 Base = Quad * 4;
+
+                Elements[Quad * 6 + 0] = Base + 0;
+                Elements[Quad * 6 + 1] = Base + 1;
+                Elements[Quad * 6 + 2] = Base + 2;
+                Elements[Quad * 6 + 3] = Base + 0;
+                Elements[Quad * 6 + 4] = Base + 2;
+                Elements[Quad * 6 + 5] = Base + 3;
+            }
+            mIndices = Graphics->CreateBuffer(Graphic::Usage::Index, Move(Indices));
+        }
+
+        // The index buffer is large enough to go through the upload queue when a budget is set.
+        if (Graphics->IsBufferPending(mIndices))
+        {
+            return;
+        }
+
+        // Emitters write their billboards straight into the frame's transient memory, no staging copy needed.
+        const Graphic::Frame::Allocation<Emitter::Vertex> Vertices
+            = Graphics->Allocate<Emitter::Vertex>(Graphic::Usage::Vertex, Count * 4);
+
+        const Vector3f Right = Camera.GetRight();
+        const Vector3f Up    = Camera.GetUp();
+
+        UInt32 Written = 0;
+
+        for (ConstSPtr<Emitter> Emitter : mEmitters)
+        {
+            if (Written + Emitter->GetCount() <= Count)
+            {
+                Emitter->Write(Vertices.Pointer + Written * 4, Right, Up);
+                Written += Emitter->GetCount();
+            }
+        }
+
+        // Pipeline, textures and uniforms are left to the caller, just like a mesh draw.
+        Ref<Graphic::Encoder> Encoder = Graphics->GetEncoder();
+        Encoder.SetVertices(0, Vertices.Binding);
+        Encoder.SetIndices(Graphic::Binding(mIndices, sizeof(UInt32), 0));
+        Encoder.Draw(Written * 6, 0, 0);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Vector3.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=(Undocumented)=-
+    struct Bounds final
+    {
+        // -=(Undocumented)=-
+        Vector3f Minimum;
+
+        // -=(Undocumented)=-
+        Vector3f Maximum;
+
+        // -=(Undocumented)=-
+        Vector3f GetCenter() const
+        {
+            return (Minimum + Maximum) * 0.5f;
+        }
+
+        // -=(Undocumented)=-
+        Vector3f GetExtent() const
+        {
+            return (Maximum - Minimum) * 0.5f;
+        }
+
+        // -=(Undocumented)=-
+        Real32 GetArea() const
+        {
+            const Vector3f Size = Maximum - Minimum;
+            return Size.GetX() * Size.GetY() + Size.GetY() * Size.GetZ() + Size.GetZ() * Size.GetX();
+        }
+
+        // -=(Undocumented)=-
+        Bool Contains(ConstRef<Bounds> Other) const
+        {
+            return Minimum.GetX() <= Other.Minimum.GetX() && Other.Maximum.GetX() <= Maximum.GetX()
+                && Minimum.GetY() <= Other.Minimum.GetY() && Other.Maximum.GetY() <= Maximum.GetY()
+                && Minimum.GetZ() <= Other.Minimum.GetZ() && Other.Maximum.GetZ() <= Maximum.GetZ();
+        }
+
+        // -=(Undocumented)=-
+        Bool Intersects(ConstRef<Bounds> Other) const
+        {
+            return Minimum.GetX() <= Other.Maximum.GetX() && Other.Minimum.GetX() <= Maximum.GetX()
+                && Minimum.GetY() <= Other.Maximum.GetY() && Other.Minimum.GetY() <= Maximum.GetY()
+                && Minimum.GetZ() <= Other.Maximum.GetZ() && Other.Minimum.GetZ() <= Maximum.GetZ();
+        }
+
+        // -=(Undocumented)=-
+        Bool Intersects(ConstRef<Vector3f> Center, Real32 Radius) const
+        {
+            const Vector3f Closest = Vector3f::Min(Vector3f::Max(Center, Minimum), Maximum);
+            return (Closest - Center).GetLengthSquared() <= Radius * Radius;
+        }
+
+        // -=(Undocumented)=-
+        Bool Intersects(ConstRef<Vector3f> Origin, ConstRef<Vector3f> Reciprocal, Real32 Length) const
+        {
+            // Slab test against the inverse of the ray direction, an axis parallel to the ray divides by zero
+            // into an infinity that still orders the two slab distances correctly.
+            const Vector3f Near = (Minimum - Origin) * Reciprocal;
+            const Vector3f Far  = (Maximum - Origin) * Reciprocal;
+
+            const Vector3f Enter = Vector3f::Min(Near, Far);
+            const Vector3f Leave = Vector3f::Max(Near, Far);
+
+            const Real32 Begin = Max(Max(Enter.GetX(), Enter.GetY()), Max(Enter.GetZ(), 0.0f));
+            const Real32 End   = Min(Min(Leave.GetX(), Leave.GetY()), Min(Leave.GetZ(), Length));
+            return Begin <= End;
+        }
+
+        // -=(Undocumented)=-
+        static Bounds Merge(ConstRef<Bounds> First, ConstRef<Bounds> Second)
+        {
+            const Vector3f Minimum = Vector3f::Min(First.Minimum, Second.Minimum);
+            const Vector3f Maximum = Vector3f::Max(First.Maximum, Second.Maximum);
+            return Bounds { Minimum, Maximum };
+        }
+
+        // -=(Undocumented)=-
+        static Bounds Enlarge(ConstRef<Bounds> Source, Real32 Margin)
+        {
+            return Bounds { Source.Minimum - Margin, Source.Maximum + Margin };
+        }
+    };
+}
\ No newline at end of file
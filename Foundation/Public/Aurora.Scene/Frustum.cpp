@@ -0,0 +1,83 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Frustum.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Frustum::Frustum(ConstRef<Matrix4f> ViewProjection)
+    {
+        // Extract each plane from the rows of the matrix the same way the camera does, normalized so that the
+        // sphere test can compare distances against the radius directly.
+        for (UInt32 Plane = 0; Plane < 6; ++Plane)
+        {
+            const UInt32 Row  = Plane >> 1;
+            const Real32 Sign = (Plane & 1 ? -1.0f : 1.0f);
+
+            const Real32 A = ViewProjection.GetComponent(3)  + Sign * ViewProjection.GetComponent(Row);
+            const Real32 B = ViewProjection.GetComponent(7)  + Sign * ViewProjection.GetComponent(Row + 4);
+            const Real32 C = ViewProjection.GetComponent(11) + Sign * ViewProjection.GetComponent(Row + 8);
+            const Real32 D = ViewProjection.GetComponent(15) + Sign * ViewProjection.GetComponent(Row + 12);
+
+            const Real32 Length = Vector3f(A, B, C).GetLength();
+            const Real32 Scale  = (Length > 0.0f ? 1.0f / Length : 0.0f);
+
+            mPlanes[Plane] = Vector4f(A * Scale, B * Scale, C * Scale, D * Scale);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Frustum::Intersects(ConstRef<Bounds> Bounds) const
+    {
+        for (ConstRef<Vector4f> Plane : mPlanes)
+        {
+            const Real32 X = (Plane.GetX() >= 0.0f ? Bounds.Maximum.GetX() : Bounds.Minimum.GetX());
+            const Real32 Y = (Plane.GetY() >= 0.0f ? Bounds.Maximum.GetY() : Bounds.Minimum.GetY());
+            const Real32 Z = (Plane.GetZ() >= 0.0f ? Bounds.Maximum.GetZ() : Bounds.Minimum.GetZ());
+
+            if (Plane.GetX() * X + Plane.GetY() * Y + Plane.GetZ() * Z + Plane.GetW() < 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Frustum::Intersects(ConstRef<Vector3f> Center, Real32 Radius) const
+    {
+        for (ConstRef<Vector4f> Plane : mPlanes)
+        {
+            const Real32 Distance = Plane.GetX() * Center.GetX()
+                                  + Plane.GetY() * Center.GetY()
+                                  + Plane.GetZ() * Center.GetZ()
+                                  + Plane.GetW();
+
+            if (Distance < -Radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,310 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Grid.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static constexpr SInt32 k_Limit = (1 << 20) - 1;
+    static constexpr UInt64 k_Mask  = 0x1FFFFF;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt64 Pack(SInt32 X, SInt32 Y, SInt32 Z)
+    {
+        const UInt64 Row    = static_cast<UInt64>(X) & k_Mask;
+        const UInt64 Column = static_cast<UInt64>(Y) & k_Mask;
+        const UInt64 Layer  = static_cast<UInt64>(Z) & k_Mask;
+        return (Row << 42) | (Column << 21) | Layer;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static SInt32 Unpack(UInt64 Key, UInt32 Shift)
+    {
+        // Sign extend the 21 bits coordinate back.
+        const SInt32 Value = static_cast<SInt32>((Key >> Shift) & k_Mask);
+        return (Value ^ (k_Limit + 1)) - (k_Limit + 1);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Grid::Grid(Real32 Size)
+        : mSize       { Size },
+          mReciprocal { 1.0f / Size }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Grid::Proxy Grid::Insert(ConstRef<Bounds> Bounds, UInt32 Data)
+    {
+        Proxy Proxy;
+
+        if (mFree.empty())
+        {
+            Proxy = mItems.size();
+            mItems.emplace_back();
+        }
+        else
+        {
+            Proxy = mFree.back();
+            mFree.pop_back();
+        }
+
+        Ref<Item> Item = mItems[Proxy];
+        Item.Bounds = Bounds;
+        Item.Data   = Data;
+        Item.Cell   = GetCell(Bounds);
+
+        Link(Proxy);
+        return Proxy;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Grid::Remove(Proxy Proxy)
+    {
+        Unlink(Proxy);
+        mFree.push_back(Proxy);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Grid::Update(Proxy Proxy, ConstRef<Bounds> Bounds)
+    {
+        const UInt64 Cell = GetCell(Bounds);
+
+        // Moving inside of the same cell, which is the common case for small objects, only touches the item.
+        if (mItems[Proxy].Cell != Cell)
+        {
+            Unlink(Proxy);
+            mItems[Proxy].Cell = Cell;
+            Link(Proxy);
+        }
+        mItems[Proxy].Bounds = Bounds;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Grid::Query(ConstRef<Bounds> Bounds, Ref<Vector<UInt32>> Result) const
+    {
+        Traverse(Bounds, [&](ConstRef<Scene::Bounds> Item)
+        {
+            return Item.Intersects(Bounds);
+        }, Result);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Grid::Query(ConstRef<Frustum> Frustum, Ref<Vector<UInt32>> Result) const
+    {
+        const auto Filter = [&](ConstRef<Bounds> Item)
+        {
+            return Frustum.Intersects(Item);
+        };
+
+        Collect(mOverflow, Filter, Result);
+
+        // A frustum has no useful cell range, so test the loose box of every occupied cell instead.
+        const Real32 Margin = mSize * 0.5f;
+
+        for (const auto & [Key, Items] : mCells)
+        {
+            const Vector3f Corner(Unpack(Key, 42) * mSize, Unpack(Key, 21) * mSize, Unpack(Key, 0) * mSize);
+
+            if (Frustum.Intersects(Bounds { Corner - Margin, Corner + mSize + Margin }))
+            {
+                Collect(Items, Filter, Result);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Grid::Query(ConstRef<Vector3f> Center, Real32 Radius, Ref<Vector<UInt32>> Result) const
+    {
+        Traverse(Bounds { Center - Radius, Center + Radius }, [&](ConstRef<Bounds> Item)
+        {
+            return Item.Intersects(Center, Radius);
+        }, Result);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Grid::Query(
+        ConstRef<Vector3f> Origin, ConstRef<Vector3f> Direction, Real32 Length, Ref<Vector<UInt32>> Result) const
+    {
+        const Vector3f Reciprocal(1.0f / Direction.GetX(), 1.0f / Direction.GetY(), 1.0f / Direction.GetZ());
+        const Vector3f End = Origin + Direction * Length;
+
+        Traverse(Bounds { Vector3f::Min(Origin, End), Vector3f::Max(Origin, End) }, [&](ConstRef<Bounds> Item)
+        {
+            return Item.Intersects(Origin, Reciprocal, Length);
+        }, Result);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SInt32 Grid::GetCoordinate(Real32 Value) const
+    {
+        constexpr Real32 k_Range = static_cast<Real32>(k_Limit);
+
+        return static_cast<SInt32>(Clamp(std::floor(Value * mReciprocal), -k_Range, k_Range));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt64 Grid::GetCell(ConstRef<Bounds> Bounds) const
+    {
+        // Items are bucketed by their center only, which is what makes the grid loose: as long as no half extent
+        // goes over half of a cell, every item is fully inside of its cell grown by that much on each side. The
+        // few items that are larger than that are kept aside and tested on every query.
+        const Vector3f Extent = Bounds.GetExtent();
+        const Real32   Limit  = mSize * 0.5f;
+
+        if (Extent.GetX() > Limit || Extent.GetY() > Limit || Extent.GetZ() > Limit)
+        {
+            return k_Overflow;
+        }
+
+        const Vector3f Center = Bounds.GetCenter();
+        return Pack(GetCoordinate(Center.GetX()), GetCoordinate(Center.GetY()), GetCoordinate(Center.GetZ()));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Ref<Vector<Grid::Proxy>> Grid::GetList(UInt64 Cell)
+    {
+        return (Cell == k_Overflow ? mOverflow : mCells[Cell]);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Grid::Link(Proxy Proxy)
+    {
+        Ref<Item>                Item = mItems[Proxy];
+        Ref<Vector<Grid::Proxy>> List = GetList(Item.Cell);
+
+        Item.Slot = List.size();
+        List.push_back(Proxy);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Grid::Unlink(Proxy Proxy)
+    {
+        ConstRef<Item>           Item = mItems[Proxy];
+        Ref<Vector<Grid::Proxy>> List = GetList(Item.Cell);
+
+        const Grid::Proxy Last = List.back();
+        List[Item.Slot]    = Last;
+        mItems[Last].Slot  = Item.Slot;
+        List.pop_back();
+
+        if (List.empty() && Item.Cell != k_Overflow)
+        {
+            mCells.erase(Item.Cell);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Filter>
+    void Grid::Traverse(ConstRef<Bounds> Region, Any<Filter> Predicate, Ref<Vector<UInt32>> Result) const
+    {
+        Collect(mOverflow, Predicate, Result);
+
+        // Grow the region by the looseness of the cells, any item overlapping it has its center in there.
+        const Real32 Margin = mSize * 0.5f;
+
+        const SInt32 X0 = GetCoordinate(Region.Minimum.GetX() - Margin);
+        const SInt32 Y0 = GetCoordinate(Region.Minimum.GetY() - Margin);
+        const SInt32 Z0 = GetCoordinate(Region.Minimum.GetZ() - Margin);
+        const SInt32 X1 = GetCoordinate(Region.Maximum.GetX() + Margin);
+        const SInt32 Y1 = GetCoordinate(Region.Maximum.GetY() + Margin);
+        const SInt32 Z1 = GetCoordinate(Region.Maximum.GetZ() + Margin);
+
+        const UInt64 Range = static_cast<UInt64>(X1 - X0 + 1) * (Y1 - Y0 + 1) * (Z1 - Z0 + 1);
+
+        // Walking the occupied cells is cheaper than probing the table once the region spans more cells than
+        // there are in it, which also keeps huge queries from degenerating.
+        if (Range > mCells.size())
+        {
+            for (const auto & [Key, Items] : mCells)
+            {
+                const SInt32 X = Unpack(Key, 42);
+                const SInt32 Y = Unpack(Key, 21);
+                const SInt32 Z = Unpack(Key, 0);
+
+                if (X >= X0 && X <= X1 && Y >= Y0 && Y <= Y1 && Z >= Z0 && Z <= Z1)
+                {
+                    Collect(Items, Predicate, Result);
+                }
+            }
+        }
+        else
+        {
+            for (SInt32 Z = Z0; Z <= Z1; ++Z)
+            {
+                for (SInt32 Y = Y0; Y <= Y1; ++Y)
+                {
+                    for (SInt32 X = X0; X <= X1; ++X)
+                    {
+                        if (const auto Iterator = mCells.find(Pack(X, Y, Z)); Iterator != mCells.end())
+                        {
+                            Collect(Iterator->second, Predicate, Result);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Filter>
+    void Grid::Collect(CPtr<const Proxy> Items, Any<Filter> Predicate, Ref<Vector<UInt32>> Result) const
+    {
+        for (const Proxy Proxy : Items)
+        {
+            if (ConstRef<Item> Item = mItems[Proxy]; Predicate(Item.Bounds))
+            {
+                Result.push_back(Item.Data);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Frustum.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=(Undocumented)=-
+    class Grid final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        using Proxy = UInt32;
+
+        // -=(Undocumented)=-
+        static constexpr Proxy k_Invalid = UINT32_MAX;
+
+    public:
+
+        // -=(Undocumented)=-
+        explicit Grid(Real32 Size);
+
+        // -=(Undocumented)=-
+        Proxy Insert(ConstRef<Bounds> Bounds, UInt32 Data);
+
+        // -=(Undocumented)=-
+        void Remove(Proxy Proxy);
+
+        // -=(Undocumented)=-
+        void Update(Proxy Proxy, ConstRef<Bounds> Bounds);
+
+        // -=(Undocumented)=-
+        UInt32 GetData(Proxy Proxy) const
+        {
+            return mItems[Proxy].Data;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Bounds> GetBounds(Proxy Proxy) const
+        {
+            return mItems[Proxy].Bounds;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetCount() const
+        {
+            return mItems.size() - mFree.size();
+        }
+
+        // -=(Undocumented)=-
+        void Query(ConstRef<Bounds> Bounds, Ref<Vector<UInt32>> Result) const;
+
+        // -=(Undocumented)=-
+        void Query(ConstRef<Frustum> Frustum, Ref<Vector<UInt32>> Result) const;
+
+        // -=(Undocumented)=-
+        void Query(ConstRef<Vector3f> Center, Real32 Radius, Ref<Vector<UInt32>> Result) const;
+
+        // -=(Undocumented)=-
+        void Query(
+            ConstRef<Vector3f> Origin, ConstRef<Vector3f> Direction, Real32 Length, Ref<Vector<UInt32>> Result) const;
+
+    private:
+
+        // -=(Undocumented)=-
+        static constexpr UInt64 k_Overflow = UINT64_MAX;
+
+        // -=(Undocumented)=-
+        struct Item
+        {
+            // -=(Undocumented)=-
+            Scene::Bounds Bounds;
+
+            // -=(Undocumented)=-
+            UInt32        Data;
+
+            // -=(Undocumented)=-
+            UInt64        Cell;
+
+            // -=(Undocumented)=-
+            UInt32        Slot;
+        };
+
+        // -=(Undocumented)=-
+        SInt32 GetCoordinate(Real32 Value) const;
+
+        // -=(Undocumented)=-
+        UInt64 GetCell(ConstRef<Bounds> Bounds) const;
+
+        // -=(Undocumented)=-
+        Ref<Vector<Proxy>> GetList(UInt64 Cell);
+
+        // -=(Undocumented)=-
+        void Link(Proxy Proxy);
+
+        // -=(Undocumented)=-
+        void Unlink(Proxy Proxy);
+
+        // -=(Undocumented)=-
+        template<typename Filter>
+        void Traverse(ConstRef<Bounds> Region, Any<Filter> Predicate, Ref<Vector<UInt32>> Result) const;
+
+        // -=(Undocumented)=-
+        template<typename Filter>
+        void Collect(CPtr<const Proxy> Items, Any<Filter> Predicate, Ref<Vector<UInt32>> Result) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Real32                       mSize;
+        Real32                       mReciprocal;
+        Vector<Item>                 mItems;
+        Vector<Proxy>                mFree;
+        Table<UInt64, Vector<Proxy>> mCells;
+        Vector<Proxy>                mOverflow;
+    };
+}
\ No newline at end of file
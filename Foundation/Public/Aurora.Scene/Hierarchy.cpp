@@ -0,0 +1,281 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Hierarchy.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Type>
+    static void Permute(Ref<Vector<Type>> Stream, CPtr<const UInt32> Order)
+    {
+        Vector<Type> Result;
+        Result.reserve(Order.size());
+
+        for (const UInt32 Slot : Order)
+        {
+            Result.push_back(Stream[Slot]);
+        }
+        Stream = Move(Result);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Hierarchy::Hierarchy()
+        : mOutdated { false }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Hierarchy::Node Hierarchy::Create(Node Parent, ConstRef<Transformf> Local)
+    {
+        Node Handle;
+
+        if (mFree.empty())
+        {
+            Handle = mSlots.size();
+            mSlots.push_back(0);
+        }
+        else
+        {
+            Handle = mFree.back();
+            mFree.pop_back();
+        }
+
+        // New nodes are appended, which keeps them after their parent; the arrays get regrouped by root on
+        // the next Prepare so that every subtree ends up contiguous again.
+        mSlots[Handle] = mHandles.size();
+        mHandles.push_back(Handle);
+        mParent.push_back(Parent);
+        mParentSlot.push_back(Parent != k_Invalid ? mSlots[Parent] : k_Invalid);
+        mLocal.push_back(Local);
+        mWorld.emplace_back();
+        mAlive.push_back(true);
+        mDirty.push_back(true);
+        mChanged.push_back(true);
+
+        mOutdated = true;
+        return Handle;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Hierarchy::Destroy(Node Node)
+    {
+        // Descendants are released along with the node the next time the arrays are rebuilt.
+        mAlive[mSlots[Node]] = false;
+        mOutdated = true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Hierarchy::SetParent(Node Node, Node Parent)
+    {
+        // Handles released by a rebuild no longer map to a slot, the walk stops at the first one it meets.
+        const auto IsValid = [this](Hierarchy::Node Handle)
+        {
+            return Handle < mSlots.size() && mSlots[Handle] != k_Invalid;
+        };
+
+        if (!IsValid(Node) || (Parent != k_Invalid && !IsValid(Parent)))
+        {
+            Log::Warn("Hierarchy: Cannot attach a node that was released");
+            return false;
+        }
+
+        for (Hierarchy::Node Ancestor = Parent; IsValid(Ancestor); Ancestor = mParent[mSlots[Ancestor]])
+        {
+            if (Ancestor == Node)
+            {
+                Log::Warn("Hierarchy: Cannot attach a node to one of its descendants");
+                return false;
+            }
+        }
+
+        const UInt32 Slot = mSlots[Node];
+        mParent[Slot]     = Parent;
+        mParentSlot[Slot] = (Parent != k_Invalid ? mSlots[Parent] : k_Invalid);
+        mDirty[Slot]      = true;
+
+        mOutdated = true;
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Hierarchy::Prepare()
+    {
+        if (mOutdated)
+        {
+            Rebuild();
+            mOutdated = false;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Hierarchy::Update(ConstRef<Partition> Partition)
+    {
+        // Parents always precede their children, so a single forward pass sees the final world matrix of
+        // the parent before any child needs it. Static nodes cost a couple of byte loads each.
+        for (UInt32 Slot = Partition.Begin; Slot < Partition.End; ++Slot)
+        {
+            const UInt32 Parent  = mParentSlot[Slot];
+            const Bool   Changed = mDirty[Slot] || (Parent != k_Invalid && mChanged[Parent]);
+
+            mChanged[Slot] = Changed;
+
+            if (Changed)
+            {
+                const Matrix4f Local = mLocal[Slot].Compute();
+
+                mWorld[Slot] = (Parent != k_Invalid ? mWorld[Parent] * Local : Local);
+                mDirty[Slot] = false;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Hierarchy::Update()
+    {
+        Prepare();
+
+        for (ConstRef<Partition> Partition : mPartitions)
+        {
+            Update(Partition);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Hierarchy::Rebuild()
+    {
+        const UInt32 Count = mHandles.size();
+
+        // Bucket the children of every node with a counting pass, so the traversal below is linear.
+        Vector<UInt32> Offsets(Count + 1, 0);
+        Vector<UInt32> Children(Count);
+
+        for (UInt32 Slot = 0; Slot < Count; ++Slot)
+        {
+            if (mParentSlot[Slot] != k_Invalid)
+            {
+                ++Offsets[mParentSlot[Slot] + 1];
+            }
+        }
+
+        for (UInt32 Slot = 0; Slot < Count; ++Slot)
+        {
+            Offsets[Slot + 1] += Offsets[Slot];
+        }
+
+        Vector<UInt32> Cursors(Offsets.begin(), Offsets.end() - 1);
+
+        for (UInt32 Slot = 0; Slot < Count; ++Slot)
+        {
+            if (mParentSlot[Slot] != k_Invalid)
+            {
+                Children[Cursors[mParentSlot[Slot]]++] = Slot;
+            }
+        }
+
+        // Walk every root breadth-first, which lays each subtree out contiguously and sorted by depth. Small
+        // trees are merged into the same partition so that workers get a meaningful amount of work each.
+        Vector<UInt32> Order;
+        Order.reserve(Count);
+
+        mPartitions.clear();
+
+        for (UInt32 Root = 0; Root < Count; ++Root)
+        {
+            if (mParentSlot[Root] != k_Invalid || !mAlive[Root])
+            {
+                continue;
+            }
+
+            const UInt32 Begin = Order.size();
+            Order.push_back(Root);
+
+            for (UInt32 Head = Begin; Head < Order.size(); ++Head)
+            {
+                const UInt32 Parent = Order[Head];
+
+                for (UInt32 Child = Offsets[Parent]; Child < Offsets[Parent + 1]; ++Child)
+                {
+                    if (mAlive[Children[Child]])
+                    {
+                        Order.push_back(Children[Child]);
+                    }
+                }
+            }
+
+            if (mPartitions.empty() || mPartitions.back().End - mPartitions.back().Begin >= k_Grain)
+            {
+                mPartitions.push_back({ Begin, Begin });
+            }
+            mPartitions.back().End = Order.size();
+        }
+
+        // Nodes that were not reached belong to a destroyed subtree, release their handles.
+        Vector<UInt8> Reached(Count, false);
+
+        for (const UInt32 Slot : Order)
+        {
+            Reached[Slot] = true;
+        }
+
+        for (UInt32 Slot = 0; Slot < Count; ++Slot)
+        {
+            if (!Reached[Slot])
+            {
+                mSlots[mHandles[Slot]] = k_Invalid;
+                mFree.push_back(mHandles[Slot]);
+            }
+        }
+
+        Permute(mHandles, Order);
+        Permute(mParent, Order);
+        Permute(mLocal, Order);
+        Permute(mWorld, Order);
+        Permute(mAlive, Order);
+        Permute(mDirty, Order);
+        Permute(mChanged, Order);
+
+        for (UInt32 Slot = 0; Slot < Order.size(); ++Slot)
+        {
+            mSlots[mHandles[Slot]] = Slot;
+        }
+
+        mParentSlot.resize(Order.size());
+
+        for (UInt32 Slot = 0; Slot < Order.size(); ++Slot)
+        {
+            mParentSlot[Slot] = (mParent[Slot] != k_Invalid ? mSlots[mParent[Slot]] : k_Invalid);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Transform.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=(Undocumented)=-
+    class Hierarchy final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        using Node = UInt32;
+
+        // -=(Undocumented)=-
+        static constexpr Node   k_Invalid = UINT32_MAX;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Grain   = 1024;
+
+        // -=(Undocumented)=-
+        struct Partition
+        {
+            // -=(Undocumented)=-
+            UInt32 Begin = 0;
+
+            // -=(Undocumented)=-
+            UInt32 End   = 0;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        Hierarchy();
+
+        // -=(Undocumented)=-
+        Node Create(Node Parent = k_Invalid, ConstRef<Transformf> Local = Transformf());
+
+        // -=(Undocumented)=-
+        void Destroy(Node Node);
+
+        // -=(Undocumented)=-
+        Bool SetParent(Node Node, Node Parent);
+
+        // -=(Undocumented)=-
+        Node GetParent(Node Node) const
+        {
+            return mParent[mSlots[Node]];
+        }
+
+        // -=(Undocumented)=-
+        void SetLocal(Node Node, ConstRef<Transformf> Local)
+        {
+            const UInt32 Slot = mSlots[Node];
+            mLocal[Slot] = Local;
+            mDirty[Slot] = true;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Transformf> GetLocal(Node Node) const
+        {
+            return mLocal[mSlots[Node]];
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Matrix4f> GetWorld(Node Node) const
+        {
+            return mWorld[mSlots[Node]];
+        }
+
+        // -=(Undocumented)=-
+        Bool HasChanged(Node Node) const
+        {
+            return mChanged[mSlots[Node]];
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetCount() const
+        {
+            return mHandles.size();
+        }
+
+        // -=(Undocumented)=-
+        void Prepare();
+
+        // -=(Undocumented)=-
+        CPtr<const Partition> GetPartitions() const
+        {
+            return mPartitions;
+        }
+
+        // -=(Undocumented)=-
+        void Update(ConstRef<Partition> Partition);
+
+        // -=(Undocumented)=-
+        void Update();
+
+    private:
+
+        // -=(Undocumented)=-
+        void Rebuild();
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<UInt32>     mSlots;
+        Vector<Node>       mFree;
+        Bool               mOutdated;
+        Vector<Partition>  mPartitions;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Node>       mHandles;
+        Vector<Node>       mParent;
+        Vector<UInt32>     mParentSlot;
+        Vector<Transformf> mLocal;
+        Vector<Matrix4f>   mWorld;
+        Vector<UInt8>      mAlive;
+        Vector<UInt8>      mDirty;
+        Vector<UInt8>      mChanged;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,373 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Occlusion.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static constexpr Real32 k_Near    = 1.0e-4f;
+    static constexpr Real32 k_Epsilon = 1.0e-6f;
+    static constexpr Real32 k_Far     = std::numeric_limits<Real32>::max();
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Occlusion::Occlusion(UInt32 Width, UInt32 Height)
+        : mWidth   { static_cast<UInt32>(Align(Max(Width, 1u), k_TileWidth)) },
+          mHeight  { static_cast<UInt32>(Align(Max(Height, 1u), k_TileHeight)) },
+          mColumns { mWidth / k_TileWidth }
+    {
+        mBins.resize(mColumns * (mHeight / k_TileHeight));
+
+        // Each level of the pyramid halves the previous one (rounding up, so odd edges are never dropped) and
+        // keeps the farthest depth of the texels below it, down to a single texel.
+        Level Root { mWidth, mHeight };
+        Root.Depth.resize(mWidth * mHeight, k_Far);
+        mLevels.emplace_back(Move(Root));
+
+        while (mLevels.back().Width > 1 || mLevels.back().Height > 1)
+        {
+            Level Next { (mLevels.back().Width + 1) >> 1, (mLevels.back().Height + 1) >> 1 };
+            Next.Depth.resize(Next.Width * Next.Height, k_Far);
+            mLevels.emplace_back(Move(Next));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Occlusion::Begin(ConstRef<Matrix4f> ViewProjection)
+    {
+        mViewProjection = ViewProjection;
+        mTriangles.clear();
+
+        for (Ref<Vector<UInt32>> Bin : mBins)
+        {
+            Bin.clear();
+        }
+
+        std::fill(mLevels[0].Depth.begin(), mLevels[0].Depth.end(), k_Far);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Occlusion::Rasterize(UInt32 Tile)
+    {
+        const UInt32 TileX = (Tile % mColumns) * k_TileWidth;
+        const UInt32 TileY = (Tile / mColumns) * k_TileHeight;
+
+        const Ptr<Real32> Buffer = mLevels[0].Depth.data();
+
+        for (const UInt32 Index : mBins[Tile])
+        {
+            ConstRef<Triangle> Primitive = mTriangles[Index];
+
+            // Spans start on a four pixel boundary so every block stays inside the tile, the pixels of the
+            // block that fall outside of the triangle are rejected by the edge functions anyway.
+            const UInt32 MinX = Max(Primitive.MinX, TileX) & ~3u;
+            const UInt32 MaxX = Min(Primitive.MaxX, TileX + k_TileWidth - 1);
+            const UInt32 MinY = Max(Primitive.MinY, TileY);
+            const UInt32 MaxY = Min(Primitive.MaxY, TileY + k_TileHeight - 1);
+
+#ifdef    AURORA_SIMD
+            const SIMD::Register Lane = SIMD::Set(0.0f, 1.0f, 2.0f, 3.0f);
+            const SIMD::Register Zero = SIMD::Splat(0.0f);
+
+            SIMD::Register Slope[4];
+            SIMD::Register Step[4];
+
+            for (UInt32 Plane = 0; Plane < 4; ++Plane)
+            {
+                Slope[Plane] = SIMD::Mul(Lane, SIMD::Splat(Primitive.Plane[Plane][0]));
+                Step[Plane]  = SIMD::Splat(Primitive.Plane[Plane][0] * 4.0f);
+            }
+
+            for (UInt32 Y = MinY; Y <= MaxY; ++Y)
+            {
+                const Ptr<Real32> Span = Buffer + Y * mWidth;
+
+                // The first three planes are the edge functions and the last one is the depth, all of them are
+                // evaluated for four pixels at once and stepped along the span.
+                SIMD::Register Value[4];
+
+                for (UInt32 Plane = 0; Plane < 4; ++Plane)
+                {
+                    ConstPtr<Real32> Coefficients = Primitive.Plane[Plane];
+                    Value[Plane] = SIMD::Add(Slope[Plane], SIMD::Splat(
+                        Coefficients[0] * MinX + Coefficients[1] * Y + Coefficients[2]));
+                }
+
+                for (UInt32 X = MinX; X <= MaxX; X += 4)
+                {
+                    const SIMD::Register Inside = SIMD::And(
+                        SIMD::GreaterEqual(Value[0], Zero), SIMD::GreaterEqual(Value[1], Zero));
+                    const SIMD::Register Mask   = SIMD::And(Inside, SIMD::GreaterEqual(Value[2], Zero));
+
+                    if (SIMD::Any(Mask))
+                    {
+                        const SIMD::Register Previous = SIMD::Load(Span + X);
+                        SIMD::Store(Span + X, SIMD::Select(Mask, SIMD::Min(Previous, Value[3]), Previous));
+                    }
+
+                    for (UInt32 Plane = 0; Plane < 4; ++Plane)
+                    {
+                        Value[Plane] = SIMD::Add(Value[Plane], Step[Plane]);
+                    }
+                }
+            }
+#else
+            for (UInt32 Y = MinY; Y <= MaxY; ++Y)
+            {
+                const Ptr<Real32> Span = Buffer + Y * mWidth;
+
+                for (UInt32 X = MinX; X <= MaxX; ++X)
+                {
+                    Real32 Value[4];
+
+                    for (UInt32 Plane = 0; Plane < 4; ++Plane)
+                    {
+                        ConstPtr<Real32> Coefficients = Primitive.Plane[Plane];
+                        Value[Plane] = Coefficients[0] * X + Coefficients[1] * Y + Coefficients[2];
+                    }
+
+                    if (Value[0] >= 0.0f && Value[1] >= 0.0f && Value[2] >= 0.0f)
+                    {
+                        Span[X] = Min(Span[X], Value[3]);
+                    }
+                }
+            }
+#endif // AURORA_SIMD
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Occlusion::Rasterize()
+    {
+        for (UInt32 Tile = 0; Tile < mBins.size(); ++Tile)
+        {
+            Rasterize(Tile);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Occlusion::End()
+    {
+        for (UInt32 Index = 1; Index < mLevels.size(); ++Index)
+        {
+            ConstRef<Level> Source      = mLevels[Index - 1];
+            Ref<Level>      Destination = mLevels[Index];
+
+            for (UInt32 Y = 0; Y < Destination.Height; ++Y)
+            {
+                const UInt32 Top    = (Y << 1);
+                const UInt32 Bottom = Min(Top + 1, Source.Height - 1);
+
+                for (UInt32 X = 0; X < Destination.Width; ++X)
+                {
+                    const UInt32 Left  = (X << 1);
+                    const UInt32 Right = Min(Left + 1, Source.Width - 1);
+
+                    const Real32 Upper = Max(Source.Depth[Top    * Source.Width + Left],
+                                             Source.Depth[Top    * Source.Width + Right]);
+                    const Real32 Lower = Max(Source.Depth[Bottom * Source.Width + Left],
+                                             Source.Depth[Bottom * Source.Width + Right]);
+
+                    Destination.Depth[Y * Destination.Width + X] = Max(Upper, Lower);
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Occlusion::IsVisible(ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum) const
+    {
+        Real32 MinX  = k_Far;
+        Real32 MinY  = k_Far;
+        Real32 MaxX  = -k_Far;
+        Real32 MaxY  = -k_Far;
+        Real32 Depth = k_Far;
+
+        for (UInt32 Corner = 0; Corner < 8; ++Corner)
+        {
+            const Vector4f Point = mViewProjection * Vector4f(
+                Corner & 1 ? Maximum.GetX() : Minimum.GetX(),
+                Corner & 2 ? Maximum.GetY() : Minimum.GetY(),
+                Corner & 4 ? Maximum.GetZ() : Minimum.GetZ(),
+                1.0f);
+
+            // A box that crosses the near plane has no meaningful screen footprint, it can't be rejected.
+            if (Point.GetW() < k_Near)
+            {
+                return true;
+            }
+
+            const Real32 Reciprocal = 1.0f / Point.GetW();
+            const Real32 X = (Point.GetX() * Reciprocal * 0.5f + 0.5f) * mWidth;
+            const Real32 Y = (0.5f - Point.GetY() * Reciprocal * 0.5f) * mHeight;
+
+            MinX  = Min(MinX, X);
+            MinY  = Min(MinY, Y);
+            MaxX  = Max(MaxX, X);
+            MaxY  = Max(MaxY, Y);
+            Depth = Min(Depth, Point.GetZ() * Reciprocal);
+        }
+
+        if (MaxX < 0.0f || MaxY < 0.0f || MinX >= mWidth || MinY >= mHeight)
+        {
+            return false;
+        }
+
+        // Clamp while still in floating point, converting an out of range value to an integer is undefined.
+        const Real32 LimitX = static_cast<Real32>(mWidth - 1);
+        const Real32 LimitY = static_cast<Real32>(mHeight - 1);
+
+        const UInt32 X0 = static_cast<UInt32>(Clamp(MinX, 0.0f, LimitX));
+        const UInt32 Y0 = static_cast<UInt32>(Clamp(MinY, 0.0f, LimitY));
+        const UInt32 X1 = static_cast<UInt32>(Clamp(MaxX, 0.0f, LimitX));
+        const UInt32 Y1 = static_cast<UInt32>(Clamp(MaxY, 0.0f, LimitY));
+
+        // Pick the coarsest level needed for the footprint to span no more than two texels on each axis, which
+        // bounds the test to a 3x3 block regardless of how large the box is on screen.
+        const UInt32 Extent = Max(X1 - X0, Y1 - Y0);
+        UInt32       Index  = 0;
+
+        while (Index + 1 < mLevels.size() && (Extent >> Index) > 1)
+        {
+            ++Index;
+        }
+
+        ConstRef<Level> Target = mLevels[Index];
+
+        for (UInt32 Y = (Y0 >> Index); Y <= (Y1 >> Index); ++Y)
+        {
+            for (UInt32 X = (X0 >> Index); X <= (X1 >> Index); ++X)
+            {
+                if (Depth <= Target.Depth[Y * Target.Width + X])
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Occlusion::Bin(ConstRef<Vector4f> V0, ConstRef<Vector4f> V1, ConstRef<Vector4f> V2)
+    {
+        // Occluders are never clipped, a triangle that crosses the near plane is dropped instead which can only
+        // make the buffer less occluding and never hides anything that is actually visible.
+        if (V0.GetW() < k_Near || V1.GetW() < k_Near || V2.GetW() < k_Near)
+        {
+            return;
+        }
+
+        Real32 X[3], Y[3], Z[3];
+
+        const Ptr<const Vector4f> Vertices[3] = { &V0, &V1, &V2 };
+
+        for (UInt32 Vertex = 0; Vertex < 3; ++Vertex)
+        {
+            const Real32 Reciprocal = 1.0f / Vertices[Vertex]->GetW();
+            X[Vertex] = (Vertices[Vertex]->GetX() * Reciprocal * 0.5f + 0.5f) * mWidth;
+            Y[Vertex] = (0.5f - Vertices[Vertex]->GetY() * Reciprocal * 0.5f) * mHeight;
+            Z[Vertex] = Vertices[Vertex]->GetZ() * Reciprocal;
+        }
+
+        // Occluders are two sided, so flip the winding of back facing triangle(s) instead of culling them.
+        Real32 Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (Y[1] - Y[0]) * (X[2] - X[0]);
+
+        if (Area < 0.0f)
+        {
+            std::swap(X[1], X[2]);
+            std::swap(Y[1], Y[2]);
+            std::swap(Z[1], Z[2]);
+            Area = -Area;
+        }
+
+        if (Area < k_Epsilon)
+        {
+            return;
+        }
+
+        const Real32 Left   = Min(X[0], Min(X[1], X[2]));
+        const Real32 Top    = Min(Y[0], Min(Y[1], Y[2]));
+        const Real32 Right  = Max(X[0], Max(X[1], X[2]));
+        const Real32 Bottom = Max(Y[0], Max(Y[1], Y[2]));
+
+        if (Right < 0.0f || Bottom < 0.0f || Left >= mWidth || Top >= mHeight)
+        {
+            return;
+        }
+
+        const Real32 LimitX = static_cast<Real32>(mWidth - 1);
+        const Real32 LimitY = static_cast<Real32>(mHeight - 1);
+
+        Triangle Primitive;
+        Primitive.MinX = static_cast<UInt32>(Clamp(Left, 0.0f, LimitX));
+        Primitive.MinY = static_cast<UInt32>(Clamp(Top, 0.0f, LimitY));
+        Primitive.MaxX = static_cast<UInt32>(Clamp(Right, 0.0f, LimitX));
+        Primitive.MaxY = static_cast<UInt32>(Clamp(Bottom, 0.0f, LimitY));
+
+        // Edge functions are set up so that edge N is opposite to vertex N, which makes each of them the
+        // (scaled) barycentric weight of that vertex and lets the depth plane be built out of them; sampling
+        // is done at pixel centers, so the half pixel offset is folded into the constant term.
+        const Real32 Reciprocal = 1.0f / Area;
+
+        Ref<Real32[3]> Depth = Primitive.Plane[3];
+        Depth[0] = Depth[1] = Depth[2] = 0.0f;
+
+        for (UInt32 Edge = 0; Edge < 3; ++Edge)
+        {
+            const UInt32 First  = (Edge + 1) % 3;
+            const UInt32 Second = (Edge + 2) % 3;
+
+            const Real32 A = Y[First] - Y[Second];
+            const Real32 B = X[Second] - X[First];
+            const Real32 C = -(A * X[First] + B * Y[First]) + 0.5f * (A + B);
+
+            Primitive.Plane[Edge][0] = A;
+            Primitive.Plane[Edge][1] = B;
+            Primitive.Plane[Edge][2] = C;
+
+            Depth[0] += A * Z[Edge] * Reciprocal;
+            Depth[1] += B * Z[Edge] * Reciprocal;
+            Depth[2] += C * Z[Edge] * Reciprocal;
+        }
+
+        const UInt32 Index = mTriangles.size();
+        mTriangles.push_back(Primitive);
+
+        for (UInt32 Row = Primitive.MinY / k_TileHeight; Row <= Primitive.MaxY / k_TileHeight; ++Row)
+        {
+            for (UInt32 Column = Primitive.MinX / k_TileWidth; Column <= Primitive.MaxX / k_TileWidth; ++Column)
+            {
+                mBins[Row * mColumns + Column].push_back(Index);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Matrix4.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=(Undocumented)=-
+    class Occlusion final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_TileWidth  = 64;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_TileHeight = 32;
+
+    public:
+
+        // -=(Undocumented)=-
+        explicit Occlusion(UInt32 Width = 256, UInt32 Height = 128);
+
+        // -=(Undocumented)=-
+        void Begin(ConstRef<Matrix4f> ViewProjection);
+
+        // -=(Undocumented)=-
+        template<typename Index>
+        void Submit(CPtr<const Vector3f> Positions, CPtr<const Index> Indices, ConstRef<Matrix4f> Transform)
+        {
+            const Matrix4f Matrix = mViewProjection * Transform;
+
+            mClip.resize(Positions.size());
+
+            for (UInt32 Element = 0; Element < Positions.size(); ++Element)
+            {
+                ConstRef<Vector3f> Position = Positions[Element];
+                mClip[Element] = Matrix * Vector4f(Position.GetX(), Position.GetY(), Position.GetZ(), 1.0f);
+            }
+
+            for (UInt32 Element = 0; Element + 2 < Indices.size(); Element += 3)
+            {
+                Bin(mClip[Indices[Element]], mClip[Indices[Element + 1]], mClip[Indices[Element + 2]]);
+            }
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetTiles() const
+        {
+            return mBins.size();
+        }
+
+        // -=(Undocumented)=-
+        void Rasterize(UInt32 Tile);
+
+        // -=(Undocumented)=-
+        void Rasterize();
+
+        // -=(Undocumented)=-
+        void End();
+
+        // -=(Undocumented)=-
+        Bool IsVisible(ConstRef<Vector3f> Minimum, ConstRef<Vector3f> Maximum) const;
+
+        // -=(Undocumented)=-
+        UInt32 GetWidth() const
+        {
+            return mWidth;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetHeight() const
+        {
+            return mHeight;
+        }
+
+        // -=(Undocumented)=-
+        CPtr<const Real32> GetDepth() const
+        {
+            return mLevels[0].Depth;
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Triangle
+        {
+            // -=(Undocumented)=-
+            Real32 Plane[4][3];
+
+            // -=(Undocumented)=-
+            UInt32 MinX;
+
+            // -=(Undocumented)=-
+            UInt32 MinY;
+
+            // -=(Undocumented)=-
+            UInt32 MaxX;
+
+            // -=(Undocumented)=-
+            UInt32 MaxY;
+        };
+
+        // -=(Undocumented)=-
+        struct Level
+        {
+            // -=(Undocumented)=-
+            UInt32         Width;
+
+            // -=(Undocumented)=-
+            UInt32         Height;
+
+            // -=(Undocumented)=-
+            Vector<Real32> Depth;
+        };
+
+        // -=(Undocumented)=-
+        void Bin(ConstRef<Vector4f> V0, ConstRef<Vector4f> V1, ConstRef<Vector4f> V2);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UInt32                 mWidth;
+        UInt32                 mHeight;
+        UInt32                 mColumns;
+        Matrix4f               mViewProjection;
+        Vector<Vector4f>       mClip;
+        Vector<Triangle>       mTriangles;
+        Vector<Vector<UInt32>> mBins;
+        Vector<Level>          mLevels;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,407 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Tree.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Tree::Tree()
+        : mRoot  { k_Invalid },
+          mFree  { k_Invalid },
+          mCount { 0 }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Tree::Proxy Tree::Insert(ConstRef<Bounds> Bounds, UInt32 Data)
+    {
+        const Proxy Leaf = Allocate();
+
+        // Leaves store a fattened box so that small movements don't have to touch the tree at all.
+        Ref<Node> Node = mNodes[Leaf];
+        Node.Bounds = Scene::Bounds::Enlarge(Bounds, k_Margin);
+        Node.Data   = Data;
+        Node.Height = 0;
+
+        Attach(Leaf);
+
+        ++mCount;
+        return Leaf;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Remove(Proxy Proxy)
+    {
+        Detach(Proxy);
+        Free(Proxy);
+
+        --mCount;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Update(Proxy Proxy, ConstRef<Bounds> Bounds)
+    {
+        Ref<Node> Node = mNodes[Proxy];
+
+        if (Node.Bounds.Contains(Bounds))
+        {
+            return;
+        }
+
+        // A leaf that only drifted out of its fat box is refitted in place, which is a walk up to the root
+        // without any allocation; one that jumped away is reinserted so the tree doesn't degrade over time.
+        const Bool Overlapping = Node.Bounds.Intersects(Bounds);
+
+        if (Overlapping)
+        {
+            Node.Bounds = Scene::Bounds::Enlarge(Bounds, k_Margin);
+            Refit(Node.Parent);
+        }
+        else
+        {
+            Detach(Proxy);
+            mNodes[Proxy].Bounds = Scene::Bounds::Enlarge(Bounds, k_Margin);
+            Attach(Proxy);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Query(ConstRef<Bounds> Bounds, Ref<Vector<UInt32>> Result) const
+    {
+        Traverse([&](ConstRef<Scene::Bounds> Node)
+        {
+            return Node.Intersects(Bounds);
+        }, Result);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Query(ConstRef<Frustum> Frustum, Ref<Vector<UInt32>> Result) const
+    {
+        Traverse([&](ConstRef<Bounds> Node)
+        {
+            return Frustum.Intersects(Node);
+        }, Result);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Query(ConstRef<Vector3f> Center, Real32 Radius, Ref<Vector<UInt32>> Result) const
+    {
+        Traverse([&](ConstRef<Bounds> Node)
+        {
+            return Node.Intersects(Center, Radius);
+        }, Result);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Query(
+        ConstRef<Vector3f> Origin, ConstRef<Vector3f> Direction, Real32 Length, Ref<Vector<UInt32>> Result) const
+    {
+        const Vector3f Reciprocal(1.0f / Direction.GetX(), 1.0f / Direction.GetY(), 1.0f / Direction.GetZ());
+
+        Traverse([&](ConstRef<Bounds> Node)
+        {
+            return Node.Intersects(Origin, Reciprocal, Length);
+        }, Result);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Tree::Proxy Tree::Allocate()
+    {
+        if (mFree == k_Invalid)
+        {
+            mFree = mNodes.size();
+            mNodes.push_back(Node { Bounds(), k_Invalid, k_Invalid, k_Invalid, 0, -1 });
+        }
+
+        // The free list is threaded through the parent link of the released node(s).
+        const Proxy Proxy = mFree;
+        Ref<Node>   Node  = mNodes[Proxy];
+        mFree = Node.Parent;
+
+        Node.Parent = k_Invalid;
+        Node.Left   = k_Invalid;
+        Node.Right  = k_Invalid;
+        Node.Data   = 0;
+        Node.Height = 0;
+        return Proxy;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Free(Proxy Proxy)
+    {
+        Ref<Node> Node = mNodes[Proxy];
+        Node.Parent = mFree;
+        Node.Height = -1;
+
+        mFree = Proxy;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Attach(Proxy Leaf)
+    {
+        if (mRoot == k_Invalid)
+        {
+            mRoot = Leaf;
+            mNodes[Leaf].Parent = k_Invalid;
+            return;
+        }
+
+        // Walk down picking the child whose box grows the least, stopping as soon as pairing the leaf with
+        // the current node is cheaper than descending (surface area heuristic).
+        const Bounds Box   = mNodes[Leaf].Bounds;
+        Proxy        Index = mRoot;
+
+        while (!IsLeaf(Index))
+        {
+            ConstRef<Node> Current = mNodes[Index];
+
+            const Real32 Area        = Current.Bounds.GetArea();
+            const Real32 Combined    = Bounds::Merge(Current.Bounds, Box).GetArea();
+            const Real32 Cost        = 2.0f * Combined;
+            const Real32 Inheritance = 2.0f * (Combined - Area);
+
+            Real32 Costs[2];
+
+            for (UInt32 Side = 0; Side < 2; ++Side)
+            {
+                const Proxy Child = (Side == 0 ? Current.Left : Current.Right);
+                const Real32 Grown = Bounds::Merge(mNodes[Child].Bounds, Box).GetArea();
+
+                Costs[Side] = Grown + Inheritance - (IsLeaf(Child) ? 0.0f : mNodes[Child].Bounds.GetArea());
+            }
+
+            if (Cost < Costs[0] && Cost < Costs[1])
+            {
+                break;
+            }
+            Index = (Costs[0] < Costs[1] ? Current.Left : Current.Right);
+        }
+
+        const Proxy Sibling  = Index;
+        const Proxy Previous = mNodes[Sibling].Parent;
+        const Proxy Parent   = Allocate();
+
+        Ref<Node> Branch = mNodes[Parent];
+        Branch.Parent = Previous;
+        Branch.Left   = Sibling;
+        Branch.Right  = Leaf;
+        Branch.Data   = 0;
+        Branch.Bounds = Bounds::Merge(Box, mNodes[Sibling].Bounds);
+        Branch.Height = mNodes[Sibling].Height + 1;
+
+        if (Previous == k_Invalid)
+        {
+            mRoot = Parent;
+        }
+        else if (mNodes[Previous].Left == Sibling)
+        {
+            mNodes[Previous].Left = Parent;
+        }
+        else
+        {
+            mNodes[Previous].Right = Parent;
+        }
+
+        mNodes[Sibling].Parent = Parent;
+        mNodes[Leaf].Parent    = Parent;
+
+        Refit(Parent);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Detach(Proxy Leaf)
+    {
+        if (Leaf == mRoot)
+        {
+            mRoot = k_Invalid;
+            return;
+        }
+
+        const Proxy Parent  = mNodes[Leaf].Parent;
+        const Proxy Grand   = mNodes[Parent].Parent;
+        const Proxy Sibling = (mNodes[Parent].Left == Leaf ? mNodes[Parent].Right : mNodes[Parent].Left);
+
+        // The parent goes away together with the leaf, its other child takes its place.
+        if (Grand == k_Invalid)
+        {
+            mRoot = Sibling;
+        }
+        else if (mNodes[Grand].Left == Parent)
+        {
+            mNodes[Grand].Left = Sibling;
+        }
+        else
+        {
+            mNodes[Grand].Right = Sibling;
+        }
+
+        mNodes[Sibling].Parent = Grand;
+        mNodes[Leaf].Parent    = k_Invalid;
+        Free(Parent);
+
+        Refit(Grand);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Tree::Refit(Proxy Proxy)
+    {
+        while (Proxy != k_Invalid)
+        {
+            Proxy = Balance(Proxy);
+
+            Ref<Node> Node = mNodes[Proxy];
+            Node.Bounds = Bounds::Merge(mNodes[Node.Left].Bounds, mNodes[Node.Right].Bounds);
+            Node.Height = 1 + Max(mNodes[Node.Left].Height, mNodes[Node.Right].Height);
+
+            Proxy = Node.Parent;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Tree::Proxy Tree::Balance(Proxy Proxy)
+    {
+        const Tree::Proxy A = Proxy;
+
+        if (IsLeaf(A) || mNodes[A].Height < 2)
+        {
+            return A;
+        }
+
+        // Rotate the taller child up whenever the heights of both sides differ by more than one, moving its
+        // own taller child under it and handing the shorter one down to the node it replaces.
+        const Tree::Proxy B = mNodes[A].Left;
+        const Tree::Proxy C = mNodes[A].Right;
+        const SInt32 Difference = mNodes[C].Height - mNodes[B].Height;
+
+        if (Difference > -2 && Difference < 2)
+        {
+            return A;
+        }
+
+        const Bool        Right = (Difference > 0);
+        const Tree::Proxy Pivot = (Right ? C : B);
+        const Tree::Proxy Other = (Right ? B : C);
+        const Tree::Proxy First = mNodes[Pivot].Left;
+        const Tree::Proxy Last  = mNodes[Pivot].Right;
+
+        mNodes[Pivot].Left   = A;
+        mNodes[Pivot].Parent = mNodes[A].Parent;
+        mNodes[A].Parent     = Pivot;
+
+        if (const Tree::Proxy Parent = mNodes[Pivot].Parent; Parent == k_Invalid)
+        {
+            mRoot = Pivot;
+        }
+        else if (mNodes[Parent].Left == A)
+        {
+            mNodes[Parent].Left = Pivot;
+        }
+        else
+        {
+            mNodes[Parent].Right = Pivot;
+        }
+
+        const Bool        Keep  = (mNodes[First].Height > mNodes[Last].Height);
+        const Tree::Proxy Taller  = (Keep ? First : Last);
+        const Tree::Proxy Shorter = (Keep ? Last : First);
+
+        mNodes[Pivot].Right    = Taller;
+        mNodes[Shorter].Parent = A;
+
+        if (Right)
+        {
+            mNodes[A].Right = Shorter;
+        }
+        else
+        {
+            mNodes[A].Left  = Shorter;
+        }
+
+        mNodes[A].Bounds     = Bounds::Merge(mNodes[Other].Bounds, mNodes[Shorter].Bounds);
+        mNodes[A].Height     = 1 + Max(mNodes[Other].Height, mNodes[Shorter].Height);
+        mNodes[Pivot].Bounds = Bounds::Merge(mNodes[A].Bounds, mNodes[Taller].Bounds);
+        mNodes[Pivot].Height = 1 + Max(mNodes[A].Height, mNodes[Taller].Height);
+        return Pivot;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Filter>
+    void Tree::Traverse(Any<Filter> Predicate, Ref<Vector<UInt32>> Result) const
+    {
+        if (mRoot == k_Invalid)
+        {
+            return;
+        }
+
+        // The tree is kept balanced, so its height stays well below the size of the stack even for
+        // millions of proxies.
+        Array<Proxy, 256> Stack;
+        UInt32            Top = 0;
+
+        Stack[Top++] = mRoot;
+
+        while (Top > 0)
+        {
+            ConstRef<Node> Node = mNodes[Stack[--Top]];
+
+            if (!Predicate(Node.Bounds))
+            {
+                continue;
+            }
+
+            if (Node.Left == k_Invalid)
+            {
+                Result.push_back(Node.Data);
+            }
+            else
+            {
+                Stack[Top++] = Node.Left;
+                Stack[Top++] = Node.Right;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Frustum.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Scene
+{
+    // -=(Undocumented)=-
+    class Tree final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        using Proxy = UInt32;
+
+        // -=(Undocumented)=-
+        static constexpr Proxy  k_Invalid = UINT32_MAX;
+
+        // -=(Undocumented)=-
+        static constexpr Real32 k_Margin  = 0.1f;
+
+    public:
+
+        // -=(Undocumented)=-
+        Tree();
+
+        // -=(Undocumented)=-
+        Proxy Insert(ConstRef<Bounds> Bounds, UInt32 Data);
+
+        // -=(Undocumented)=-
+        void Remove(Proxy Proxy);
+
+        // -=(Undocumented)=-
+        void Update(Proxy Proxy, ConstRef<Bounds> Bounds);
+
+        // -=(Undocumented)=-
+        UInt32 GetData(Proxy Proxy) const
+        {
+            return mNodes[Proxy].Data;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Bounds> GetBounds(Proxy Proxy) const
+        {
+            return mNodes[Proxy].Bounds;
+        }
+
+        // -=(Undocumented)=-
+        UInt32 GetCount() const
+        {
+            return mCount;
+        }
+
+        // -=(Undocumented)=-
+        void Query(ConstRef<Bounds> Bounds, Ref<Vector<UInt32>> Result) const;
+
+        // -=(Undocumented)=-
+        void Query(ConstRef<Frustum> Frustum, Ref<Vector<UInt32>> Result) const;
+
+        // -=(Undocumented)=-
+        void Query(ConstRef<Vector3f> Center, Real32 Radius, Ref<Vector<UInt32>> Result) const;
+
+        // -=(Undocumented)=-
+        void Query(
+            ConstRef<Vector3f> Origin, ConstRef<Vector3f> Direction, Real32 Length, Ref<Vector<UInt32>> Result) const;
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Node
+        {
+            // -=(Undocumented)=-
+            Scene::Bounds Bounds;
+
+            // -=(Undocumented)=-
+            Proxy         Parent;
+
+            // -=(Undocumented)=-
+            Proxy         Left;
+
+            // -=(Undocumented)=-
+            Proxy         Right;
+
+            // -=(Undocumented)=-
+            UInt32        Data;
+
+            // -=(Undocumented)=-
+            SInt32        Height;
+        };
+
+        // -=(Undocumented)=-
+        Bool IsLeaf(Proxy Proxy) const
+        {
+            return mNodes[Proxy].Left == k_Invalid;
+        }
+
+        // -=(Undocumented)=-
+        Proxy Allocate();
+
+        // -=(Undocumented)=-
+        void Free(Proxy Proxy);
+
+        // -=(Undocumented)=-
+        void Attach(Proxy Leaf);
+
+        // -=(Undocumented)=-
+        void Detach(Proxy Leaf);
+
+        // -=(Undocumented)=-
+        void Refit(Proxy Proxy);
+
+        // -=(Undocumented)=-
+        Proxy Balance(Proxy Proxy);
+
+        // -=(Undocumented)=-
+        template<typename Filter>
+        void Traverse(Any<Filter> Predicate, Ref<Vector<UInt32>> Result) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Node> mNodes;
+        Proxy        mRoot;
+        Proxy        mFree;
+        UInt32       mCount;
+    };
+}
\ No newline at end of file
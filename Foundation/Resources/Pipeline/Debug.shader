@@ -0,0 +1,39 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// Uniforms
+
+cbuffer cb_Scene : register(b0)
+{
+    float4x4 uCamera;
+};
+
+// Definition
+
+struct ps_Input
+{
+    float4 Position : SV_POSITION;
+    float4 Color    : COLOR0;
+};
+
+// VS Main
+
+ps_Input vertex(float3 Position : POSITION, float4 Color : COLOR)
+{
+    ps_Input Result;
+    Result.Position = mul(uCamera, float4(Position.xyz, 1.f));
+    Result.Color    = Color;
+    return Result;
+}
+
+// PS Main
+
+float4 fragment(ps_Input Input) : SV_Target
+{
+    return Input.Color;
+}
\ No newline at end of file
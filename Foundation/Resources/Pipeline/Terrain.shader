@@ -0,0 +1,75 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// Resources
+
+Texture2DArray HeightTexture : register(t0);
+SamplerState   HeightSampler : register(s0);
+
+// Uniforms
+
+cbuffer cb_Scene : register(b0)
+{
+    float4x4 uCamera;
+    float4   uEye;
+    float4   uLayout; // Spacing, Elevation, 1 / Samples, Grid
+    float4   uSun;
+};
+
+// Definition
+
+struct ps_Input
+{
+    float4 Position : SV_POSITION;
+    float3 Normal   : NORMAL0;
+};
+
+// Heightmap
+
+float height(float2 Sample, float Layer)
+{
+    float2 Coordinates = (Sample + 0.5f) * uLayout.z;
+    return HeightTexture.SampleLevel(HeightSampler, float3(Coordinates, Layer), 0).r * uLayout.y;
+}
+
+// VS Main
+
+ps_Input vertex(float2 Grid : POSITION, float4 Placement : TEXCOORD1, float4 Morph : TEXCOORD2)
+{
+    float Cell = Placement.z / uLayout.w;   // Distance between two vertices of the node
+    float Step = Cell / uLayout.x;          // Samples between two vertices of the node
+
+    // Slide the odd vertices onto the grid of the parent as they approach the end of the range of the node
+    float2 World    = Placement.xy + Grid * Cell;
+    float  Distance = distance(float3(World.x, height(Morph.zw + Grid * Step, Placement.w), World.y), uEye.xyz);
+    float  Factor   = saturate((Distance - Morph.x) / (Morph.y - Morph.x));
+    float2 Local    = Grid - frac(Grid * 0.5f) * 2.0f * Factor;
+    float2 Sample   = Morph.zw + Local * Step;
+
+    World = Placement.xy + Local * Cell;
+
+    float Left   = height(Sample - float2(Step, 0.0f), Placement.w);
+    float Right  = height(Sample + float2(Step, 0.0f), Placement.w);
+    float Bottom = height(Sample - float2(0.0f, Step), Placement.w);
+    float Top    = height(Sample + float2(0.0f, Step), Placement.w);
+
+    ps_Input Result;
+    Result.Position = mul(uCamera, float4(World.x, height(Sample, Placement.w), World.y, 1.f));
+    Result.Normal   = float3(Left - Right, 2.0f * Cell, Bottom - Top);
+    return Result;
+}
+
+// PS Main
+
+float4 fragment(ps_Input Input) : SV_Target
+{
+    float3 Normal  = normalize(Input.Normal);
+    float3 Albedo  = lerp(float3(0.32f, 0.42f, 0.20f), float3(0.45f, 0.40f, 0.35f), saturate((1.0f - Normal.y) * 3.0f));
+    float  Diffuse = saturate(dot(Normal, uSun.xyz));
+    return float4(Albedo * (0.25f + 0.75f * Diffuse), 1.0f);
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Application.hpp"
+#include <Aurora.Content/Locator/SystemLocator.hpp>
+#include <Aurora.Graphic/GLES3/GLES3Driver.hpp>
+#include <Aurora.Graphic/Null/NullDriver.hpp>
+
+#ifdef    SDL_PLATFORM_WINDOWS
+    #include <Aurora.Graphic/D3D11/D3D11Driver.hpp>
+#endif // SDL_PLATFORM_WINDOWS
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Replay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Application::Application()
+        : mWindow { nullptr }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Application::~Application()
+    {
+        mDriver = nullptr;
+
+        if (mWindow)
+        {
+            SDL_DestroyWindow(mWindow);
+            SDL_Quit();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Application::Initialize(CStr Filename, Graphic::Backend Backend)
+    {
+        mFile = Content::SystemLocator().Read(Filename);
+
+        if (!mFile.HasData() || !Graphic::Capture::Parse(mFile.GetSpan<UInt8>(), mFrames))
+        {
+            Log::Error("Replay: '{}' is not a valid capture", Filename);
+            return false;
+        }
+
+        // The null driver doesn't need a swapchain, which allows replaying captures on headless
+        // machines to measure the cost of the command stream without the driver overhead.
+        if (Backend != Graphic::Backend::None)
+        {
+            SDL_Init(SDL_INIT_VIDEO);
+
+            const SDL_WindowFlags Flags = (Backend == Graphic::Backend::GLES3 ? SDL_WINDOW_OPENGL : 0);
+            mWindow = SDL_CreateWindow("Aurora Replay", 1280, 720, Flags);
+
+            if (!mWindow)
+            {
+                Log::Error("Replay: Failed to create window: '{}'", SDL_GetError());
+                return false;
+            }
+        }
+
+        switch (Backend)
+        {
+#ifdef    SDL_PLATFORM_WINDOWS
+        case Graphic::Backend::D3D11:
+            mDriver = NewUniquePtr<Graphic::D3D11Driver>();
+            break;
+#endif // SDL_PLATFORM_WINDOWS
+        case Graphic::Backend::GLES3:
+            mDriver = NewUniquePtr<Graphic::GLES3Driver>();
+            break;
+        default:
+            mDriver = NewUniquePtr<Graphic::NullDriver>();
+            break;
+        }
+
+        Log::Info("Replay: Loaded {} frame(s) from '{}' using {}", mFrames.size(), Filename, magic_enum::enum_name(Backend));
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Application::Run()
+    {
+        mTimings.reserve(mFrames.size());
+
+        for (CPtr<UInt8> Frame : mFrames)
+        {
+            SDL_PumpEvents();
+
+            const UInt64 Start = SDL_GetTicksNS();
+            Graphic::Capture::Execute(* mDriver, mWindow, Frame);
+            mTimings.push_back(SDL_GetTicksNS() - Start);
+        }
+
+        Report();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Application::Report()
+    {
+        constexpr UInt32 k_MaxHitches = 16;
+
+        if (mTimings.empty())
+        {
+            return;
+        }
+
+        const auto AsMilliseconds = [](UInt64 Nanoseconds)
+        {
+            return static_cast<Real64>(Nanoseconds) / static_cast<Real64>(SDL_NS_PER_MS);
+        };
+
+        Vector<UInt64> Sorted(mTimings);
+        Sort(Sorted, std::less<UInt64>());
+
+        const auto Percentile = [&Sorted](Real64 Rank)
+        {
+            return Sorted[Min<UInt>(Sorted.size() - 1, static_cast<UInt>(Rank * Sorted.size()))];
+        };
+
+        UInt64 Total = 0;
+        for (const UInt64 Timing : mTimings)
+        {
+            Total += Timing;
+        }
+
+        Log::Info("Replay: {} frame(s), {:.3f} ms total", mTimings.size(), AsMilliseconds(Total));
+        Log::Info("Replay:     avg {:.3f} ms, min {:.3f} ms, max {:.3f} ms",
+            AsMilliseconds(Total / mTimings.size()), AsMilliseconds(Sorted.front()), AsMilliseconds(Sorted.back()));
+        Log::Info("Replay:     p50 {:.3f} ms, p95 {:.3f} ms, p99 {:.3f} ms",
+            AsMilliseconds(Percentile(0.50)), AsMilliseconds(Percentile(0.95)), AsMilliseconds(Percentile(0.99)));
+
+        // Any frame taking more than twice the median is reported as a hitch, the first frame is
+        // skipped since it usually carries the initialization and the upload of every resource.
+        const UInt64 Threshold = Percentile(0.50) * 2;
+
+        for (UInt32 Index = 1, Count = 0; Index < mTimings.size() && Count < k_MaxHitches; ++Index)
+        {
+            if (mTimings[Index] > Threshold)
+            {
+                Log::Info("Replay:     hitch at frame {} ({:.3f} ms, {} bytes)",
+                    Index, AsMilliseconds(mTimings[Index]), mFrames[Index].size());
+                ++Count;
+            }
+        }
+    }
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#ifdef    SDL_PLATFORM_WINDOWS
+    #include <Windows.h>
+#endif // SDL_PLATFORM_WINDOWS
+
+int main(int Argc, Ptr<Char> Argv[])
+{
+#ifdef    SDL_PLATFORM_WINDOWS
+    ::CoInitialize(nullptr);
+#endif // SDL_PLATFORM_WINDOWS
+
+    Log::Initialize("Aurora.Replay.log");
+
+    if (Argc < 2)
+    {
+        Log::Error("Usage: Aurora_Replay <Capture> [None|D3D11|GLES3]");
+        return 1;
+    }
+
+    const Graphic::Backend Backend
+        = (Argc > 2 ? magic_enum::enum_cast<Graphic::Backend>(Argv[2]).value_or(Graphic::Backend::None) : Graphic::Backend::None);
+
+    // Initialize 'Aurora Replay' and execute every frame of the capture
+    UPtr<Replay::Application> Replay = NewUniquePtr<Replay::Application>();
+
+    if (!Replay->Initialize(Argv[1], Backend))
+    {
+        return 1;
+    }
+    Replay->Run();
+
+    return 0;
+}
\ No newline at end of file
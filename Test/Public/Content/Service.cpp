@@ -0,0 +1,159 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2024 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Content/Service.hpp"
+#include <chrono>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Test
+{
+    // -=(Undocumented)=-
+    class Blob final : public Content::AbstractResource<Blob>
+    {
+    public:
+
+        // -=(Undocumented)=-
+        explicit Blob(Any<Content::Uri> Key)
+            : AbstractResource(Move(Key))
+        {
+        }
+
+        // \see Resource::OnCreate(Ref<Subsystem::Context>)
+        Bool OnCreate(Ref<Subsystem::Context> Context) override
+        {
+            return true;
+        }
+
+        // \see Resource::OnDelete(Ref<Subsystem::Context>)
+        void OnDelete(Ref<Subsystem::Context> Context) override
+        {
+        }
+    };
+
+    // -=(Undocumented)=-
+    class BlobLoader final : public Content::AbstractLoader<BlobLoader, Blob>
+    {
+    public:
+
+        // \see Loader::GetExtensions
+        List<CStr> GetExtensions() const override
+        {
+            static List<CStr> EXTENSION_LIST = { "blob" };
+            return EXTENSION_LIST;
+        }
+
+        // \see AbstractLoader::Load
+        Bool OnLoad(Ref<Content::Service> Service, Any<Data> File, Ref<Blob> Asset)
+        {
+            return true;
+        }
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool Await(Ref<Content::Service> Service, ConstRef<Content::Future<Blob>> Future)
+    {
+        // Creation only happens on the main thread, so the service is ticked while the future is pending.
+        const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+        while (!Future.IsReady())
+        {
+            if (std::chrono::steady_clock::now() > Deadline)
+            {
+                return false;
+            }
+            Service.OnTick(0.0, 0.0);
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool TestAsyncMissing(Ref<Content::Service> Service)
+    {
+        const Content::Future<Blob> Future = Service.LoadAsync<Blob>("Engine://Missing.blob");
+
+        if (!Await(Service, Future))
+        {
+            Log::Error("Test: a future for a missing file never became ready");
+            return false;
+        }
+
+        if (!Future.HasFailed())
+        {
+            Log::Error("Test: a future for a missing file did not report the failure");
+            return false;
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool TestAsyncPresent(Ref<Content::Service> Service)
+    {
+        Service.Save("Engine://Present.blob", "Blob");
+
+        const Content::Future<Blob> Future = Service.LoadAsync<Blob>("Engine://Present.blob");
+
+        if (!Await(Service, Future) || !Future.HasLoaded())
+        {
+            Log::Error("Test: a future for an existing file did not load");
+            return false;
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool TestSyncMissing(Ref<Content::Service> Service)
+    {
+        if (ConstSPtr<Blob> Asset = Service.Load<Blob>("Engine://Absent.blob"); !Asset || !Asset->HasFailed())
+        {
+            Log::Error("Test: a synchronous load of a missing file did not report the failure");
+            return false;
+        }
+        return true;
+    }
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+int main(int Argc, Ptr<Char> Argv[])
+{
+    Log::Initialize("Aurora.Test.log");
+
+    Bool Successful = true;
+
+    {
+        // Server mode keeps the default loaders (and the devices they need) out of the way.
+        Subsystem::Context Context;
+        Context.SetMode(Subsystem::Context::Mode::Server);
+
+        ConstSPtr<Content::Service> Service = Context.AddSubsystem<Content::Service>();
+        Service->AddLoader(NewPtr<Test::BlobLoader>());
+
+        Successful &= Test::TestAsyncMissing(* Service);
+        Successful &= Test::TestAsyncPresent(* Service);
+        Successful &= Test::TestSyncMissing(* Service);
+    }
+
+    Log::Shutdown();
+    return (Successful ? 0 : 1);
+}
\ No newline at end of file